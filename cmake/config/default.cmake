@@ -144,6 +144,14 @@ bf_add_config(
     SKIP_VALIDATION
 )
 
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_MAX_NUMA_NODES
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "8"
+    DESCRIPTION "Defines the hypervisor's max number of NUMA nodes supported"
+    SKIP_VALIDATION
+)
+
 bf_add_config(
     CONFIG_NAME HYPERVISOR_MAX_VPS
     CONFIG_TYPE STRING
@@ -323,7 +331,7 @@ bf_add_config(
 bf_add_config(
     CONFIG_NAME HYPERVISOR_HUGE_POOL_SIZE
     CONFIG_TYPE STRING
-    DEFAULT_VAL "0x10000"
+    DEFAULT_VAL "0x400000"
     DESCRIPTION "Defines the hypervisor's default huge pool size in bytes"
     SKIP_VALIDATION
 )
@@ -335,3 +343,11 @@ bf_add_config(
     DESCRIPTION "Defines the hypervisor's default page pool size in bytes"
     SKIP_VALIDATION
 )
+
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_SYSCALL_TRACE
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "0"
+    DESCRIPTION "Set to 1 to record every syscall into per-PP trace buffers"
+    OPTIONS 0 1
+)
@@ -57,6 +57,7 @@ macro(hypervisor_add_cmake_args)
         -DHYPERVISOR_MAX_EXTENSIONS=${HYPERVISOR_MAX_EXTENSIONS}
         -DHYPERVISOR_MAX_VMS=${HYPERVISOR_MAX_VMS}
         -DHYPERVISOR_MAX_PPS=${HYPERVISOR_MAX_PPS}
+        -DHYPERVISOR_MAX_NUMA_NODES=${HYPERVISOR_MAX_NUMA_NODES}
         -DHYPERVISOR_MAX_VPS=${HYPERVISOR_MAX_VPS}
         -DHYPERVISOR_MAX_VPS_PER_VM=${HYPERVISOR_MAX_VPS_PER_VM}
         -DHYPERVISOR_MAX_VPSS_PER_VP=${HYPERVISOR_MAX_VPSS_PER_VP}
@@ -81,5 +82,6 @@ macro(hypervisor_add_cmake_args)
         -DHYPERVISOR_EXT_HEAP_POOL_SIZE=${HYPERVISOR_EXT_HEAP_POOL_SIZE}
         -DHYPERVISOR_HUGE_POOL_SIZE=${HYPERVISOR_HUGE_POOL_SIZE}
         -DHYPERVISOR_PAGE_POOL_SIZE=${HYPERVISOR_PAGE_POOL_SIZE}
+        -DHYPERVISOR_SYSCALL_TRACE=${HYPERVISOR_SYSCALL_TRACE}
     )
 endmacro(hypervisor_add_cmake_args)
@@ -116,6 +116,11 @@ macro(hypervisor_add_info)
         VERBATIM
     )
 
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_MAX_NUMA_NODES      ${BF_COLOR_CYN}${HYPERVISOR_MAX_NUMA_NODES}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
     add_custom_command(TARGET info
         COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_MAX_VPS             ${BF_COLOR_CYN}${HYPERVISOR_MAX_VPS}${BF_COLOR_RST}"
         VERBATIM
@@ -236,6 +241,11 @@ macro(hypervisor_add_info)
         VERBATIM
     )
 
+    add_custom_command(TARGET info
+        COMMAND ${CMAKE_COMMAND} -E echo "${BF_COLOR_YLW}   HYPERVISOR_SYSCALL_TRACE       ${BF_COLOR_CYN}${HYPERVISOR_SYSCALL_TRACE}${BF_COLOR_RST}"
+        VERBATIM
+    )
+
     add_custom_command(TARGET info
         COMMAND ${CMAKE_COMMAND} -E echo " "
         VERBATIM
@@ -35,6 +35,7 @@ include(${CMAKE_CURRENT_LIST_DIR}/target/info.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/target/start.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/target/stop.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/target/dump.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/target/stats.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/target/loader_build.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/target/loader_load.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/target/loader_unload.cmake)
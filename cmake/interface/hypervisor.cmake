@@ -30,6 +30,7 @@ target_compile_definitions(hypervisor INTERFACE
     HYPERVISOR_MAX_EXTENSIONS=${HYPERVISOR_MAX_EXTENSIONS}
     HYPERVISOR_MAX_VMS=${HYPERVISOR_MAX_VMS}
     HYPERVISOR_MAX_PPS=${HYPERVISOR_MAX_PPS}
+    HYPERVISOR_MAX_NUMA_NODES=${HYPERVISOR_MAX_NUMA_NODES}
     HYPERVISOR_MAX_VPS=${HYPERVISOR_MAX_VPS}
     HYPERVISOR_MAX_VPS_PER_VM=${HYPERVISOR_MAX_VPS_PER_VM}
     HYPERVISOR_MAX_VPSS_PER_VP=${HYPERVISOR_MAX_VPSS_PER_VP}
@@ -54,4 +55,5 @@ target_compile_definitions(hypervisor INTERFACE
     HYPERVISOR_EXT_HEAP_POOL_SIZE=${HYPERVISOR_EXT_HEAP_POOL_SIZE}
     HYPERVISOR_HUGE_POOL_SIZE=${HYPERVISOR_HUGE_POOL_SIZE}
     HYPERVISOR_PAGE_POOL_SIZE=${HYPERVISOR_PAGE_POOL_SIZE}
+    HYPERVISOR_SYSCALL_TRACE=${HYPERVISOR_SYSCALL_TRACE}
 )
@@ -43,6 +43,7 @@ if (NOT EXISTS ${CMAKE_BINARY_DIR}/include/constants.h)
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_EXTENSIONS ((uint64_t)(${HYPERVISOR_MAX_EXTENSIONS}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_VMS ((uint64_t)(${HYPERVISOR_MAX_VMS}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_PPS ((uint64_t)(${HYPERVISOR_MAX_PPS}))\n")
+    file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_NUMA_NODES ((uint64_t)(${HYPERVISOR_MAX_NUMA_NODES}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_VPS ((uint64_t)(${HYPERVISOR_MAX_VPS}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_VPS_PER_VM ((uint64_t)(${HYPERVISOR_MAX_VPS_PER_VM}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_MAX_VPSS_PER_VP ((uint64_t)(${HYPERVISOR_MAX_VPSS_PER_VP}))\n")
@@ -67,6 +68,7 @@ if (NOT EXISTS ${CMAKE_BINARY_DIR}/include/constants.h)
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_EXT_HEAP_POOL_SIZE ((uint64_t)(${HYPERVISOR_EXT_HEAP_POOL_SIZE}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_HUGE_POOL_SIZE ((uint64_t)(${HYPERVISOR_HUGE_POOL_SIZE}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_PAGE_POOL_SIZE ((uint64_t)(${HYPERVISOR_PAGE_POOL_SIZE}))\n")
+    file(APPEND ${HYPERVISOR_CONSTANTS} "#define HYPERVISOR_SYSCALL_TRACE ((uint64_t)(${HYPERVISOR_SYSCALL_TRACE}))\n")
     file(APPEND ${HYPERVISOR_CONSTANTS} "\n")
 
     file(APPEND ${HYPERVISOR_CONSTANTS} "#endif\n")
@@ -43,20 +43,25 @@ namespace example
     /// <!-- inputs/outputs -->
     ///   @param vpsid the ID of the VPS that generated the VMExit
     ///   @param exit_reason the exit reason associated with the VMExit
+    ///   @return Returns the BF_VMEXIT_DISPOSITION_XXX the microkernel
+    ///     should act on once this function returns.
     ///
-    void
-    vmexit_entry(bsl::uint16 const vpsid, bsl::uint64 const exit_reason) noexcept
+    [[nodiscard]] auto
+    vmexit_entry(bsl::uint16 const vpsid, bsl::uint64 const exit_reason) noexcept -> bsl::uint64
     {
-        vmexit(g_handle, vpsid, exit_reason);
+        auto const disposition{vmexit(g_handle, vpsid, exit_reason)};
+        if (bsl::unlikely(!disposition)) {
+            /// NOTE:
+            /// - This code is only reached if an error occurs. Executing this
+            ///   syscall will tell the microkernel that the VMExit was not
+            ///   handled, in which case it will enter a fast fail state.
+            ///
 
-        /// NOTE:
-        /// - This code is only reached if an error occurs. Executing this
-        ///   syscall will tell the microkernel that the VMExit was not
-        ///   handled, in which case it will enter a fast fail state.
-        ///
+            bsl::print<bsl::V>() << bsl::here();
+            syscall::bf_control_op_exit();
+        }
 
-        bsl::print<bsl::V>() << bsl::here();
-        syscall::bf_control_op_exit();
+        return disposition.get();
     }
 
     /// <!-- description -->
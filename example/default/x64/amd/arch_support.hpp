@@ -30,7 +30,6 @@
 
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
-#include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/unlikely.hpp>
@@ -45,24 +44,24 @@ namespace example
     ///   @param handle the handle to use
     ///   @param vpsid the ID of the VPS that generated the VMExit
     ///   @param exit_reason the exit reason associated with the VMExit
+    ///   @return Returns the BF_VMEXIT_DISPOSITION_XXX the microkernel should
+    ///     act on, or bsl::safe_uint64::zero(true) on failure.
     ///
     template<typename HANDLE_CONCEPT>
-    constexpr void
+    [[nodiscard]] constexpr auto
     vmexit(
         HANDLE_CONCEPT &handle,
         bsl::safe_uint16 const &vpsid,
-        bsl::safe_uint64 const &exit_reason) noexcept
+        bsl::safe_uint64 const &exit_reason) noexcept -> bsl::safe_uint64
     {
         bsl::errc_type ret{};
         constexpr bsl::safe_uintmax EXIT_REASON_CPUID{bsl::to_umax(0x72U)};
 
         /// NOTE:
-        /// - At a minimum, we need to handle CPUID on AMD. Note that the
-        ///   "run" APIs all return an error code, but for the most part we
-        ///   can ignore them. If the this function succeeds, it will not
-        ///   return. If it fails, it will return, and the error code is
-        ///   always UNKNOWN. We output the current line so that debugging
-        ///   the issue is easier.
+        /// - At a minimum, we need to handle CPUID on AMD. Instead of
+        ///   calling one of the "run" APIs, we return a disposition that
+        ///   tells the microkernel what to do once we return, which saves
+        ///   a syscall on every VMExit.
         ///
 
         switch (exit_reason.get()) {
@@ -70,12 +69,10 @@ namespace example
                 ret = handle_vmexit_cpuid(handle, vpsid);
                 if (bsl::unlikely(!ret)) {
                     bsl::print<bsl::V>() << bsl::here();
-                    return;
+                    return bsl::safe_uint64::zero(true);
                 }
 
-                bsl::discard(syscall::bf_vps_op_advance_ip_and_run_current(handle));
-                bsl::print<bsl::V>() << bsl::here();
-                return;
+                return syscall::BF_VMEXIT_DISPOSITION_ADVANCE_IP_AND_RESUME;
             }
 
             default: {
@@ -87,6 +84,8 @@ namespace example
                      << bsl::hex(exit_reason)      // --
                      << bsl::endl                  // --
                      << bsl::here();               // --
+
+        return bsl::safe_uint64::zero(true);
     }
 
     /// <!-- description -->
@@ -106,19 +105,8 @@ namespace example
         syscall::bf_status_t status{};
 
         /// NOTE:
-        /// - Set up ASID
-        ///
-
-        constexpr bsl::safe_uint64 guest_asid_idx{bsl::to_u64(0x0058)};
-        constexpr bsl::safe_uint32 guest_asid_val{bsl::to_u32(0x1)};
-
-        status = syscall::bf_vps_op_write32(handle, vpsid, guest_asid_idx, guest_asid_val);
-        if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
-        }
-
-        /// NOTE:
+        /// - The ASID is assigned by the microkernel when the VPS is
+        ///   created, so there is no need to set it up here.
         /// - Set up wht intercept controls. On AMD, we need to intercept
         ///   VMRun, and CPUID if we plan to support reporting and stopping.
         ///
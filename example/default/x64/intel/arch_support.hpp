@@ -28,9 +28,9 @@
 #include <common_arch_support.hpp>
 #include <mk_interface.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
-#include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/unlikely.hpp>
@@ -163,13 +163,15 @@ namespace example
     ///   @param handle the handle to use
     ///   @param vpsid the ID of the VPS that generated the VMExit
     ///   @param exit_reason the exit reason associated with the VMExit
+    ///   @return Returns the BF_VMEXIT_DISPOSITION_XXX the microkernel should
+    ///     act on, or bsl::safe_uint64::zero(true) on failure.
     ///
     template<typename HANDLE_CONCEPT>
-    constexpr void
+    [[nodiscard]] constexpr auto
     vmexit(
         HANDLE_CONCEPT &handle,
         bsl::safe_uint16 const &vpsid,
-        bsl::safe_uint64 const &exit_reason) noexcept
+        bsl::safe_uint64 const &exit_reason) noexcept -> bsl::safe_uint64
     {
         bsl::errc_type ret{};
         constexpr bsl::safe_uintmax EXIT_REASON_NMI{bsl::to_umax(0x0)};
@@ -177,12 +179,10 @@ namespace example
         constexpr bsl::safe_uintmax EXIT_REASON_CPUID{bsl::to_umax(0xA)};
 
         /// NOTE:
-        /// - At a minimum, we need to handle CPUID and NMIs on Intel. Note
-        ///   that the "run" APIs all return an error code, but for the most
-        ///   part we can ignore them. If the this function succeeds, it will
-        ///   not return. If it fails, it will return, and the error code is
-        ///   always UNKNOWN. We output the current line so that debugging
-        ///   the issue is easier.
+        /// - At a minimum, we need to handle CPUID and NMIs on Intel. Instead of
+        ///   calling one of the "run" APIs, we return a disposition that
+        ///   tells the microkernel what to do once we return, which saves
+        ///   a syscall on every VMExit.
         ///
 
         switch (exit_reason.get()) {
@@ -190,36 +190,30 @@ namespace example
                 ret = handle_vmexit_nmi(handle, vpsid);
                 if (bsl::unlikely(!ret)) {
                     bsl::print<bsl::V>() << bsl::here();
-                    return;
+                    return bsl::safe_uint64::zero(true);
                 }
 
-                bsl::discard(syscall::bf_vps_op_run_current(handle));
-                bsl::print<bsl::V>() << bsl::here();
-                return;
+                return syscall::BF_VMEXIT_DISPOSITION_RESUME;
             }
 
             case EXIT_REASON_NMI_WINDOW.get(): {
                 ret = handle_vmexit_nmi_window(handle, vpsid);
                 if (bsl::unlikely(!ret)) {
                     bsl::print<bsl::V>() << bsl::here();
-                    return;
+                    return bsl::safe_uint64::zero(true);
                 }
 
-                bsl::discard(syscall::bf_vps_op_run_current(handle));
-                bsl::print<bsl::V>() << bsl::here();
-                return;
+                return syscall::BF_VMEXIT_DISPOSITION_RESUME;
             }
 
             case EXIT_REASON_CPUID.get(): {
                 ret = handle_vmexit_cpuid(handle, vpsid);
                 if (bsl::unlikely(!ret)) {
                     bsl::print<bsl::V>() << bsl::here();
-                    return;
+                    return bsl::safe_uint64::zero(true);
                 }
 
-                bsl::discard(syscall::bf_vps_op_advance_ip_and_run_current(handle));
-                bsl::print<bsl::V>() << bsl::here();
-                return;
+                return syscall::BF_VMEXIT_DISPOSITION_ADVANCE_IP_AND_RESUME;
             }
 
             default: {
@@ -231,6 +225,8 @@ namespace example
                      << bsl::hex(exit_reason)      // --
                      << bsl::endl                  // --
                      << bsl::here();               // --
+
+        return bsl::safe_uint64::zero(true);
     }
 
     /// <!-- description -->
@@ -250,18 +246,10 @@ namespace example
         syscall::bf_status_t status{};
 
         /// NOTE:
-        /// - Set up VPID
+        /// - The VPID is assigned by the microkernel when the VPS is
+        ///   created. All we have to do is turn on VPID below.
         ///
 
-        constexpr bsl::safe_uintmax vmcs_vpid_idx{bsl::to_umax(0x0000U)};
-        constexpr bsl::safe_uint16 vmcs_vpid_val{bsl::to_u16(0x1)};
-
-        status = syscall::bf_vps_op_write16(handle, vpsid, vmcs_vpid_idx, vmcs_vpid_val);
-        if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
-        }
-
         /// NOTE:
         /// - Set up the VMCS link pointer
         ///
@@ -269,12 +257,6 @@ namespace example
         constexpr bsl::safe_uintmax vmcs_link_ptr_idx{bsl::to_umax(0x2800U)};
         constexpr bsl::safe_uintmax vmcs_link_ptr_val{bsl::to_umax(0xFFFFFFFFFFFFFFFFU)};
 
-        status = syscall::bf_vps_op_write64(handle, vpsid, vmcs_link_ptr_idx, vmcs_link_ptr_val);
-        if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
-        }
-
         /// NOTE:
         /// - Set up the VMCS pin based, proc based, exit and entry controls
         /// - We turn on MSR bitmaps so that we do not trap on MSR reads and
@@ -310,25 +292,24 @@ namespace example
         constexpr bsl::safe_uint32 ia32_vmx_true_entry_ctls{bsl::to_u32(0x490U)};
         constexpr bsl::safe_uint32 ia32_vmx_true_procbased_ctls2{bsl::to_u32(0x48BU)};
 
-        bsl::safe_uintmax ctls{};
+        bsl::safe_uintmax pinbased_ctls{};
+        bsl::safe_uintmax procbased_ctls{};
+        bsl::safe_uintmax exit_ctls{};
+        bsl::safe_uintmax entry_ctls{};
+        bsl::safe_uintmax procbased_ctls2{};
 
-        auto mask = [](bsl::safe_uintmax const &val) noexcept -> bsl::safe_uint32 {
+        auto mask = [](bsl::safe_uintmax const &val) noexcept -> bsl::safe_uintmax {
             constexpr bsl::safe_uintmax ctls_mask{bsl::to_umax(0x00000000FFFFFFFFU)};
             constexpr bsl::safe_uintmax ctls_shift{bsl::to_umax(32)};
-            return bsl::to_u32_unsafe((val & ctls_mask) & (val >> ctls_shift));
+            return (val & ctls_mask) & (val >> ctls_shift);
         };
 
         /// NOTE:
         /// - Configure the pin based controls
         ///
 
-        status = syscall::bf_intrinsic_op_read_msr(handle, ia32_vmx_true_pinbased_ctls, ctls);
-        if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
-        }
-
-        status = syscall::bf_vps_op_write32(handle, vpsid, vmcs_pinbased_ctls_idx, mask(ctls));
+        status = syscall::bf_intrinsic_op_read_msr(
+            handle, ia32_vmx_true_pinbased_ctls, pinbased_ctls);
         if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
@@ -341,32 +322,21 @@ namespace example
         constexpr bsl::safe_uintmax enable_msr_bitmaps{bsl::to_umax(0x10000000U)};
         constexpr bsl::safe_uintmax enable_procbased_ctls2{bsl::to_umax(0x80000000U)};
 
-        status = syscall::bf_intrinsic_op_read_msr(handle, ia32_vmx_true_procbased_ctls, ctls);
+        status = syscall::bf_intrinsic_op_read_msr(
+            handle, ia32_vmx_true_procbased_ctls, procbased_ctls);
         if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
         }
 
-        ctls |= enable_msr_bitmaps;
-        ctls |= enable_procbased_ctls2;
-
-        status = syscall::bf_vps_op_write32(handle, vpsid, vmcs_procbased_ctls_idx, mask(ctls));
-        if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
-        }
+        procbased_ctls |= enable_msr_bitmaps;
+        procbased_ctls |= enable_procbased_ctls2;
 
         /// NOTE:
         /// - Configure the exit controls
         ///
 
-        status = syscall::bf_intrinsic_op_read_msr(handle, ia32_vmx_true_exit_ctls, ctls);
-        if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
-        }
-
-        status = syscall::bf_vps_op_write32(handle, vpsid, vmcs_exit_ctls_idx, mask(ctls));
+        status = syscall::bf_intrinsic_op_read_msr(handle, ia32_vmx_true_exit_ctls, exit_ctls);
         if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
@@ -376,13 +346,7 @@ namespace example
         /// - Configure the entry controls
         ///
 
-        status = syscall::bf_intrinsic_op_read_msr(handle, ia32_vmx_true_entry_ctls, ctls);
-        if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
-        }
-
-        status = syscall::bf_vps_op_write32(handle, vpsid, vmcs_entry_ctls_idx, mask(ctls));
+        status = syscall::bf_intrinsic_op_read_msr(handle, ia32_vmx_true_entry_ctls, entry_ctls);
         if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
@@ -398,23 +362,18 @@ namespace example
         constexpr bsl::safe_uintmax enable_xsave{bsl::to_umax(0x00100000U)};
         constexpr bsl::safe_uintmax enable_uwait{bsl::to_umax(0x04000000U)};
 
-        status = syscall::bf_intrinsic_op_read_msr(handle, ia32_vmx_true_procbased_ctls2, ctls);
+        status = syscall::bf_intrinsic_op_read_msr(
+            handle, ia32_vmx_true_procbased_ctls2, procbased_ctls2);
         if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
         }
 
-        ctls |= enable_vpid;
-        ctls |= enable_rdtscp;
-        ctls |= enable_invpcid;
-        ctls |= enable_xsave;
-        ctls |= enable_uwait;
-
-        status = syscall::bf_vps_op_write32(handle, vpsid, vmcs_procbased_ctls2_idx, mask(ctls));
-        if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
-            bsl::print<bsl::V>() << bsl::here();
-            return bsl::errc_failure;
-        }
+        procbased_ctls2 |= enable_vpid;
+        procbased_ctls2 |= enable_rdtscp;
+        procbased_ctls2 |= enable_invpcid;
+        procbased_ctls2 |= enable_xsave;
+        procbased_ctls2 |= enable_uwait;
 
         /// NOTE:
         /// - Configure the MSR bitmaps. This ensures that we do not trap
@@ -433,7 +392,26 @@ namespace example
             }
         }
 
-        status = syscall::bf_vps_op_write64(handle, vpsid, vmcs_msr_bitmaps, g_msr_bitmaps_phys);
+        /// NOTE:
+        /// - Write all of the fields above to the VPS using a single
+        ///   syscall instead of one syscall per field.
+        ///
+
+        constexpr auto width32{syscall::BF_VPS_FIELD_WIDTH_32.get()};
+        constexpr auto width64{syscall::BF_VPS_FIELD_WIDTH_64.get()};
+
+        constexpr bsl::safe_uintmax num_fields{bsl::to_umax(7)};
+        bsl::array<syscall::bf_vps_field_t, num_fields.get()> const fields{{
+            {vmcs_link_ptr_idx.get(), width64, vmcs_link_ptr_val.get()},
+            {vmcs_pinbased_ctls_idx.get(), width32, mask(pinbased_ctls).get()},
+            {vmcs_procbased_ctls_idx.get(), width32, mask(procbased_ctls).get()},
+            {vmcs_exit_ctls_idx.get(), width32, mask(exit_ctls).get()},
+            {vmcs_entry_ctls_idx.get(), width32, mask(entry_ctls).get()},
+            {vmcs_procbased_ctls2_idx.get(), width32, mask(procbased_ctls2).get()},
+            {vmcs_msr_bitmaps.get(), width64, g_msr_bitmaps_phys.get()},
+        }};
+
+        status = syscall::bf_vps_op_write_batch(handle, vpsid, {fields.data(), fields.size()});
         if (bsl::unlikely(status != syscall::BF_STATUS_SUCCESS)) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::errc_failure;
@@ -44,13 +44,17 @@ namespace mk
     ///   @param sp the stack pointer to use when calling the ext
     ///   @param arg0 the first argument to pass the extension
     ///   @param arg1 the second argument to pass the extension
+    ///   @param ret_ip if not 0, the address pushed onto the extension's
+    ///     stack so that the ext's callback is allowed to return. If 0,
+    ///     the extension's callback must never return.
     ///   @return returns the exit status from the extension
     ///
     extern "C" [[nodiscard]] auto call_ext(
         bsl::uintmax const ip,
         bsl::uintmax const sp,
         bsl::uintmax const arg0,
-        bsl::uintmax const arg1) noexcept -> bsl::exit_code;
+        bsl::uintmax const arg1,
+        bsl::uintmax const ret_ip) noexcept -> bsl::exit_code;
 }
 
 #endif
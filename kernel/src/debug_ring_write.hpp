@@ -29,6 +29,7 @@
 
 #include <bsl/char_type.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
 #include <bsl/cstr_type.hpp>
 #include <bsl/cstring.hpp>
 #include <bsl/is_constant_evaluated.hpp>
@@ -37,11 +38,140 @@
 
 namespace mk
 {
-    /// @brief stores a pointer to the debug ring provided by the loader
-    extern "C" constinit inline loader::debug_ring_t *g_debug_ring{};
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns the current PP's debug ring, or a nullptr if
+        ///     the loader has not provided it yet.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the current PP's debug ring, or a nullptr if
+        ///     the loader has not provided it yet.
+        ///
+        extern "C" [[nodiscard]] auto get_current_debug_ring() noexcept -> loader::debug_ring_t *;
+
+        /// <!-- description -->
+        ///   @brief Returns the current value of the TSC.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the current value of the TSC.
+        ///
+        extern "C" [[nodiscard]] auto intrinsic_rdtsc() noexcept -> bsl::uint64;
+
+        /// <!-- description -->
+        ///   @brief Adds a character to a debug ring, overwriting the oldest
+        ///     character if the debug ring is full.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ring the debug ring to add the character to
+        ///   @param c the character to add
+        ///
+        constexpr void
+        debug_ring_put(loader::debug_ring_t *const ring, bsl::char_type const c) noexcept
+        {
+            bsl::safe_uintmax epos{ring->epos};
+            bsl::safe_uintmax spos{ring->spos};
+
+            if (!(ring->buf.size() > epos)) {
+                epos = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            *ring->buf.at_if(epos) = c;
+            ++epos;
+
+            if (!(ring->buf.size() > epos)) {
+                epos = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (epos == spos) {
+                ++spos;
+
+                if (!(ring->buf.size() > spos)) {
+                    spos = {};
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            ring->epos = epos.get();
+            ring->spos = spos.get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the next character added to a debug
+        ///     ring starts a new line (and therefore a new record).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ring the debug ring to query
+        ///   @return Returns true if the next character added to a debug
+        ///     ring starts a new line (and therefore a new record).
+        ///
+        [[nodiscard]] constexpr auto
+        debug_ring_at_record_start(loader::debug_ring_t const *const ring) noexcept -> bool
+        {
+            bsl::safe_uintmax epos{ring->epos};
+            if (epos == bsl::to_umax(ring->spos)) {
+                return true;
+            }
+
+            if (epos.is_zero() || !(ring->buf.size() > epos)) {
+                epos = ring->buf.size();
+            }
+            else {
+                bsl::touch();
+            }
+
+            --epos;
+            return '\n' == *ring->buf.at_if(epos);
+        }
+
+        /// <!-- description -->
+        ///   @brief Starts a new record in a debug ring by adding the
+        ///     record marker, followed by the current TSC in hex.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ring the debug ring to start the record in
+        ///
+        constexpr void
+        debug_ring_start_record(loader::debug_ring_t *const ring) noexcept
+        {
+            constexpr bsl::cstr_type digits{"0123456789ABCDEF"};
+            constexpr bsl::safe_uintmax bits_per_digit{bsl::to_umax(4)};
+            constexpr bsl::safe_uintmax digit_mask{bsl::to_umax(0xF)};
+
+            bsl::safe_uintmax const tsc{bsl::to_umax(intrinsic_rdtsc())};
+            debug_ring_put(ring, loader::DEBUG_RING_RECORD);
+
+            for (bsl::safe_uintmax i{loader::DEBUG_RING_TSC_DIGITS}; !i.is_zero();) {
+                --i;
+                auto const digit{(tsc >> (i * bits_per_digit)) & digit_mask};
+                debug_ring_put(ring, digits[digit.get()]);
+            }
+        }
+    }
+
+    /// NOTE:
+    /// - Each PP has its own debug ring (provided by the loader and stored
+    ///   in the TLS block), and only that PP ever writes to it. This is
+    ///   why no atomics or locks are needed here, and why PPs that print
+    ///   at the same time do not corrupt each other's output.
+    /// - Each line is stored as a record that starts with the TSC of the
+    ///   PP when the line was started, so that vmmctl can merge the debug
+    ///   rings of all of the PPs in time order (see debug_ring_t).
+    ///
 
     /// <!-- description -->
-    ///   @brief Outputs a character to the serial port.
+    ///   @brief Outputs a character to the current PP's debug ring.
     ///
     /// <!-- inputs/outputs -->
     ///   @param c the character to output
@@ -53,46 +183,23 @@ namespace mk
             return;
         }
 
-        bsl::safe_uintmax epos{g_debug_ring->epos};
-        bsl::safe_uintmax spos{g_debug_ring->spos};
-
-        if (!(g_debug_ring->buf.size() > epos)) {
-            epos = {};
-        }
-        else {
-            bsl::touch();
-        }
-
-        *g_debug_ring->buf.at_if(epos) = c;
-        ++epos;
-
-        if (!(g_debug_ring->buf.size() > epos)) {
-            epos = {};
-        }
-        else {
-            bsl::touch();
+        auto *const ring{details::get_current_debug_ring()};
+        if (nullptr == ring) {
+            return;
         }
 
-        if (epos == spos) {
-            ++spos;
-
-            if (!(g_debug_ring->buf.size() > spos)) {
-                spos = {};
-            }
-            else {
-                bsl::touch();
-            }
+        if (details::debug_ring_at_record_start(ring)) {
+            details::debug_ring_start_record(ring);
         }
         else {
             bsl::touch();
         }
 
-        g_debug_ring->epos = epos.get();
-        g_debug_ring->spos = spos.get();
+        details::debug_ring_put(ring, c);
     }
 
     /// <!-- description -->
-    ///   @brief Outputs a string to the serial port.
+    ///   @brief Outputs a string to the current PP's debug ring.
     ///
     /// <!-- inputs/outputs -->
     ///   @param str the string to output
@@ -51,12 +51,16 @@ namespace mk
     ///   @tparam TLS_CONCEPT defines the type of TLS block to use
     ///   @tparam EXT_CONCEPT defines the type of ext_t to use
     ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
+    ///   @tparam PAGE_POOL_CONCEPT defines the type of page pool to use
+    ///   @tparam HUGE_POOL_CONCEPT defines the type of huge pool to use
     ///   @tparam VM_POOL_CONCEPT defines the type of VM pool to use
     ///   @tparam VP_POOL_CONCEPT defines the type of VP pool to use
     ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
     ///   @param tls the current TLS block
     ///   @param ext the extension that made the syscall
     ///   @param intrinsic the intrinsics to use
+    ///   @param page_pool the page pool to use
+    ///   @param huge_pool the huge pool to use
     ///   @param vm_pool the VM pool to use
     ///   @param vp_pool the VP pool to use
     ///   @param vps_pool the VPS pool to use
@@ -68,6 +72,8 @@ namespace mk
         typename TLS_CONCEPT,
         typename EXT_CONCEPT,
         typename INTRINSIC_CONCEPT,
+        typename PAGE_POOL_CONCEPT,
+        typename HUGE_POOL_CONCEPT,
         typename VM_POOL_CONCEPT,
         typename VP_POOL_CONCEPT,
         typename VPS_POOL_CONCEPT>
@@ -76,6 +82,8 @@ namespace mk
         TLS_CONCEPT &tls,
         EXT_CONCEPT &ext,
         INTRINSIC_CONCEPT &intrinsic,
+        PAGE_POOL_CONCEPT &page_pool,
+        HUGE_POOL_CONCEPT &huge_pool,
         VM_POOL_CONCEPT &vm_pool,
         VP_POOL_CONCEPT &vp_pool,
         VPS_POOL_CONCEPT &vps_pool) noexcept -> syscall::bf_status_t
@@ -104,8 +112,8 @@ namespace mk
             }
 
             case syscall::BF_DEBUG_OP_VAL.get(): {
-                ret =
-                    dispatch_syscall_debug_op<SMAP_GUARD_CONCEPT>(tls, vm_pool, vp_pool, vps_pool);
+                ret = dispatch_syscall_debug_op<SMAP_GUARD_CONCEPT>(
+                    tls, page_pool, vm_pool, vp_pool, vps_pool);
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
@@ -115,7 +123,7 @@ namespace mk
             }
 
             case syscall::BF_CALLBACK_OP_VAL.get(): {
-                ret = dispatch_syscall_callback_op(tls, ext);
+                ret = dispatch_syscall_callback_op<SMAP_GUARD_CONCEPT>(tls, ext, page_pool);
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
@@ -145,7 +153,7 @@ namespace mk
             }
 
             case syscall::BF_VPS_OP_VAL.get(): {
-                ret = dispatch_syscall_vps_op(tls, ext, vps_pool);
+                ret = dispatch_syscall_vps_op<SMAP_GUARD_CONCEPT>(tls, ext, vps_pool);
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
@@ -165,7 +173,7 @@ namespace mk
             }
 
             case syscall::BF_MEM_OP_VAL.get(): {
-                ret = dispatch_syscall_mem_op(tls, ext);
+                ret = dispatch_syscall_mem_op(tls, ext, huge_pool);
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
@@ -30,6 +30,7 @@
 
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
 #include <bsl/likely.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/touch.hpp>
@@ -39,6 +40,9 @@ namespace mk
 {
     namespace details
     {
+        /// @brief defines the max number of pages zeroed by each bf_callback_op_wait
+        constexpr bsl::safe_uintmax CALLBACK_OP_WAIT_SCRUB_PAGES{bsl::to_umax(0x20U)};
+
         /// <!-- description -->
         ///   @brief Implements the bf_callback_op_register_bootstrap syscall
         ///
@@ -115,6 +119,7 @@ namespace mk
             }
 
             ext.set_vmexit_ip(tls.ext_reg1);
+            ext.set_vmexit_ret_ip(tls.ext_reg2);
             return syscall::BF_STATUS_SUCCESS;
         }
 
@@ -158,27 +163,100 @@ namespace mk
             ext.set_fail_ip(tls.ext_reg1);
             return syscall::BF_STATUS_SUCCESS;
         }
+
+        /// <!-- description -->
+        ///   @brief Implements the bf_callback_op_register_fast_path syscall
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam SMAP_GUARD_CONCEPT defines the type of smap guard to use
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+        ///   @param tls the current TLS block
+        ///   @param ext the extension that made the syscall
+        ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
+        ///     code on failure.
+        ///
+        template<typename SMAP_GUARD_CONCEPT, typename TLS_CONCEPT, typename EXT_CONCEPT>
+        [[nodiscard]] constexpr auto
+        syscall_callback_op_register_fast_path(TLS_CONCEPT &tls, EXT_CONCEPT &ext)
+            -> syscall::bf_status_t
+        {
+            if (bsl::unlikely(!ext.is_handle_valid(tls.ext_reg0))) {
+                bsl::error() << "invalid handle: "        // --
+                             << bsl::hex(tls.ext_reg0)    // --
+                             << bsl::endl                 // --
+                             << bsl::here();              // --
+
+                return syscall::BF_STATUS_FAILURE_INVALID_HANDLE;
+            }
+
+            if (bsl::unlikely(bsl::ZERO_UMAX == tls.ext_reg1)) {
+                bsl::error() << "the fast path table is a nullptr\n" << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            /// NOTE:
+            /// - The table is larger than most of the structures that are
+            ///   passed to the microkernel and can span two pages, so it
+            ///   is copied in using copy_from_user(), which checks every
+            ///   page it covers before SMAP is unlocked.
+            ///
+
+            syscall::bf_fast_path_t table{};
+            auto const ret{ext.template copy_from_user<SMAP_GUARD_CONCEPT>(
+                &table, tls.ext_reg1, bsl::to_umax(sizeof(table)))};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            if (bsl::unlikely(!ext.set_fast_path(table))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            return syscall::BF_STATUS_SUCCESS;
+        }
     }
 
     /// <!-- description -->
     ///   @brief Dispatches the bf_callback_op syscalls
     ///
     /// <!-- inputs/outputs -->
+    ///   @tparam SMAP_GUARD_CONCEPT defines the type of smap guard to use
     ///   @tparam TLS_CONCEPT defines the type of TLS block to use
     ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+    ///   @tparam PAGE_POOL_CONCEPT defines the type of page pool to use
     ///   @param tls the current TLS block
     ///   @param ext the extension that made the syscall
+    ///   @param page_pool the page pool to use
     ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
     ///     code on failure.
     ///
-    template<typename TLS_CONCEPT, typename EXT_CONCEPT>
+    template<
+        typename SMAP_GUARD_CONCEPT,
+        typename TLS_CONCEPT,
+        typename EXT_CONCEPT,
+        typename PAGE_POOL_CONCEPT>
     [[nodiscard]] constexpr auto
-    dispatch_syscall_callback_op(TLS_CONCEPT &tls, EXT_CONCEPT &ext) -> syscall::bf_status_t
+    dispatch_syscall_callback_op(
+        TLS_CONCEPT &tls, EXT_CONCEPT &ext, PAGE_POOL_CONCEPT &page_pool) -> syscall::bf_status_t
     {
         syscall::bf_status_t ret{};
 
         switch (syscall::bf_syscall_index(tls.ext_syscall).get()) {
             case syscall::BF_CALLBACK_OP_WAIT_IDX_VAL.get(): {
+                /// NOTE:
+                /// - This PP has nothing left to do until it is given a
+                ///   callback, so this is where the dirty pages that were
+                ///   returned while the extensions were initializing get
+                ///   zeroed, keeping that work off of the allocate() path.
+                /// - Only a small batch is zeroed per call, as every page
+                ///   takes the page pool's lock twice, and every PP makes
+                ///   this call at the same time.
+                ///
+
+                bsl::discard(page_pool.scrub(details::CALLBACK_OP_WAIT_SCRUB_PAGES));
                 return_to_mk(bsl::ZERO_UMAX.get());
                 return syscall::BF_STATUS_SUCCESS;
             }
@@ -213,6 +291,32 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL.get(): {
+                ret = details::syscall_callback_op_register_fast_path<SMAP_GUARD_CONCEPT>(tls, ext);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_CALLBACK_OP_VMEXIT_RETURN_IDX_VAL.get(): {
+                /// NOTE:
+                /// - A valid bf_callback_op_vmexit_return never gets here, as
+                ///   dispatch_syscall_entry handles it. This is only reached
+                ///   if the handle is wrong, or if the VMExit handler is not
+                ///   running, in which case the syscall is rejected.
+                ///
+
+                bsl::error() << "bf_callback_op_vmexit_return not allowed from ext ["    // --
+                             << bsl::hex(ext.id())                                       // --
+                             << "]\n"                                                    // --
+                             << bsl::here();                                             // --
+
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
             default: {
                 bsl::error() << "unknown syscall index: "    //--
                              << bsl::hex(tls.ext_syscall)    //--
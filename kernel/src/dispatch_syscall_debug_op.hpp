@@ -26,6 +26,7 @@
 #define DISPATCH_SYSCALL_DEBUG_OP_HPP
 
 #include <mk_interface.hpp>
+#include <vmexit_log.hpp>
 
 #include <bsl/char_type.hpp>
 #include <bsl/cstr_type.hpp>
@@ -68,10 +69,12 @@ namespace mk
     /// <!-- inputs/outputs -->
     ///   @tparam SMAP_GUARD_CONCEPT defines the type of smap guard to use
     ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @tparam PAGE_POOL_CONCEPT defines the type of page pool to use
     ///   @tparam VM_POOL_CONCEPT defines the type of VM pool to use
     ///   @tparam VP_POOL_CONCEPT defines the type of VP pool to use
     ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
     ///   @param tls the current TLS block
+    ///   @param page_pool the page pool to use
     ///   @param vm_pool the VM pool to use
     ///   @param vp_pool the VP pool to use
     ///   @param vps_pool the VPS pool to use
@@ -81,12 +84,14 @@ namespace mk
     template<
         typename SMAP_GUARD_CONCEPT,
         typename TLS_CONCEPT,
+        typename PAGE_POOL_CONCEPT,
         typename VM_POOL_CONCEPT,
         typename VP_POOL_CONCEPT,
         typename VPS_POOL_CONCEPT>
     [[nodiscard]] constexpr auto
     dispatch_syscall_debug_op(
         TLS_CONCEPT &tls,
+        PAGE_POOL_CONCEPT &page_pool,
         VM_POOL_CONCEPT &vm_pool,
         VP_POOL_CONCEPT &vp_pool,
         VPS_POOL_CONCEPT &vps_pool) noexcept -> syscall::bf_status_t
@@ -126,8 +131,13 @@ namespace mk
             }
 
             case syscall::BF_DEBUG_OP_DUMP_VMEXIT_LOG_IDX_VAL.get(): {
-                bsl::error() << "bf_debug_op_dump_vmexit_log unsupported\n" << bsl::here();
-                return syscall::BF_STATUS_FAILURE_UNSUPPORTED;
+                vmexit_log_dump(tls, bsl::to_u16_unsafe(tls.ext_reg0));
+                return syscall::BF_STATUS_SUCCESS;
+            }
+
+            case syscall::BF_DEBUG_OP_DUMP_PAGE_POOL_IDX_VAL.get(): {
+                page_pool.dump();
+                return syscall::BF_STATUS_SUCCESS;
             }
 
             case syscall::BF_DEBUG_OP_WRITE_C_IDX_VAL.get(): {
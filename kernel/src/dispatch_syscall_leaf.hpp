@@ -0,0 +1,218 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef DISPATCH_SYSCALL_LEAF_HPP
+#define DISPATCH_SYSCALL_LEAF_HPP
+
+#include <dispatch_syscall_mem_op.hpp>
+#include <dispatch_syscall_vps_op.hpp>
+#include <mk_interface.hpp>
+
+#include <bsl/debug.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Provides the entry point for syscalls made with the
+    ///     BF_SYSCALL_FLAG_LEAF flag. Leaf syscalls are short syscalls that
+    ///     only use REG0-REG3 and never leave the microkernel through
+    ///     anything other than a return (i.e., they cannot run a VPS or
+    ///     call back into an extension). This allows the syscall entry
+    ///     point to skip saving the extension's callee-preserved registers,
+    ///     which this function and the functions it calls preserve per the
+    ///     ABI. Unlike dispatch_syscall, the signature, opcode and index are
+    ///     dispatched using a single switch statement.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+    ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+    ///   @param tls the current TLS block
+    ///   @param ext the extension that made the syscall
+    ///   @param vps_pool the VPS pool to use
+    ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
+    ///     code on failure.
+    ///
+    template<typename TLS_CONCEPT, typename EXT_CONCEPT, typename VPS_POOL_CONCEPT>
+    [[nodiscard]] constexpr auto
+    dispatch_syscall_leaf(TLS_CONCEPT &tls, EXT_CONCEPT &ext, VPS_POOL_CONCEPT &vps_pool) noexcept
+        -> syscall::bf_status_t
+    {
+        syscall::bf_status_t ret{};
+
+        if (bsl::unlikely(!ext.is_handle_valid(tls.ext_reg0))) {
+            bsl::error() << "invalid handle: "        // --
+                         << bsl::hex(tls.ext_reg0)    // --
+                         << bsl::endl                 // --
+                         << bsl::here();              // --
+
+            return syscall::BF_STATUS_FAILURE_INVALID_HANDLE;
+        }
+
+        auto const is_vps_op{syscall::BF_VPS_OP_VAL == syscall::bf_syscall_opcode(tls.ext_syscall)};
+        if (bsl::unlikely(is_vps_op && (tls.ext != tls.ext_vmexit))) {
+            bsl::error() << "vps_ops not allowed by ext "           // --
+                         << bsl::hex(ext.id())                      // --
+                         << " as it didn't register for vmexits"    // --
+                         << bsl::endl                               // --
+                         << bsl::here();                            // --
+
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        switch (syscall::bf_syscall_noflags(tls.ext_syscall).get()) {
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_READ8_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_read8(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_READ16_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_read16(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_READ32_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_read32(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_READ64_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_read64(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_WRITE8_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_write8(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_WRITE16_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_write16(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_WRITE32_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_write32(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_WRITE64_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_write64(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_READ_REG_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_read_reg(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_WRITE_REG_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_write_reg(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_VPS_OP_VAL | syscall::BF_VPS_OP_ADVANCE_IP_IDX_VAL).get(): {
+                ret = details::syscall_vps_op_advance_ip(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case (syscall::BF_MEM_OP_VAL | syscall::BF_MEM_OP_VIRT_TO_PHYS_IDX_VAL).get(): {
+                ret = details::syscall_mem_op_virt_to_phys(tls, ext);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            default: {
+                bsl::error() << "unsupported leaf syscall: "    //--
+                             << bsl::hex(tls.ext_syscall)       //--
+                             << bsl::endl                       //--
+                             << bsl::here();                    //--
+
+                return syscall::BF_STATUS_FAILURE_UNSUPPORTED;
+            }
+        }
+    }
+}
+
+#endif
@@ -51,7 +51,7 @@ namespace mk
         [[nodiscard]] constexpr auto
         syscall_mem_op_alloc_page(TLS_CONCEPT &tls, EXT_CONCEPT &ext) -> syscall::bf_status_t
         {
-            auto const page{ext.alloc_page()};
+            auto const page{ext.alloc_page(tls)};
             if (bsl::unlikely(!page.virt)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return syscall::BF_STATUS_FAILURE_UNKNOWN;
@@ -62,6 +62,113 @@ namespace mk
             return syscall::BF_STATUS_SUCCESS;
         }
 
+        /// <!-- description -->
+        ///   @brief Implements the bf_mem_op_free_page syscall
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+        ///   @param tls the current TLS block
+        ///   @param ext the extension that made the syscall
+        ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
+        ///     code on failure.
+        ///
+        template<typename TLS_CONCEPT, typename EXT_CONCEPT>
+        [[nodiscard]] constexpr auto
+        syscall_mem_op_free_page(TLS_CONCEPT &tls, EXT_CONCEPT &ext) -> syscall::bf_status_t
+        {
+            auto const ret{ext.free_page(tls, tls.ext_reg1)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            return syscall::BF_STATUS_SUCCESS;
+        }
+
+        /// <!-- description -->
+        ///   @brief Implements the bf_mem_op_alloc_huge syscall
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+        ///   @tparam HUGE_POOL_CONCEPT defines the type of huge pool to use
+        ///   @param tls the current TLS block
+        ///   @param ext the extension that made the syscall
+        ///   @param huge_pool the huge pool to use
+        ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
+        ///     code on failure.
+        ///
+        template<typename TLS_CONCEPT, typename EXT_CONCEPT, typename HUGE_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        syscall_mem_op_alloc_huge(
+            TLS_CONCEPT &tls, EXT_CONCEPT &ext, HUGE_POOL_CONCEPT &huge_pool)
+            -> syscall::bf_status_t
+        {
+            auto const page{ext.alloc_huge(tls, huge_pool, tls.ext_reg1)};
+            if (bsl::unlikely(!page.virt)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            tls.ext_reg0 = page.virt.get();
+            tls.ext_reg1 = page.phys.get();
+            return syscall::BF_STATUS_SUCCESS;
+        }
+
+        /// <!-- description -->
+        ///   @brief Implements the bf_mem_op_free_huge syscall
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+        ///   @tparam HUGE_POOL_CONCEPT defines the type of huge pool to use
+        ///   @param tls the current TLS block
+        ///   @param ext the extension that made the syscall
+        ///   @param huge_pool the huge pool to use
+        ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
+        ///     code on failure.
+        ///
+        template<typename TLS_CONCEPT, typename EXT_CONCEPT, typename HUGE_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        syscall_mem_op_free_huge(
+            TLS_CONCEPT &tls, EXT_CONCEPT &ext, HUGE_POOL_CONCEPT &huge_pool)
+            -> syscall::bf_status_t
+        {
+            auto const ret{ext.free_huge(tls, huge_pool, tls.ext_reg1)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            return syscall::BF_STATUS_SUCCESS;
+        }
+
+        /// <!-- description -->
+        ///   @brief Implements the bf_mem_op_alloc_heap syscall
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+        ///   @param tls the current TLS block
+        ///   @param ext the extension that made the syscall
+        ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
+        ///     code on failure.
+        ///
+        template<typename TLS_CONCEPT, typename EXT_CONCEPT>
+        [[nodiscard]] constexpr auto
+        syscall_mem_op_alloc_heap(TLS_CONCEPT &tls, EXT_CONCEPT &ext) -> syscall::bf_status_t
+        {
+            auto const virt{ext.alloc_heap(tls, tls.ext_reg1)};
+            if (bsl::unlikely(!virt)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            tls.ext_reg0 = virt.get();
+            return syscall::BF_STATUS_SUCCESS;
+        }
+
         /// <!-- description -->
         ///   @brief Implements the bf_mem_op_virt_to_phys syscall
         ///
@@ -94,14 +201,17 @@ namespace mk
     /// <!-- inputs/outputs -->
     ///   @tparam TLS_CONCEPT defines the type of TLS block to use
     ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+    ///   @tparam HUGE_POOL_CONCEPT defines the type of huge pool to use
     ///   @param tls the current TLS block
     ///   @param ext the extension that made the syscall
+    ///   @param huge_pool the huge pool to use
     ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
     ///     code on failure.
     ///
-    template<typename TLS_CONCEPT, typename EXT_CONCEPT>
+    template<typename TLS_CONCEPT, typename EXT_CONCEPT, typename HUGE_POOL_CONCEPT>
     [[nodiscard]] constexpr auto
-    dispatch_syscall_mem_op(TLS_CONCEPT &tls, EXT_CONCEPT &ext) -> syscall::bf_status_t
+    dispatch_syscall_mem_op(TLS_CONCEPT &tls, EXT_CONCEPT &ext, HUGE_POOL_CONCEPT &huge_pool)
+        -> syscall::bf_status_t
     {
         syscall::bf_status_t ret{};
 
@@ -125,6 +235,46 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_MEM_OP_FREE_PAGE_IDX_VAL.get(): {
+                ret = details::syscall_mem_op_free_page(tls, ext);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_MEM_OP_ALLOC_HUGE_IDX_VAL.get(): {
+                ret = details::syscall_mem_op_alloc_huge(tls, ext, huge_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_MEM_OP_FREE_HUGE_IDX_VAL.get(): {
+                ret = details::syscall_mem_op_free_huge(tls, ext, huge_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_MEM_OP_ALLOC_HEAP_IDX_VAL.get(): {
+                ret = details::syscall_mem_op_alloc_heap(tls, ext);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             case syscall::BF_MEM_OP_VIRT_TO_PHYS_IDX_VAL.get(): {
                 ret = details::syscall_mem_op_virt_to_phys(tls, ext);
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
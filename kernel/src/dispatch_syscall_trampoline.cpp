@@ -23,9 +23,11 @@
 /// SOFTWARE.
 
 #include <dispatch_syscall.hpp>
+#include <dispatch_syscall_leaf.hpp>
 #include <global_resources.hpp>
 #include <mk_interface.hpp>
 #include <smap_guard_t.hpp>
+#include <syscall_trace.hpp>
 #include <tls_t.hpp>
 
 namespace mk
@@ -49,8 +51,34 @@ namespace mk
     dispatch_syscall_trampoline(tls_t *const tls) noexcept -> syscall::bf_status_t::value_type
     {
         auto *const ext{static_cast<mk_ext_type *>(tls->ext)};
-        return dispatch_syscall<smap_guard_t>(
-                   *tls, *ext, g_intrinsic, g_vm_pool, g_vp_pool, g_vps_pool)
-            .get();
+        syscall_trace_begin(*tls, *ext);
+
+        auto const ret{dispatch_syscall<smap_guard_t>(
+            *tls, *ext, g_intrinsic, g_page_pool, g_huge_pool, g_vm_pool, g_vp_pool, g_vps_pool)};
+
+        syscall_trace_end<intrinsic_t>(*tls);
+        return ret.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Same as dispatch_syscall_trampoline, but for syscalls made
+    ///     with the BF_SYSCALL_FLAG_LEAF flag.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
+    ///     code on failure.
+    ///
+    [[nodiscard]] extern "C" auto
+    dispatch_syscall_leaf_trampoline(tls_t *const tls) noexcept
+        -> syscall::bf_status_t::value_type
+    {
+        auto *const ext{static_cast<mk_ext_type *>(tls->ext)};
+        syscall_trace_begin(*tls, *ext);
+
+        auto const ret{dispatch_syscall_leaf(*tls, *ext, g_vps_pool)};
+
+        syscall_trace_end<intrinsic_t>(*tls);
+        return ret.get();
     }
 }
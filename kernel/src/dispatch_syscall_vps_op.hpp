@@ -28,9 +28,12 @@
 #include <mk_interface.hpp>
 #include <promote.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
@@ -515,12 +518,196 @@ namespace mk
             promote(tls.root_vp_state);
             return syscall::BF_STATUS_SUCCESS;
         }
+
+        /// <!-- description -->
+        ///   @brief Validates the array of fields provided to the
+        ///     bf_vps_op_read_batch and bf_vps_op_write_batch syscalls and
+        ///     returns the number of fields in the array.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @return Returns the number of fields provided by the extension
+        ///     or bsl::safe_uintmax::zero(true) if the array is invalid.
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        syscall_vps_op_batch_size(TLS_CONCEPT &tls) -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax const num{tls.ext_reg3};
+
+            if (bsl::unlikely(bsl::ZERO_UMAX == tls.ext_reg2)) {
+                bsl::error() << "the fields array is a nullptr\n" << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            if (bsl::unlikely(num.is_zero())) {
+                bsl::error() << "the number of fields cannot be 0\n" << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            if (bsl::unlikely(num > syscall::BF_VPS_BATCH_MAX_FIELDS)) {
+                bsl::error() << "the number of fields "                       // --
+                             << bsl::hex(num)                                 // --
+                             << " is larger than the max supported "          // --
+                             << bsl::hex(syscall::BF_VPS_BATCH_MAX_FIELDS)    // --
+                             << bsl::endl                                     // --
+                             << bsl::here();                                  // --
+
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            return num;
+        }
+
+        /// <!-- description -->
+        ///   @brief Implements the bf_vps_op_read_batch syscall
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam SMAP_GUARD_CONCEPT defines the type of smap guard to use
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+        ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+        ///   @param tls the current TLS block
+        ///   @param ext the extension that made the syscall
+        ///   @param vps_pool the VPS pool to use
+        ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
+        ///     code on failure.
+        ///
+        template<
+            typename SMAP_GUARD_CONCEPT,
+            typename TLS_CONCEPT,
+            typename EXT_CONCEPT,
+            typename VPS_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        syscall_vps_op_read_batch(TLS_CONCEPT &tls, EXT_CONCEPT &ext, VPS_POOL_CONCEPT &vps_pool)
+            -> syscall::bf_status_t
+        {
+            auto const num{syscall_vps_op_batch_size(tls)};
+            if (bsl::unlikely(!num)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            /// NOTE:
+            /// - The fields are copied in and back out instead of being
+            ///   accessed in place so that the extension cannot unmap them
+            ///   (from another PP) while the microkernel is using them.
+            ///
+
+            bsl::array<syscall::bf_vps_field_t, syscall::BF_VPS_BATCH_MAX_FIELDS.get()> buf{};
+            auto const bytes{num * bsl::to_umax(sizeof(syscall::bf_vps_field_t))};
+
+            bsl::errc_type ret{};
+            ret = ext.template copy_from_user<SMAP_GUARD_CONCEPT>(buf.data(), tls.ext_reg2, bytes);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            bsl::span<syscall::bf_vps_field_t> const fields{buf.data(), num};
+            auto const read{vps_pool.read_batch(tls, bsl::to_u16_unsafe(tls.ext_reg1), fields)};
+
+            /// NOTE:
+            /// - The fields that were read before a failure are still
+            ///   returned to the extension.
+            ///
+
+            ret = ext.template copy_to_user<SMAP_GUARD_CONCEPT>(tls.ext_reg2, buf.data(), bytes);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            if (bsl::unlikely(!read)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            return syscall::BF_STATUS_SUCCESS;
+        }
+
+        /// <!-- description -->
+        ///   @brief Implements the bf_vps_op_write_batch syscall
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam SMAP_GUARD_CONCEPT defines the type of smap guard to use
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+        ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+        ///   @param tls the current TLS block
+        ///   @param ext the extension that made the syscall
+        ///   @param vps_pool the VPS pool to use
+        ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
+        ///     code on failure.
+        ///
+        template<
+            typename SMAP_GUARD_CONCEPT,
+            typename TLS_CONCEPT,
+            typename EXT_CONCEPT,
+            typename VPS_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        syscall_vps_op_write_batch(TLS_CONCEPT &tls, EXT_CONCEPT &ext, VPS_POOL_CONCEPT &vps_pool)
+            -> syscall::bf_status_t
+        {
+            auto const num{syscall_vps_op_batch_size(tls)};
+            if (bsl::unlikely(!num)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            bsl::array<syscall::bf_vps_field_t, syscall::BF_VPS_BATCH_MAX_FIELDS.get()> buf{};
+            auto const bytes{num * bsl::to_umax(sizeof(syscall::bf_vps_field_t))};
+
+            bsl::errc_type ret{};
+            ret = ext.template copy_from_user<SMAP_GUARD_CONCEPT>(buf.data(), tls.ext_reg2, bytes);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            bsl::span<syscall::bf_vps_field_t const> const fields{buf.data(), num};
+
+            ret = vps_pool.write_batch(tls, bsl::to_u16_unsafe(tls.ext_reg1), fields);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            return syscall::BF_STATUS_SUCCESS;
+        }
+
+        /// <!-- description -->
+        ///   @brief Implements the bf_vps_op_flush_tlb syscall
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+        ///   @param tls the current TLS block
+        ///   @param vps_pool the VPS pool to use
+        ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
+        ///     code on failure.
+        ///
+        template<typename TLS_CONCEPT, typename VPS_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        syscall_vps_op_flush_tlb(TLS_CONCEPT &tls, VPS_POOL_CONCEPT &vps_pool)
+            -> syscall::bf_status_t
+        {
+            auto const ret{vps_pool.flush_tlb(tls, bsl::to_u16_unsafe(tls.ext_reg1))};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            return syscall::BF_STATUS_SUCCESS;
+        }
     }
 
     /// <!-- description -->
     ///   @brief Dispatches the bf_vps_op syscalls
     ///
     /// <!-- inputs/outputs -->
+    ///   @tparam SMAP_GUARD_CONCEPT defines the type of smap guard to use
     ///   @tparam TLS_CONCEPT defines the type of TLS block to use
     ///   @tparam EXT_CONCEPT defines the type of ext_t to use
     ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
@@ -530,9 +717,13 @@ namespace mk
     ///   @return Returns syscall::BF_STATUS_SUCCESS on success or an error
     ///     code on failure.
     ///
-    template<typename TLS_CONCEPT, typename EXT_CONCEPT, typename VPS_POOL_CONCEPT>
+    template<
+        typename SMAP_GUARD_CONCEPT,
+        typename TLS_CONCEPT,
+        typename EXT_CONCEPT,
+        typename VPS_POOL_CONCEPT>
     [[nodiscard]] constexpr auto
-    dispatch_syscall_vps_op(TLS_CONCEPT &tls, EXT_CONCEPT const &ext, VPS_POOL_CONCEPT &vps_pool)
+    dispatch_syscall_vps_op(TLS_CONCEPT &tls, EXT_CONCEPT &ext, VPS_POOL_CONCEPT &vps_pool)
         -> syscall::bf_status_t
     {
         syscall::bf_status_t ret{};
@@ -737,6 +928,36 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_VPS_OP_READ_BATCH_IDX_VAL.get(): {
+                ret = details::syscall_vps_op_read_batch<SMAP_GUARD_CONCEPT>(tls, ext, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_VPS_OP_WRITE_BATCH_IDX_VAL.get(): {
+                ret = details::syscall_vps_op_write_batch<SMAP_GUARD_CONCEPT>(tls, ext, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_VPS_OP_FLUSH_TLB_IDX_VAL.get(): {
+                ret = details::syscall_vps_op_flush_tlb(tls, vps_pool);
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 bsl::error() << "unknown syscall index: "    //--
                              << bsl::hex(tls.ext_syscall)    //--
@@ -45,6 +45,7 @@ namespace mk
     ///   @tparam EXT_CONCEPT the type of ext_t that this class manages.
     ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
     ///   @tparam PAGE_POOL_CONCEPT defines the type of page pool to use
+    ///   @tparam SLAB_POOL_CONCEPT defines the type of slab pool to use
     ///   @tparam ROOT_PAGE_TABLE_CONCEPT defines the type of RPT pool to use
     ///   @tparam MAX_EXTENSIONS the max number of extensions supported
     ///
@@ -52,6 +53,7 @@ namespace mk
         typename EXT_CONCEPT,
         typename INTRINSIC_CONCEPT,
         typename PAGE_POOL_CONCEPT,
+        typename SLAB_POOL_CONCEPT,
         typename ROOT_PAGE_TABLE_CONCEPT,
         bsl::uintmax MAX_EXTENSIONS>
     class ext_pool_t final
@@ -60,6 +62,8 @@ namespace mk
         INTRINSIC_CONCEPT &m_intrinsic;
         /// @brief stores a reference to the page pool to use
         PAGE_POOL_CONCEPT &m_page_pool;
+        /// @brief stores a reference to the slab pool to use
+        SLAB_POOL_CONCEPT &m_slab_pool;
         /// @brief stores system RPT provided by the loader
         ROOT_PAGE_TABLE_CONCEPT &m_system_rpt;
         /// @brief stores all of the extensions.
@@ -72,6 +76,8 @@ namespace mk
         using intrinsic_type = INTRINSIC_CONCEPT;
         /// @brief an alias for PAGE_POOL_CONCEPT
         using page_pool_type = PAGE_POOL_CONCEPT;
+        /// @brief an alias for SLAB_POOL_CONCEPT
+        using slab_pool_type = SLAB_POOL_CONCEPT;
         /// @brief an alias for ROOT_PAGE_TABLE_CONCEPT
         using root_page_table_type = ROOT_PAGE_TABLE_CONCEPT;
 
@@ -81,30 +87,40 @@ namespace mk
         /// <!-- inputs/outputs -->
         ///   @param intrinsic the intrinsics to use
         ///   @param page_pool the page pool to use
+        ///   @param slab_pool the slab pool to use
         ///   @param system_rpt the system RPT provided by the loader
         ///
         explicit constexpr ext_pool_t(
             INTRINSIC_CONCEPT &intrinsic,
             PAGE_POOL_CONCEPT &page_pool,
+            SLAB_POOL_CONCEPT &slab_pool,
             ROOT_PAGE_TABLE_CONCEPT &system_rpt) noexcept
-            : m_intrinsic{intrinsic}, m_page_pool{page_pool}, m_system_rpt{system_rpt}, m_ext_pool{}
+            : m_intrinsic{intrinsic}
+            , m_page_pool{page_pool}
+            , m_slab_pool{slab_pool}
+            , m_system_rpt{system_rpt}
+            , m_ext_pool{}
         {}
 
         /// <!-- description -->
         ///   @brief Initializes this ext_pool_t
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
         ///   @tparam EXT_ELF_FILES_CONCEPT the type of array containing the
         ///     ext_elf_files provided by the loader
+        ///   @param tls the current TLS block
         ///   @param ext_elf_files the ext_elf_files provided by the loader
         ///   @param online_pps the total number of PPs that are online
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
-        template<typename EXT_ELF_FILES_CONCEPT>
+        template<typename TLS_CONCEPT, typename EXT_ELF_FILES_CONCEPT>
         [[nodiscard]] constexpr auto
-        initialize(EXT_ELF_FILES_CONCEPT const &ext_elf_files, bsl::safe_uint16 const &online_pps)
-            &noexcept -> bsl::errc_type
+        initialize(
+            TLS_CONCEPT &tls,
+            EXT_ELF_FILES_CONCEPT const &ext_elf_files,
+            bsl::safe_uint16 const &online_pps) &noexcept -> bsl::errc_type
         {
             bsl::errc_type ret{};
 
@@ -113,8 +129,8 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            bsl::finally release_on_error{[this]() noexcept -> void {
-                this->release();
+            bsl::finally release_on_error{[this, &tls]() noexcept -> void {
+                this->release(tls);
             }};
 
             for (auto const ext : m_ext_pool) {
@@ -123,8 +139,10 @@ namespace mk
                 }
 
                 ret = ext.data->initialize(
+                    tls,
                     &m_intrinsic,
                     &m_page_pool,
+                    &m_slab_pool,
                     bsl::to_u16(ext.index),
                     *ext_elf_files.at_if(ext.index),
                     online_pps,
@@ -145,11 +163,16 @@ namespace mk
         /// <!-- description -->
         ///   @brief Release the ext_pool_t
         ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_CONCEPT>
         constexpr void
-        release() &noexcept
+        release(TLS_CONCEPT &tls) &noexcept
         {
             for (auto const ext : m_ext_pool) {
-                ext.data->release();
+                ext.data->release(tls);
             }
         }
 
@@ -28,12 +28,19 @@
 #include <call_ext.hpp>
 #include <elf64_ehdr_t.hpp>
 #include <elf64_phdr_t.hpp>
+#include <fast_path_t.hpp>
+#include <lock_guard_t.hpp>
 #include <mk_interface.hpp>
+#include <page_pool_stats_t.hpp>
 #include <page_t.hpp>
 #include <smap_guard_t.hpp>
+#include <spinlock_t.hpp>
 
+#include <bsl/array.hpp>
+#include <bsl/discard.hpp>
 #include <bsl/finally.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
@@ -41,6 +48,69 @@ namespace mk
     /// @brief defines the value of an invalid EXTID
     constexpr bsl::safe_uint16 INVALID_EXTID{bsl::to_u16(0xFFFFU)};
 
+    namespace details
+    {
+        /// @brief defines the number of virtual addresses stored in an ext_free_va_t
+        constexpr bsl::safe_uintmax EXT_FREE_VA_ENTRIES{bsl::to_umax(250U)};
+
+        /// @struct mk::details::ext_free_va_t
+        ///
+        /// <!-- description -->
+        ///   @brief Stores a batch of virtual addresses that an extension
+        ///     has freed so that they can be handed out again. Each batch
+        ///     is sized to fit the slab pool's largest size class (two
+        ///     batches per page), and batches are linked together to form
+        ///     a stack.
+        ///
+        struct ext_free_va_t final
+        {
+            /// @brief stores the next batch of free virtual addresses
+            ext_free_va_t *next;
+            /// @brief stores the number of entries used in this batch
+            bsl::uintmax count;
+            /// @brief stores the free virtual addresses
+            bsl::array<bsl::uintmax, EXT_FREE_VA_ENTRIES.get()> entries;
+        };
+
+        /// @brief defines the number of entries stored in an ext_quarantine_t
+        constexpr bsl::safe_uintmax EXT_QUARANTINE_ENTRIES{bsl::to_umax(62U)};
+
+        /// @struct mk::details::ext_quarantine_entry_t
+        ///
+        /// <!-- description -->
+        ///   @brief Stores memory that an extension has unmapped but that
+        ///     another PP might still have in its TLB.
+        ///
+        struct ext_quarantine_entry_t final
+        {
+            /// @brief stores the virtual address to recycle (0 if none)
+            bsl::uintmax virt;
+            /// @brief stores the physical address of the memory
+            bsl::uintmax phys;
+            /// @brief stores the number of bytes that were unmapped
+            bsl::uintmax bytes;
+            /// @brief stores the TLB epoch the memory was unmapped in
+            bsl::uintmax epoch;
+        };
+
+        /// @struct mk::details::ext_quarantine_t
+        ///
+        /// <!-- description -->
+        ///   @brief Stores a batch of quarantined memory. Like the
+        ///     ext_free_va_t, each batch is allocated from the slab pool,
+        ///     and batches are linked together.
+        ///
+        struct ext_quarantine_t final
+        {
+            /// @brief stores the next batch of quarantined memory
+            ext_quarantine_t *next;
+            /// @brief stores the number of entries used in this batch
+            bsl::uintmax count;
+            /// @brief stores the quarantined memory
+            bsl::array<ext_quarantine_entry_t, EXT_QUARANTINE_ENTRIES.get()> entries;
+        };
+    }
+
     /// @class mk::ext_t
     ///
     /// <!-- description -->
@@ -49,6 +119,7 @@ namespace mk
     /// <!-- template parameters -->
     ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
     ///   @tparam PAGE_POOL_CONCEPT defines the type of page pool to use
+    ///   @tparam SLAB_POOL_CONCEPT defines the type of slab pool to use
     ///   @tparam ROOT_PAGE_TABLE_CONCEPT defines the type of RPT pool to use
     ///   @tparam PAGE_SIZE defines the size of a page
     ///   @tparam MAX_PPS the max number of PPs supported
@@ -66,6 +137,7 @@ namespace mk
     template<
         typename INTRINSIC_CONCEPT,
         typename PAGE_POOL_CONCEPT,
+        typename SLAB_POOL_CONCEPT,
         typename ROOT_PAGE_TABLE_CONCEPT,
         bsl::uintmax PAGE_SIZE,
         bsl::uintmax MAX_PPS,
@@ -91,6 +163,8 @@ namespace mk
         INTRINSIC_CONCEPT *m_intrinsic{};
         /// @brief stores a reference to the page pool to use
         PAGE_POOL_CONCEPT *m_page_pool{};
+        /// @brief stores a reference to the slab pool to use
+        SLAB_POOL_CONCEPT *m_slab_pool{};
         /// @brief stores the ID associated with this ext_t
         bsl::safe_uint16 m_id{bsl::safe_uint16::zero(true)};
         /// @brief stores an extension's ELF file
@@ -108,6 +182,10 @@ namespace mk
         bsl::safe_uintmax m_bootstrap_ip{bsl::safe_uintmax::zero(true)};
         /// @brief stores the vmexit IP registered by the extension
         bsl::safe_uintmax m_vmexit_ip{bsl::safe_uintmax::zero(true)};
+        /// @brief stores the IP the vmexit handler returns to (0 if none)
+        bsl::safe_uintmax m_vmexit_ret_ip{};
+        /// @brief stores the fast path table registered by the extension
+        fast_path_t m_fast_path{};
         /// @brief stores the fail IP registered by the extension
         bsl::safe_uintmax m_fail_ip{bsl::safe_uintmax::zero(true)};
         /// @brief stores the extension's handle
@@ -116,6 +194,368 @@ namespace mk
         bsl::safe_uintmax m_page_pool_cursor{bsl::to_umax(EXT_PAGE_POOL_ADDR)};
         /// @brief stores the extension's heap pool cursor
         bsl::safe_uintmax m_heap_pool_cursor{bsl::to_umax(EXT_HEAP_POOL_ADDR)};
+        /// @brief stores the page pool virtual addresses freed by the extension
+        details::ext_free_va_t *m_free_va{};
+        /// @brief stores the pages that are waiting for every PP to flush
+        details::ext_quarantine_t *m_quarantine{};
+        /// @brief stores the huge blocks that are waiting for every PP to flush
+        details::ext_quarantine_t *m_huge_quarantine{};
+        /// @brief stores the current TLB epoch (see quarantine())
+        bsl::uintmax m_tlb_epoch{};
+        /// @brief stores the last TLB epoch that each PP has flushed (or max)
+        bsl::array<bsl::uintmax, MAX_PPS> m_tlb_flushed{};
+        /// @brief stores the lock that protects the extension's memory map
+        spinlock_t m_mem_lock{};
+
+        /// <!-- description -->
+        ///   @brief Returns the page pool owner that this extension's pages
+        ///     are charged to (see loader::page_pool_stats_t).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the page pool owner that this extension's pages
+        ///     are charged to.
+        ///
+        [[nodiscard]] constexpr auto
+        owner() const &noexcept -> bsl::safe_uintmax
+        {
+            return loader::PAGE_POOL_OWNER_EXT + bsl::to_umax(m_id);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records a virtual address in the extension's page pool
+        ///     region that is no longer mapped so that it can be handed out
+        ///     again by alloc_page(). If the free list cannot be grown, the
+        ///     virtual address is simply never used again. The caller must
+        ///     hold m_mem_lock before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param virt the virtual address to record
+        ///
+        template<typename TLS_CONCEPT>
+        constexpr void
+        push_free_va(TLS_CONCEPT &tls, bsl::safe_uintmax const &virt) &noexcept
+        {
+            if ((nullptr == m_free_va) ||
+                (bsl::to_umax(m_free_va->count) == details::EXT_FREE_VA_ENTRIES)) {
+                auto *const batch{m_slab_pool->template allocate<details::ext_free_va_t>(tls)};
+                if (bsl::unlikely(nullptr == batch)) {
+                    bsl::error() << "unable to record the free virtual address "    // --
+                                 << bsl::hex(virt)                                  // --
+                                 << bsl::endl                                       // --
+                                 << bsl::here();                                    // --
+
+                    return;
+                }
+
+                batch->next = m_free_va;
+                m_free_va = batch;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const count{bsl::to_umax(m_free_va->count)};
+            *m_free_va->entries.at_if(count) = virt.get();
+            m_free_va->count = (count + bsl::ONE_UMAX).get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a virtual address in the extension's page pool
+        ///     region that was previously freed, or an invalid address if
+        ///     there are none. The caller must hold m_mem_lock before calling
+        ///     this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @return Returns a virtual address in the extension's page pool
+        ///     region that was previously freed, or an invalid address if
+        ///     there are none.
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        pop_free_va(TLS_CONCEPT &tls) &noexcept -> bsl::safe_uintmax
+        {
+            if (nullptr == m_free_va) {
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            auto const count{bsl::to_umax(m_free_va->count) - bsl::ONE_UMAX};
+            bsl::safe_uintmax const virt{*m_free_va->entries.at_if(count)};
+            m_free_va->count = count.get();
+
+            if (count.is_zero()) {
+                auto *const batch{m_free_va};
+                m_free_va = batch->next;
+                m_slab_pool->deallocate(tls, batch);
+            }
+            else {
+                bsl::touch();
+            }
+
+            return virt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds memory that was just unmapped from the extension to
+        ///     the provided quarantine list and starts a new TLB epoch. The
+        ///     memory (and its virtual address) is not handed out again
+        ///     until every PP has reloaded CR3 in a later epoch (see
+        ///     execute()), as until then, another PP might still be using
+        ///     the old translation. If the list cannot be grown, the memory
+        ///     is simply never used again. The caller must hold m_mem_lock
+        ///     before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param head the quarantine list to add the memory to
+        ///   @param virt the virtual address to recycle, or 0 if the
+        ///     virtual address should not be recycled
+        ///   @param phys the physical address of the memory
+        ///   @param bytes the number of bytes that were unmapped
+        ///
+        template<typename TLS_CONCEPT>
+        constexpr void
+        quarantine(
+            TLS_CONCEPT &tls,
+            details::ext_quarantine_t *&head,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &phys,
+            bsl::safe_uintmax const &bytes) &noexcept
+        {
+            auto const epoch{bsl::safe_uintmax{m_tlb_epoch} + bsl::ONE_UMAX};
+            __atomic_store_n(&m_tlb_epoch, epoch.get(), __ATOMIC_RELEASE);
+
+            if ((nullptr == head) ||
+                (bsl::to_umax(head->count) == details::EXT_QUARANTINE_ENTRIES)) {
+                auto *const batch{m_slab_pool->template allocate<details::ext_quarantine_t>(tls)};
+                if (bsl::unlikely(nullptr == batch)) {
+                    bsl::error() << "unable to quarantine the physical address "    // --
+                                 << bsl::hex(phys)                                  // --
+                                 << bsl::endl                                       // --
+                                 << bsl::here();                                    // --
+
+                    return;
+                }
+
+                batch->next = head;
+                head = batch;
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const count{bsl::to_umax(head->count)};
+            *head->entries.at_if(count) = {virt.get(), phys.get(), bytes.get(), epoch.get()};
+            head->count = (count + bsl::ONE_UMAX).get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the newest TLB epoch that every online PP has
+        ///     flushed. Quarantined memory from this epoch or older is no
+        ///     longer in any PP's TLB.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the newest TLB epoch that every online PP has
+        ///     flushed.
+        ///
+        [[nodiscard]] constexpr auto
+        flushed_epoch() const &noexcept -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax epoch{__atomic_load_n(&m_tlb_epoch, __ATOMIC_ACQUIRE)};
+            for (bsl::safe_uintmax pp{}; pp < bsl::to_umax(m_online_pps); ++pp) {
+                auto const *const flushed{m_tlb_flushed.at_if(pp)};
+                if (bsl::unlikely(nullptr == flushed)) {
+                    return {};
+                }
+
+                bsl::safe_uintmax const val{__atomic_load_n(flushed, __ATOMIC_ACQUIRE)};
+                if (val < epoch) {
+                    epoch = val;
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            return epoch;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes an entry from the provided quarantine list that
+        ///     is no newer than the provided TLB epoch. The caller must hold
+        ///     m_mem_lock before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param head the quarantine list to remove the entry from
+        ///   @param epoch the newest TLB epoch that can be removed
+        ///   @param entry where to store the entry that was removed
+        ///   @return Returns true if an entry was removed, false if there
+        ///     are no entries that are old enough.
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        pop_quarantine(
+            TLS_CONCEPT &tls,
+            details::ext_quarantine_t *&head,
+            bsl::safe_uintmax const &epoch,
+            details::ext_quarantine_entry_t &entry) &noexcept -> bool
+        {
+            details::ext_quarantine_t *prev{};
+            for (auto *batch{head}; nullptr != batch; batch = batch->next) {
+                for (bsl::safe_uintmax i{}; i < bsl::to_umax(batch->count); ++i) {
+                    auto *const elem{batch->entries.at_if(i)};
+                    if (bsl::safe_uintmax{elem->epoch} > epoch) {
+                        continue;
+                    }
+
+                    auto const last{bsl::to_umax(batch->count) - bsl::ONE_UMAX};
+                    entry = *elem;
+                    *elem = *batch->entries.at_if(last);
+                    batch->count = last.get();
+
+                    if (last.is_zero()) {
+                        if (nullptr == prev) {
+                            head = batch->next;
+                        }
+                        else {
+                            prev->next = batch->next;
+                        }
+
+                        m_slab_pool->deallocate(tls, batch);
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    return true;
+                }
+
+                prev = batch;
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the quarantined pages that every PP has flushed
+        ///     to the page pool, and their virtual addresses to the free
+        ///     list. The caller must hold m_mem_lock before calling this
+        ///     function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_CONCEPT>
+        constexpr void
+        release_quarantine(TLS_CONCEPT &tls) &noexcept
+        {
+            auto const epoch{this->flushed_epoch()};
+
+            details::ext_quarantine_entry_t entry{};
+            while (this->pop_quarantine(tls, m_quarantine, epoch, entry)) {
+                auto const phys{bsl::to_umax(entry.phys)};
+                m_page_pool->deallocate(
+                    tls, m_page_pool->template phys_to_virt<void *>(phys), this->owner());
+
+                if (bsl::ZERO_UMAX != entry.virt) {
+                    this->push_free_va(tls, bsl::to_umax(entry.virt));
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the quarantined huge blocks that every PP has
+        ///     flushed to the provided huge pool, and their virtual
+        ///     addresses to the free list. The caller must hold m_mem_lock
+        ///     before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam HUGE_POOL_CONCEPT defines the type of huge pool to use
+        ///   @param tls the current TLS block
+        ///   @param huge_pool the huge pool the blocks were allocated from
+        ///
+        template<typename TLS_CONCEPT, typename HUGE_POOL_CONCEPT>
+        constexpr void
+        release_huge_quarantine(TLS_CONCEPT &tls, HUGE_POOL_CONCEPT &huge_pool) &noexcept
+        {
+            auto const epoch{this->flushed_epoch()};
+
+            details::ext_quarantine_entry_t entry{};
+            while (this->pop_quarantine(tls, m_huge_quarantine, epoch, entry)) {
+                auto const phys{bsl::to_umax(entry.phys)};
+                huge_pool.deallocate(huge_pool.template phys_to_virt<void *>(phys));
+
+                if (bsl::ZERO_UMAX != entry.virt) {
+                    auto const virt{bsl::to_umax(entry.virt)};
+                    auto const bytes{bsl::to_umax(entry.bytes)};
+                    for (bsl::safe_uintmax off{}; off < bytes; off += PAGE_SIZE) {
+                        this->push_free_va(tls, virt + off);
+                    }
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every page in the provided range of
+        ///     virtual addresses is mapped into the extension's userspace
+        ///     address space (and is writable if "writable" is true), so
+        ///     that the microkernel can access the range on behalf of the
+        ///     extension while SMAP is unlocked. The range can span any
+        ///     number of pages. The caller must hold m_mem_lock before
+        ///     calling this function, and until it is done with the range.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param virt the virtual address of the start of the range
+        ///   @param size the number of bytes in the range
+        ///   @param writable true if the microkernel will write to the range
+        ///   @return Returns true if the provided range of virtual addresses
+        ///     can be safely accessed, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_user_range_valid(
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &size,
+            bool const writable) &noexcept -> bool
+        {
+            auto const end{virt + size};
+            if (bsl::unlikely(!end) || bsl::unlikely(virt.is_zero()) ||
+                bsl::unlikely(size.is_zero())) {
+                bsl::error() << "invalid range: "    // --
+                             << bsl::hex(virt)       // --
+                             << " with size "        // --
+                             << bsl::hex(size)       // --
+                             << bsl::endl            // --
+                             << bsl::here();         // --
+
+                return false;
+            }
+
+            auto const first{virt & ~(PAGE_SIZE - bsl::ONE_UMAX)};
+            for (auto page{first}; page < end; page += PAGE_SIZE) {
+                if (bsl::unlikely(!m_main_rpt.is_user_page_mapped(page, writable))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return false;
+                }
+
+                bsl::touch();
+            }
+
+            return true;
+        }
 
         /// <!-- description -->
         ///   @brief Validates the provided pt_load segment.
@@ -333,12 +773,15 @@ namespace mk
         ///     the provided root page table.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param rpt the root page table to add too
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        add_segments(ROOT_PAGE_TABLE_CONCEPT &rpt) &noexcept -> bsl::errc_type
+        add_segments(TLS_CONCEPT &tls, ROOT_PAGE_TABLE_CONCEPT &rpt) &noexcept -> bsl::errc_type
         {
             bsl::span<bsl::byte> page{};
 
@@ -369,17 +812,39 @@ namespace mk
                     if (bytes_to_next_page == PAGE_SIZE) {
                         if ((phdr->p_flags & bfelf::PF_X).is_pos()) {
                             page = bsl::as_writable_t<bsl::byte>(
-                                rpt.allocate_rx(phdr->p_vaddr + bytes), PAGE_SIZE);
+                                rpt.allocate_uninit_rx(tls, phdr->p_vaddr + bytes), PAGE_SIZE);
                         }
                         else {
                             page = bsl::as_writable_t<bsl::byte>(
-                                rpt.allocate_rw(phdr->p_vaddr + bytes), PAGE_SIZE);
+                                rpt.allocate_uninit_rw(tls, phdr->p_vaddr + bytes), PAGE_SIZE);
                         }
 
                         if (bsl::unlikely(!page)) {
                             bsl::print<bsl::V>() << bsl::here();
                             return bsl::errc_failure;
                         }
+
+                        /// NOTE:
+                        /// - The page is not zeroed by the page pool, so
+                        ///   only zero the part of the page that will not
+                        ///   be filled in by the copy below.
+                        ///
+
+                        bsl::safe_uintmax bytes_to_keep{bytes_to_copy};
+                        if (bytes_to_keep > PAGE_SIZE) {
+                            bytes_to_keep = PAGE_SIZE;
+                        }
+                        else {
+                            bsl::touch();
+                        }
+
+                        if (bytes_to_keep < PAGE_SIZE) {
+                            bsl::builtin_memset(
+                                page.at_if(bytes_to_keep), '\0', PAGE_SIZE - bytes_to_keep);
+                        }
+                        else {
+                            bsl::touch();
+                        }
                     }
                     else {
                         if (bsl::unlikely(!page)) {
@@ -432,17 +897,21 @@ namespace mk
         ///     provided root page table at the provided address.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param rpt the root page table to add too
         ///   @param addr the address of where to put the stack
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        add_stack(ROOT_PAGE_TABLE_CONCEPT &rpt, bsl::safe_uintmax const &addr) &noexcept
+        add_stack(
+            TLS_CONCEPT &tls, ROOT_PAGE_TABLE_CONCEPT &rpt, bsl::safe_uintmax const &addr) &noexcept
             -> bsl::errc_type
         {
             for (bsl::safe_uintmax bytes{}; bytes < EXT_STACK_SIZE; bytes += PAGE_SIZE) {
-                void *page{rpt.allocate_rw(addr + bytes)};
+                void *page{rpt.allocate_rw(tls, addr + bytes)};
                 if (bsl::unlikely(nullptr == page)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return bsl::errc_failure;
@@ -459,18 +928,21 @@ namespace mk
         ///     root page table.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param rpt the root page table to add too
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        add_stacks(ROOT_PAGE_TABLE_CONCEPT &rpt) &noexcept -> bsl::errc_type
+        add_stacks(TLS_CONCEPT &tls, ROOT_PAGE_TABLE_CONCEPT &rpt) &noexcept -> bsl::errc_type
         {
             for (bsl::safe_uintmax pp{}; pp < bsl::to_umax(m_online_pps); ++pp) {
                 auto const offs{(EXT_STACK_SIZE + PAGE_SIZE) * pp};
                 auto const addr{(EXT_STACK_ADDR + offs)};
 
-                if (bsl::unlikely(!this->add_stack(rpt, addr))) {
+                if (bsl::unlikely(!this->add_stack(tls, rpt, addr))) {
                     bsl::print<bsl::V>() << bsl::here();
                     return bsl::errc_failure;
                 }
@@ -484,14 +956,18 @@ namespace mk
         ///     provided root page table at the provided address.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param rpt the root page table to add too
         ///   @param addr_usr the address the user's portion of the TLS block
         ///   @param addr_abi the address the ABI's portion of the TLS block
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
         add_tls_block(
+            TLS_CONCEPT &tls,
             ROOT_PAGE_TABLE_CONCEPT &rpt,
             bsl::safe_uintmax const &addr_usr,
             bsl::safe_uintmax const &addr_abi) &noexcept -> bsl::errc_type
@@ -499,13 +975,13 @@ namespace mk
             bsl::span<bsl::uint8> page_usr{};
             bsl::span<bsl::uintmax> page_abi{};
 
-            page_usr = bsl::as_writable_t<bsl::uint8>(rpt.allocate_rw(addr_usr), PAGE_SIZE);
+            page_usr = bsl::as_writable_t<bsl::uint8>(rpt.allocate_rw(tls, addr_usr), PAGE_SIZE);
             if (bsl::unlikely(!page_usr)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
 
-            page_abi = bsl::as_writable_t<bsl::uintmax>(rpt.allocate_rw(addr_abi), PAGE_SIZE);
+            page_abi = bsl::as_writable_t<bsl::uintmax>(rpt.allocate_rw(tls, addr_abi), PAGE_SIZE);
             if (bsl::unlikely(!page_abi)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -536,18 +1012,21 @@ namespace mk
         ///     root page table.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param rpt the root page table to add too
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        add_tls_blocks(ROOT_PAGE_TABLE_CONCEPT &rpt) &noexcept -> bsl::errc_type
+        add_tls_blocks(TLS_CONCEPT &tls, ROOT_PAGE_TABLE_CONCEPT &rpt) &noexcept -> bsl::errc_type
         {
             for (bsl::safe_uintmax pp{}; pp < bsl::to_umax(m_online_pps); ++pp) {
                 auto const offs{(EXT_TLS_SIZE + PAGE_SIZE) * pp};
                 auto const addr{(EXT_TLS_ADDR + offs)};
 
-                if (bsl::unlikely(!this->add_tls_block(rpt, addr, addr + PAGE_SIZE))) {
+                if (bsl::unlikely(!this->add_tls_block(tls, rpt, addr, addr + PAGE_SIZE))) {
                     bsl::print<bsl::V>() << bsl::here();
                     return bsl::errc_failure;
                 }
@@ -561,14 +1040,17 @@ namespace mk
         ///     of this extension.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param rpt the root page table to initialize
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        initialize_rpt(ROOT_PAGE_TABLE_CONCEPT &rpt) &noexcept -> bsl::errc_type
+        initialize_rpt(TLS_CONCEPT &tls, ROOT_PAGE_TABLE_CONCEPT &rpt) &noexcept -> bsl::errc_type
         {
-            if (bsl::unlikely(!rpt.initialize(m_intrinsic, m_page_pool))) {
+            if (bsl::unlikely(!rpt.initialize(m_intrinsic, m_page_pool, this->owner()))) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
@@ -582,17 +1064,17 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            if (bsl::unlikely(!this->add_segments(rpt))) {
+            if (bsl::unlikely(!this->add_segments(tls, rpt))) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
 
-            if (bsl::unlikely(!this->add_stacks(rpt))) {
+            if (bsl::unlikely(!this->add_stacks(tls, rpt))) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
 
-            if (bsl::unlikely(!this->add_tls_blocks(rpt))) {
+            if (bsl::unlikely(!this->add_tls_blocks(tls, rpt))) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
@@ -616,6 +1098,8 @@ namespace mk
         ///     execute the extension with
         ///   @param arg0 the first argument to pass the extension
         ///   @param arg1 the second argument to pass the extension
+        ///   @param ret_ip if not 0, the IP the extension returns to once
+        ///     the code at "ip" returns
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
@@ -626,7 +1110,8 @@ namespace mk
             bsl::safe_uintmax const &ip,
             ROOT_PAGE_TABLE_CONCEPT const &rpt,
             bsl::safe_uintmax const &arg0 = {},
-            bsl::safe_uintmax const &arg1 = {}) &noexcept -> bsl::errc_type
+            bsl::safe_uintmax const &arg1 = {},
+            bsl::safe_uintmax const &ret_ip = {}) &noexcept -> bsl::errc_type
         {
             if (bsl::unlikely(!m_initialized)) {
                 bsl::error() << "ext_t not initialized\n" << bsl::here();
@@ -638,13 +1123,41 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            auto *const flushed{m_tlb_flushed.at_if(bsl::to_umax(tls.ppid()))};
+            if (bsl::unlikely(nullptr == flushed)) {
+                bsl::error() << "invalid ppid: "          // --
+                             << bsl::hex(tls.ppid())    // --
+                             << bsl::endl               // --
+                             << bsl::here();            // --
+
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - The epoch is read before CR3 is reloaded, so that anything
+            ///   unmapped in this epoch or earlier is guaranteed to be gone
+            ///   from this PP's TLB once it is recorded as flushed. If
+            ///   nothing was unmapped since this PP last ran the extension,
+            ///   there is nothing to flush.
+            ///
+
+            auto const epoch{__atomic_load_n(&m_tlb_epoch, __ATOMIC_ACQUIRE)};
             if (tls.ext != this) {
                 tls.ext = this;
                 tls.set_extid(m_id);
                 rpt.activate();
             }
+            else if (*flushed != epoch) {
+                rpt.activate();
+            }
+            else {
+                bsl::touch();
+            }
 
-            auto const ret{call_ext(ip.get(), tls.sp, arg0.get(), arg1.get())};
+            __atomic_store_n(flushed, epoch, __ATOMIC_RELEASE);
+            m_intrinsic->load_host_syscall_msrs();
+
+            auto const ret{call_ext(ip.get(), tls.sp, arg0.get(), arg1.get(), ret_ip.get())};
             if (bsl::unlikely(ret != bsl::exit_success)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -658,6 +1171,8 @@ namespace mk
         using intrinsic_type = INTRINSIC_CONCEPT;
         /// @brief an alias for PAGE_POOL_CONCEPT
         using page_pool_type = PAGE_POOL_CONCEPT;
+        /// @brief an alias for SLAB_POOL_CONCEPT
+        using slab_pool_type = SLAB_POOL_CONCEPT;
         /// @brief an alias for ROOT_PAGE_TABLE_CONCEPT
         using root_page_table_type = ROOT_PAGE_TABLE_CONCEPT;
 
@@ -670,8 +1185,11 @@ namespace mk
         ///   @brief Initializes this ext_t
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param intrinsic the intrinsics to use
         ///   @param page_pool the page pool to use
+        ///   @param slab_pool the slab pool to use
         ///   @param i the ID for this ext_t
         ///   @param ext_elf_file the ELF file for this ext_t
         ///   @param online_pps the total number of PPs that are online
@@ -679,10 +1197,13 @@ namespace mk
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
         initialize(
+            TLS_CONCEPT &tls,
             INTRINSIC_CONCEPT *const intrinsic,
             PAGE_POOL_CONCEPT *const page_pool,
+            SLAB_POOL_CONCEPT *const slab_pool,
             bsl::safe_uint16 const &i,
             bsl::span<bsl::byte const> const &ext_elf_file,
             bsl::safe_uint16 const &online_pps,
@@ -693,8 +1214,8 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            bsl::finally release_on_error{[this]() noexcept -> void {
-                this->release();
+            bsl::finally release_on_error{[this, &tls]() noexcept -> void {
+                this->release(tls);
             }};
 
             m_intrinsic = intrinsic;
@@ -709,6 +1230,12 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            m_slab_pool = slab_pool;
+            if (bsl::unlikely(nullptr == slab_pool)) {
+                bsl::error() << "invalid slab_pool\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
             m_id = i;
             if (bsl::unlikely(!i)) {
                 bsl::error() << "invalid id\n" << bsl::here();
@@ -728,13 +1255,23 @@ namespace mk
             }
 
             m_system_rpt = system_rpt;
-            if (bsl::unlikely(!this->initialize_rpt(m_main_rpt))) {
+            if (bsl::unlikely(!this->initialize_rpt(tls, m_main_rpt))) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
 
             m_main_ip = bfelf::get_elf64_ip(ext_elf_file);
 
+            /// NOTE:
+            /// - A PP that has never run the extension cannot have any of
+            ///   its translations in its TLB, so it does not hold back the
+            ///   quarantine (see flushed_epoch()) until it runs it.
+            ///
+
+            for (auto const elem : m_tlb_flushed) {
+                *elem.data = bsl::safe_uintmax::max_value().get();
+            }
+
             release_on_error.ignore();
             m_initialized = true;
 
@@ -744,13 +1281,54 @@ namespace mk
         /// <!-- description -->
         ///   @brief Release the ext_t
         ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_CONCEPT>
         constexpr void
-        release() &noexcept
+        release(TLS_CONCEPT &tls) &noexcept
         {
+            while (nullptr != m_quarantine) {
+                auto *const batch{m_quarantine};
+                for (bsl::safe_uintmax i{}; i < bsl::to_umax(batch->count); ++i) {
+                    auto const phys{bsl::to_umax(batch->entries.at_if(i)->phys)};
+                    m_page_pool->deallocate(
+                        m_page_pool->template phys_to_virt<void *>(phys), this->owner());
+                }
+
+                m_quarantine = batch->next;
+                m_slab_pool->deallocate(tls, batch);
+            }
+
+            /// NOTE:
+            /// - The ext_t does not keep a reference to the huge pool, and
+            ///   an extension is only released when the microkernel fails
+            ///   to start, in which case the huge pool is released too, so
+            ///   only the batches used to store the list are returned here.
+            ///
+
+            while (nullptr != m_huge_quarantine) {
+                auto *const batch{m_huge_quarantine};
+                m_huge_quarantine = batch->next;
+                m_slab_pool->deallocate(tls, batch);
+            }
+
+            m_tlb_flushed = {};
+            m_tlb_epoch = {};
+
+            while (nullptr != m_free_va) {
+                auto *const batch{m_free_va};
+                m_free_va = batch->next;
+                m_slab_pool->deallocate(tls, batch);
+            }
+
             m_heap_pool_cursor = bsl::to_umax(EXT_HEAP_POOL_ADDR);
             m_page_pool_cursor = bsl::to_umax(EXT_PAGE_POOL_ADDR);
             m_handle = bsl::safe_uintmax::zero(true);
             m_fail_ip = bsl::safe_uintmax::zero(true);
+            m_fast_path.clear();
+            m_vmexit_ret_ip = {};
             m_vmexit_ip = bsl::safe_uintmax::zero(true);
             m_bootstrap_ip = bsl::safe_uintmax::zero(true);
             m_main_ip = bsl::safe_uintmax::zero(true);
@@ -759,6 +1337,7 @@ namespace mk
             m_online_pps = bsl::safe_uint16::zero(true);
             m_elf_file = {};
             m_id = bsl::safe_uint16::zero(true);
+            m_slab_pool = {};
             m_page_pool = {};
             m_intrinsic = {};
             m_bootstrapped = {};
@@ -872,22 +1451,73 @@ namespace mk
         }
 
         /// <!-- description -->
-        ///   @brief Returns the fast fail IP for this extension.
+        ///   @brief Sets the IP that the extension's VMExit handler returns
+        ///     to. The code at this IP hands the handler's disposition back
+        ///     to the microkernel. If this is 0, the VMExit handler is not
+        ///     allowed to return and must use one of the "run" syscalls.
         ///
         /// <!-- inputs/outputs -->
-        ///   @return Returns the fast fail IP for this extension.
+        ///   @param ip the VMExit return IP to use
         ///
-        [[nodiscard]] constexpr auto
-        fail_ip() const &noexcept -> bsl::safe_uintmax const &
+        constexpr void
+        set_vmexit_ret_ip(bsl::safe_uintmax const &ip) &noexcept
         {
-            return m_fail_ip;
+            m_vmexit_ret_ip = ip;
         }
 
         /// <!-- description -->
-        ///   @brief Sets the fast fail IP for this extension. This should
-        ///     be called by the syscall dispatcher as the result of a
-        ///     syscall from the extension defining what IP the extension
-        ///     would like to use for fail callbacks.
+        ///   @brief Returns the fast path table for this extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the fast path table for this extension.
+        ///
+        [[nodiscard]] constexpr auto
+        fast_path() const &noexcept -> fast_path_t const &
+        {
+            return m_fast_path;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the fast path table for this extension. The table
+        ///     is shared by all PPs and read without a lock, so it can
+        ///     only be set before the extension has been bootstrapped
+        ///     (i.e., while only PP 0 is executing the extension).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param table the fast path table to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set_fast_path(syscall::bf_fast_path_t const &table) &noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely(m_bootstrapped)) {
+                bsl::error() << "the fast path must be set before bootstrap completes\n"
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return m_fast_path.set(table);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the fast fail IP for this extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the fast fail IP for this extension.
+        ///
+        [[nodiscard]] constexpr auto
+        fail_ip() const &noexcept -> bsl::safe_uintmax const &
+        {
+            return m_fail_ip;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the fast fail IP for this extension. This should
+        ///     be called by the syscall dispatcher as the result of a
+        ///     syscall from the extension defining what IP the extension
+        ///     would like to use for fail callbacks.
         ///
         /// <!-- inputs/outputs -->
         ///   @param ip the fail IP to use
@@ -943,33 +1573,53 @@ namespace mk
         ///     address space. The resulting page is not accessible by the
         ///     microkernel, even though the virtual address is the same
         ///     for both the microkernel and the extension. This is to ensure
-        ///     protections against transient execution attacks.
+        ///     protections against transient execution attacks. Virtual
+        ///     addresses that were previously freed using free_page() are
+        ///     reused before new virtual addresses are handed out.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @return Returns a page_t containing the virtual address and
         ///     physical address of the page. If an error occurs, this
         ///     function will return an invalid virtual and physical address.
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        alloc_page() &noexcept -> page_t
+        alloc_page(TLS_CONCEPT &tls) &noexcept -> page_t
         {
             if (bsl::unlikely(!m_initialized)) {
                 bsl::error() << "ext_t not initialized\n" << bsl::here();
                 return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
             }
 
-            if (bsl::unlikely(m_bootstrapped)) {
-                bsl::error() << "allocations not supported after initialization\n" << bsl::here();
-                return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
-            }
+            lock_guard_t lock{m_mem_lock};
+            this->release_quarantine(tls);
 
-            if (!(m_page_pool_cursor < EXT_PAGE_POOL_ADDR + EXT_PAGE_POOL_SIZE)) {
-                bsl::error() << "ext_t page pool at max capacity\n" << bsl::here();
-                return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
+            bool is_reused{true};
+            auto virt{this->pop_free_va(tls)};
+            if (!virt) {
+                if (!(m_page_pool_cursor < EXT_PAGE_POOL_ADDR + EXT_PAGE_POOL_SIZE)) {
+                    bsl::error() << "ext_t page pool at max capacity\n" << bsl::here();
+                    return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
+                }
+
+                virt = m_page_pool_cursor;
+                is_reused = false;
+            }
+            else {
+                bsl::touch();
             }
 
-            auto *const ptr{m_main_rpt.allocate_rw(m_page_pool_cursor)};
+            auto *const ptr{m_main_rpt.allocate_rw(tls, virt)};
             if (bsl::unlikely(nullptr == ptr)) {
+                if (is_reused) {
+                    this->push_free_va(tls, virt);
+                }
+                else {
+                    bsl::touch();
+                }
+
                 bsl::print<bsl::V>() << bsl::here();
                 return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
             }
@@ -986,8 +1636,62 @@ namespace mk
             ///   bit), and it should also
             ///
 
-            m_page_pool_cursor += PAGE_SIZE;
-            return {bsl::to_umax(ptr), phys};
+            if (!is_reused) {
+                m_page_pool_cursor += PAGE_SIZE;
+            }
+            else {
+                bsl::touch();
+            }
+
+            return {virt, phys};
+        }
+
+        /// <!-- description -->
+        ///   @brief Frees a page previously allocated using alloc_page(),
+        ///     unmapping it from the extension's address space. Other PPs
+        ///     might still have the page in their TLBs, so the page is
+        ///     quarantined, and is only returned to the page pool (with its
+        ///     virtual address recorded so that it can be reused by
+        ///     alloc_page()) once every PP has reloaded CR3.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param virt the virtual address returned by alloc_page()
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        free_page(TLS_CONCEPT &tls, bsl::safe_uintmax const &virt) &noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "ext_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!virt) || bsl::unlikely(virt < EXT_PAGE_POOL_ADDR) ||
+                bsl::unlikely(!(virt < EXT_PAGE_POOL_ADDR + EXT_PAGE_POOL_SIZE))) {
+                bsl::error() << "invalid virtual address: "    // --
+                             << bsl::hex(virt)                 // --
+                             << bsl::endl                      // --
+                             << bsl::here();                   // --
+
+                return bsl::errc_failure;
+            }
+
+            lock_guard_t lock{m_mem_lock};
+
+            auto const phys{m_main_rpt.unmap_allocated_page(virt)};
+            if (bsl::unlikely(!phys)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            this->quarantine(tls, m_quarantine, virt, phys, bsl::to_umax(PAGE_SIZE));
+            this->release_quarantine(tls);
+
+            return bsl::errc_success;
         }
 
         /// <!-- description -->
@@ -1014,6 +1718,336 @@ namespace mk
             return phys;
         }
 
+        /// <!-- description -->
+        ///   @brief Copies "size" bytes from the extension's userspace
+        ///     address "virt" into "dst". Every page the range covers must
+        ///     be mapped into the extension's userspace address space. The
+        ///     range is validated and copied while m_mem_lock is held, so
+        ///     the extension cannot unmap any of it (using free_page() from
+        ///     another PP) while SMAP is unlocked.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam SMAP_GUARD_CONCEPT defines the type of smap guard to use
+        ///   @param dst a pointer to the microkernel memory to copy to
+        ///   @param virt the userspace virtual address to copy from
+        ///   @param size the number of bytes to copy
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename SMAP_GUARD_CONCEPT>
+        [[nodiscard]] constexpr auto
+        copy_from_user(
+            void *const dst,
+            bsl::safe_uintmax const &virt,
+            bsl::safe_uintmax const &size) &noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "ext_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            lock_guard_t lock{m_mem_lock};
+
+            if (bsl::unlikely(!this->is_user_range_valid(virt, size, false))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            SMAP_GUARD_CONCEPT unlock{};
+            bsl::builtin_memcpy(dst, bsl::to_ptr<void const *>(virt), size);
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Copies "size" bytes from "src" to the extension's
+        ///     userspace address "virt". Every page the range covers must
+        ///     be mapped into the extension's userspace address space and
+        ///     be writable. Like copy_from_user(), the range is validated
+        ///     and copied while m_mem_lock is held.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam SMAP_GUARD_CONCEPT defines the type of smap guard to use
+        ///   @param virt the userspace virtual address to copy to
+        ///   @param src a pointer to the microkernel memory to copy from
+        ///   @param size the number of bytes to copy
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename SMAP_GUARD_CONCEPT>
+        [[nodiscard]] constexpr auto
+        copy_to_user(
+            bsl::safe_uintmax const &virt,
+            void const *const src,
+            bsl::safe_uintmax const &size) &noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "ext_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            lock_guard_t lock{m_mem_lock};
+
+            if (bsl::unlikely(!this->is_user_range_valid(virt, size, true))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            SMAP_GUARD_CONCEPT unlock{};
+            bsl::builtin_memcpy(bsl::to_ptr<void *>(virt), src, size);
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Grows the extension's heap by "size" bytes (rounded up
+        ///     to the nearest page) and returns the virtual address of the
+        ///     start of the newly added memory (i.e., the previous end of
+        ///     the heap), similar to sbrk(). All of the pages are mapped
+        ///     by a single call so that extensions can grow their heap in
+        ///     large batches instead of one page at a time. The memory is
+        ///     zeroed, and is virtually contiguous, but it is not physically
+        ///     contiguous. If any page cannot be allocated, the heap is left
+        ///     unchanged.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param size the number of bytes to grow the heap by
+        ///   @return Returns the virtual address of the start of the newly
+        ///     added memory, or an invalid address on failure.
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        alloc_heap(TLS_CONCEPT &tls, bsl::safe_uintmax const &size) &noexcept
+            -> bsl::safe_uintmax
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "ext_t not initialized\n" << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            if (bsl::unlikely(!size) || bsl::unlikely(size.is_zero())) {
+                bsl::error() << "invalid size: "    // --
+                             << bsl::hex(size)      // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            auto const bytes{(size + (PAGE_SIZE - bsl::ONE_UMAX)) & ~(PAGE_SIZE - bsl::ONE_UMAX)};
+            if (bsl::unlikely(!bytes) || bsl::unlikely(bytes > EXT_HEAP_POOL_SIZE)) {
+                bsl::error() << "ext_t heap pool at max capacity\n" << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            lock_guard_t lock{m_mem_lock};
+
+            auto const virt{m_heap_pool_cursor};
+            if (bsl::unlikely(virt + bytes > EXT_HEAP_POOL_ADDR + EXT_HEAP_POOL_SIZE)) {
+                bsl::error() << "ext_t heap pool at max capacity\n" << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            this->release_quarantine(tls);
+
+            for (bsl::safe_uintmax off{}; off < bytes; off += PAGE_SIZE) {
+                if (bsl::unlikely(nullptr == m_main_rpt.allocate_rw(tls, virt + off))) {
+                    for (bsl::safe_uintmax i{}; i < off; i += PAGE_SIZE) {
+                        auto const phys{m_main_rpt.unmap_allocated_page(virt + i)};
+                        if (bsl::unlikely(!phys)) {
+                            bsl::print<bsl::V>() << bsl::here();
+                            continue;
+                        }
+
+                        this->quarantine(tls, m_quarantine, {}, phys, bsl::to_umax(PAGE_SIZE));
+                    }
+
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_uintmax::zero(true);
+                }
+
+                bsl::touch();
+            }
+
+            m_heap_pool_cursor = virt + bytes;
+            return virt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates a physically contiguous block of memory from
+        ///     the provided huge pool that is large enough to hold "size"
+        ///     bytes and maps it into the extension's address space. The
+        ///     block is mapped into the extension's page pool region, aligned
+        ///     to the size of the block.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam HUGE_POOL_CONCEPT defines the type of huge pool to use
+        ///   @param tls the current TLS block
+        ///   @param huge_pool the huge pool to allocate from
+        ///   @param size the number of bytes to allocate
+        ///   @return Returns a page_t containing the virtual address and
+        ///     physical address of the block. If an error occurs, this
+        ///     function will return an invalid virtual and physical address.
+        ///
+        template<typename TLS_CONCEPT, typename HUGE_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        alloc_huge(
+            TLS_CONCEPT &tls,
+            HUGE_POOL_CONCEPT &huge_pool,
+            bsl::safe_uintmax const &size) &noexcept -> page_t
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "ext_t not initialized\n" << bsl::here();
+                return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
+            }
+
+            auto const order{huge_pool.size_to_order(size)};
+            if (bsl::unlikely(!order)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
+            }
+
+            lock_guard_t lock{m_mem_lock};
+            this->release_quarantine(tls);
+            this->release_huge_quarantine(tls, huge_pool);
+
+            auto const bytes{bsl::to_umax(PAGE_SIZE) << order};
+            auto const mask{bytes - bsl::ONE_UMAX};
+            auto const virt{(m_page_pool_cursor + mask) & ~mask};
+            if (bsl::unlikely(!virt) || (virt + bytes > EXT_PAGE_POOL_ADDR + EXT_PAGE_POOL_SIZE)) {
+                bsl::error() << "ext_t page pool at max capacity\n" << bsl::here();
+                return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
+            }
+
+            auto *const ptr{huge_pool.allocate(order)};
+            if (bsl::unlikely(nullptr == ptr)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
+            }
+
+            auto const phys{huge_pool.virt_to_phys(ptr)};
+            if (bsl::unlikely(!phys)) {
+                huge_pool.deallocate(ptr);
+
+                bsl::print<bsl::V>() << bsl::here();
+                return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
+            }
+
+            for (bsl::safe_uintmax off{}; off < bytes; off += PAGE_SIZE) {
+                if (bsl::unlikely(!m_main_rpt.map_page_rw(tls, virt + off, phys + off))) {
+                    for (bsl::safe_uintmax i{}; i < off; i += PAGE_SIZE) {
+                        bsl::discard(m_main_rpt.unmap_page(virt + i));
+                    }
+
+                    this->quarantine(tls, m_huge_quarantine, {}, phys, bytes);
+
+                    bsl::print<bsl::V>() << bsl::here();
+                    return {bsl::safe_uintmax::zero(true), bsl::safe_uintmax::zero(true)};
+                }
+
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - The pages skipped to align the block are handed to the
+            ///   free list so that alloc_page() can still use them.
+            ///
+
+            for (auto va{m_page_pool_cursor}; va < virt; va += PAGE_SIZE) {
+                this->push_free_va(tls, va);
+            }
+
+            m_page_pool_cursor = virt + bytes;
+            return {virt, phys};
+        }
+
+        /// <!-- description -->
+        ///   @brief Frees a block previously allocated using alloc_huge(),
+        ///     unmapping it from the extension's address space. Like
+        ///     free_page(), the block is quarantined, and is only returned
+        ///     to the provided huge pool once every PP has reloaded CR3.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam HUGE_POOL_CONCEPT defines the type of huge pool to use
+        ///   @param tls the current TLS block
+        ///   @param huge_pool the huge pool the block was allocated from
+        ///   @param virt the virtual address returned by alloc_huge()
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT, typename HUGE_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        free_huge(
+            TLS_CONCEPT &tls,
+            HUGE_POOL_CONCEPT &huge_pool,
+            bsl::safe_uintmax const &virt) &noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "ext_t not initialized\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!virt) || bsl::unlikely(virt < EXT_PAGE_POOL_ADDR) ||
+                bsl::unlikely(!(virt < EXT_PAGE_POOL_ADDR + EXT_PAGE_POOL_SIZE))) {
+                bsl::error() << "invalid virtual address: "    // --
+                             << bsl::hex(virt)                 // --
+                             << bsl::endl                      // --
+                             << bsl::here();                   // --
+
+                return bsl::errc_failure;
+            }
+
+            lock_guard_t lock{m_mem_lock};
+
+            auto const phys{m_main_rpt.virt_to_phys(virt)};
+            if (bsl::unlikely(!phys)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto *const ptr{huge_pool.template phys_to_virt<void *>(phys)};
+            auto const bytes{huge_pool.allocated_size(ptr)};
+            if (bsl::unlikely(!bytes)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            /// NOTE:
+            /// - Every page is checked before anything is unmapped so that
+            ///   a bad address cannot leave the block half unmapped, with
+            ///   some of its virtual addresses already on the free list
+            ///   and the block itself never returned to the huge pool.
+            ///
+
+            for (bsl::safe_uintmax off{}; off < bytes; off += PAGE_SIZE) {
+                if (bsl::unlikely(phys + off != m_main_rpt.virt_to_phys(virt + off))) {
+                    bsl::error() << "virtual address "                            // --
+                                 << bsl::hex(virt)                                // --
+                                 << " does not map a block from the huge pool"    // --
+                                 << bsl::endl                                     // --
+                                 << bsl::here();                                  // --
+
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+
+            for (bsl::safe_uintmax off{}; off < bytes; off += PAGE_SIZE) {
+                bsl::discard(m_main_rpt.unmap_page(virt + off));
+            }
+
+            this->quarantine(tls, m_huge_quarantine, virt, phys, bytes);
+            this->release_quarantine(tls);
+            this->release_huge_quarantine(tls, huge_pool);
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Starts the extension by executing it's _start entry point.
         ///     If the extension has not been initialized, this function will
@@ -1084,7 +2118,27 @@ namespace mk
             bsl::safe_uintmax arg0{bsl::to_umax(tls.active_vpsid)};
             bsl::safe_uintmax arg1{exit_reason};
 
-            auto const ret{this->execute(tls, m_vmexit_ip, m_main_rpt, arg0, arg1)};
+            tls.vmexit_disposition = syscall::BF_VMEXIT_DISPOSITION_RESUME.get();
+
+            /// NOTE:
+            /// - bf_callback_op_vmexit_return is only accepted while the
+            ///   handle is stored in the TLS block, so it cannot be used to
+            ///   return to the microkernel from anywhere but this handler.
+            /// - The "run" syscalls return to the VMExit loop without coming
+            ///   back here, which is why vmexit_loop() clears it as well.
+            ///
+
+            if (m_handle) {
+                tls.ext_vmexit_handle = m_handle.get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const ret{
+                this->execute(tls, m_vmexit_ip, m_main_rpt, arg0, arg1, m_vmexit_ret_ip)};
+            tls.ext_vmexit_handle = {};
+
             if (bsl::unlikely(!ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return ret;
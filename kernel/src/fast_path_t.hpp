@@ -0,0 +1,296 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef FAST_PATH_T_HPP
+#define FAST_PATH_T_HPP
+
+#include <mk_interface.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// @brief defines the MSRs that are saved/restored as part of a VPS,
+    ///   and therefore cannot be passed through by the fast path.
+    constexpr bsl::array<bsl::uint64, 13U> FAST_PATH_VPS_MSRS{
+        0x0000000000000174U,    // IA32_SYSENTER_CS
+        0x0000000000000175U,    // IA32_SYSENTER_ESP
+        0x0000000000000176U,    // IA32_SYSENTER_EIP
+        0x00000000000001D9U,    // IA32_DEBUGCTL
+        0x0000000000000277U,    // IA32_PAT
+        0x00000000C0000080U,    // IA32_EFER
+        0x00000000C0000081U,    // IA32_STAR
+        0x00000000C0000082U,    // IA32_LSTAR
+        0x00000000C0000083U,    // IA32_CSTAR
+        0x00000000C0000084U,    // IA32_FMASK
+        0x00000000C0000100U,    // IA32_FS_BASE
+        0x00000000C0000101U,    // IA32_GS_BASE
+        0x00000000C0000102U,    // IA32_KERNEL_GS_BASE
+    };
+
+    /// @enum mk::fast_path_status_t
+    ///
+    /// <!-- description -->
+    ///   @brief Describes what the fast path did with a VMExit.
+    ///
+    enum class fast_path_status_t : bsl::uint32
+    {
+        /// @brief the VMExit was not touched and is given to the extension
+        unhandled = 0,
+        /// @brief the VMExit was emulated and the VPS can be resumed
+        handled = 1,
+        /// @brief the VMExit was only partially emulated, which is fatal
+        failed = 2,
+    };
+
+    /// @class mk::fast_path_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the fast path table registered by an extension using
+    ///     bf_callback_op_register_fast_path. The table describes VMExits
+    ///     that the microkernel handles on the extension's behalf, without
+    ///     calling the extension's VMExit handler (see vmexit_fast_path()).
+    ///
+    class fast_path_t final
+    {
+        /// @brief stores the fast path table
+        syscall::bf_fast_path_t m_table{};
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided MSR is found in the first
+        ///     "num" entries of the provided list.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param list the list of MSRs to search
+        ///   @param num the number of valid entries in the list
+        ///   @param msr the MSR to search for
+        ///   @return Returns true if the provided MSR is found in the first
+        ///     "num" entries of the provided list.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_msr_in_list(
+            bsl::array<bsl::uint64, syscall::BF_FAST_PATH_MAX_MSRS.get()> const &list,
+            bsl::safe_uintmax const &num,
+            bsl::safe_uintmax const &msr) noexcept -> bool
+        {
+            for (auto const elem : list) {
+                if (elem.index >= num) {
+                    break;
+                }
+
+                if (msr == bsl::to_umax(*elem.data)) {
+                    return true;
+                }
+
+                bsl::touch();
+            }
+
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Validates a list of MSRs provided by the extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param list the list of MSRs to validate
+        ///   @param num the number of valid entries in the list
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        validate_msrs(
+            bsl::array<bsl::uint64, syscall::BF_FAST_PATH_MAX_MSRS.get()> const &list,
+            bsl::safe_uintmax const &num) noexcept -> bsl::errc_type
+        {
+            if (bsl::unlikely(num > syscall::BF_FAST_PATH_MAX_MSRS)) {
+                bsl::error() << "the number of msrs "                        // --
+                             << bsl::hex(num)                                // --
+                             << " is larger than the max supported "         // --
+                             << bsl::hex(syscall::BF_FAST_PATH_MAX_MSRS)    // --
+                             << bsl::endl                                    // --
+                             << bsl::here();                                 // --
+
+                return bsl::errc_failure;
+            }
+
+            for (auto const elem : FAST_PATH_VPS_MSRS) {
+                if (bsl::unlikely(is_msr_in_list(list, num, bsl::to_umax(*elem.data)))) {
+                    bsl::error() << "msr "                                   // --
+                                 << bsl::hex(*elem.data)                     // --
+                                 << " is part of the VPS and cannot be"      // --
+                                 << " passed through by the fast path"       // --
+                                 << bsl::endl                                // --
+                                 << bsl::here();                             // --
+
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+
+            return bsl::errc_success;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Validates and installs the provided fast path table,
+        ///     replacing any table that was previously installed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param table the fast path table to install
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        set(syscall::bf_fast_path_t const &table) &noexcept -> bsl::errc_type
+        {
+            bsl::safe_uintmax const num_cpuid{table.num_cpuid};
+            if (bsl::unlikely(num_cpuid > syscall::BF_FAST_PATH_MAX_CPUID)) {
+                bsl::error() << "the number of cpuid leaves "                 // --
+                             << bsl::hex(num_cpuid)                           // --
+                             << " is larger than the max supported "          // --
+                             << bsl::hex(syscall::BF_FAST_PATH_MAX_CPUID)    // --
+                             << bsl::endl                                     // --
+                             << bsl::here();                                  // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!validate_msrs(table.rdmsr, bsl::to_umax(table.num_rdmsr)))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!validate_msrs(table.wrmsr, bsl::to_umax(table.num_wrmsr)))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            m_table = table;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes the fast path table, which means all VMExits
+        ///     are given to the extension.
+        ///
+        constexpr void
+        clear() &noexcept
+        {
+            m_table = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the CPUID entry that matches the provided leaf
+        ///     and subleaf, or a nullptr if the extension must handle this
+        ///     CPUID itself.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param leaf the CPUID leaf (i.e., EAX) executed by the VPS
+        ///   @param subleaf the CPUID subleaf (i.e., ECX) executed by the VPS
+        ///   @return Returns the CPUID entry that matches the provided leaf
+        ///     and subleaf, or a nullptr if the extension must handle this
+        ///     CPUID itself.
+        ///
+        [[nodiscard]] constexpr auto
+        cpuid(bsl::safe_uintmax const &leaf, bsl::safe_uintmax const &subleaf) const &noexcept
+            -> syscall::bf_fast_path_cpuid_t const *
+        {
+            for (auto const elem : m_table.cpuid) {
+                if (elem.index >= bsl::to_umax(m_table.num_cpuid)) {
+                    break;
+                }
+
+                if (leaf != bsl::to_umax(elem.data->leaf)) {
+                    continue;
+                }
+
+                if (syscall::BF_FAST_PATH_ANY_SUBLEAF == bsl::to_u64(elem.data->subleaf)) {
+                    return elem.data;
+                }
+
+                if (subleaf == bsl::to_umax(elem.data->subleaf)) {
+                    return elem.data;
+                }
+
+                bsl::touch();
+            }
+
+            return nullptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if reads from the provided MSR are passed
+        ///     through by the microkernel.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param msr the MSR being read by the VPS
+        ///   @return Returns true if reads from the provided MSR are passed
+        ///     through by the microkernel.
+        ///
+        [[nodiscard]] constexpr auto
+        is_rdmsr_passthrough(bsl::safe_uintmax const &msr) const &noexcept -> bool
+        {
+            return is_msr_in_list(m_table.rdmsr, bsl::to_umax(m_table.num_rdmsr), msr);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if writes to the provided MSR are passed
+        ///     through by the microkernel.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param msr the MSR being written by the VPS
+        ///   @return Returns true if writes to the provided MSR are passed
+        ///     through by the microkernel.
+        ///
+        [[nodiscard]] constexpr auto
+        is_wrmsr_passthrough(bsl::safe_uintmax const &msr) const &noexcept -> bool
+        {
+            return is_msr_in_list(m_table.wrmsr, bsl::to_umax(m_table.num_wrmsr), msr);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the microkernel handles NMI window
+        ///     VMExits on behalf of the extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the microkernel handles NMI window
+        ///     VMExits on behalf of the extension.
+        ///
+        [[nodiscard]] constexpr auto
+        is_nmi_window_enabled() const &noexcept -> bool
+        {
+            bsl::safe_uint64 const flags{m_table.flags};
+            return !(flags & syscall::BF_FAST_PATH_FLAG_NMI_WINDOW).is_zero();
+        }
+    };
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include <mk_main.hpp>
 #include <page_pool_t.hpp>
 #include <root_page_table_t.hpp>
+#include <slab_pool_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vm_t.hpp>
 #include <vp_pool_t.hpp>
@@ -48,77 +49,91 @@
 
 namespace mk
 {
+    /// @brief defines the page pool type to use
+    using mk_page_pool_type = page_pool_t<    // --
+        HYPERVISOR_PAGE_SIZE,                 // --
+        HYPERVISOR_MAX_NUMA_NODES,            // --
+        HYPERVISOR_MAX_PPS>;                  // --
+
+    /// @brief defines the slab pool type to use
+    using mk_slab_pool_type = slab_pool_t<    // --
+        mk_page_pool_type,                    // --
+        HYPERVISOR_PAGE_SIZE,                 // --
+        HYPERVISOR_MAX_PPS>;                  // --
+
     /// @brief defines the VPS type to use
-    using mk_vps_type = vps_t<                 // --
-        intrinsic_t,                           // --
-        page_pool_t<HYPERVISOR_PAGE_SIZE>>;    // --
+    using mk_vps_type = vps_t<    // --
+        intrinsic_t,              // --
+        mk_page_pool_type>;       // --
 
     /// @brief defines the VPS pool type to use
-    using mk_vps_pool_type = vps_pool_t<      // --
-        mk_vps_type,                          // --
-        intrinsic_t,                          // --
-        page_pool_t<HYPERVISOR_PAGE_SIZE>,    // --
-        HYPERVISOR_MAX_VPSS>;                 // --
+    using mk_vps_pool_type = vps_pool_t<    // --
+        mk_vps_type,                        // --
+        intrinsic_t,                        // --
+        mk_page_pool_type,                  // --
+        HYPERVISOR_MAX_VPSS>;               // --
 
     /// @brief defines the VP type to use
-    using mk_vp_type = vp_t<                   // --
-        page_pool_t<HYPERVISOR_PAGE_SIZE>>;    // --
+    using mk_vp_type = vp_t<    // --
+        mk_page_pool_type>;     // --
 
     /// @brief defines the VP pool type to use
-    using mk_vp_pool_type = vp_pool_t<        // --
-        mk_vp_type,                           // --
-        page_pool_t<HYPERVISOR_PAGE_SIZE>,    // --
-        HYPERVISOR_MAX_VPS>;                  // --
+    using mk_vp_pool_type = vp_pool_t<    // --
+        mk_vp_type,                       // --
+        mk_page_pool_type,                // --
+        HYPERVISOR_MAX_VPS>;              // --
 
     /// @brief defines the VM type to use
-    using mk_vm_type = vm_t<                   // --
-        page_pool_t<HYPERVISOR_PAGE_SIZE>>;    // --
+    using mk_vm_type = vm_t<    // --
+        mk_page_pool_type>;     // --
 
     /// @brief defines the VM pool type to use
-    using mk_vm_pool_type = vm_pool_t<        // --
-        mk_vm_type,                           // --
-        page_pool_t<HYPERVISOR_PAGE_SIZE>,    // --
-        HYPERVISOR_MAX_VMS>;                  // --
+    using mk_vm_pool_type = vm_pool_t<    // --
+        mk_vm_type,                       // --
+        mk_page_pool_type,                // --
+        HYPERVISOR_MAX_VMS>;              // --
 
     /// @brief defines the root page table type
     using mk_root_page_table_type = root_page_table_t<    // --
         intrinsic_t,                                      // --
-        page_pool_t<HYPERVISOR_PAGE_SIZE>,                // --
+        mk_page_pool_type,                                // --
         HYPERVISOR_PAGE_SIZE,                             // --
         HYPERVISOR_PAGE_SHIFT,                            // --
         HYPERVISOR_MK_MAP_ADDR>;                          // --
 
     /// @brief defines the extension type to use
-    using mk_ext_type = ext_t<                // --
-        intrinsic_t,                          // --
-        page_pool_t<HYPERVISOR_PAGE_SIZE>,    // --
-        mk_root_page_table_type,              // --
-        HYPERVISOR_PAGE_SIZE,                 // --
-        HYPERVISOR_MAX_PPS,                   // --
-        HYPERVISOR_EXT_STACK_ADDR,            // --
-        HYPERVISOR_EXT_STACK_SIZE,            // --
-        HYPERVISOR_EXT_CODE_ADDR,             // --
-        HYPERVISOR_EXT_CODE_SIZE,             // --
-        HYPERVISOR_EXT_TLS_ADDR,              // --
-        HYPERVISOR_EXT_TLS_SIZE,              // --
-        HYPERVISOR_EXT_PAGE_POOL_ADDR,        // --
-        HYPERVISOR_EXT_PAGE_POOL_SIZE,        // --
-        HYPERVISOR_EXT_HEAP_POOL_ADDR,        // --
-        HYPERVISOR_EXT_HEAP_POOL_SIZE>;       // --
+    using mk_ext_type = ext_t<             // --
+        intrinsic_t,                       // --
+        mk_page_pool_type,                 // --
+        mk_slab_pool_type,                 // --
+        mk_root_page_table_type,           // --
+        HYPERVISOR_PAGE_SIZE,              // --
+        HYPERVISOR_MAX_PPS,                // --
+        HYPERVISOR_EXT_STACK_ADDR,         // --
+        HYPERVISOR_EXT_STACK_SIZE,         // --
+        HYPERVISOR_EXT_CODE_ADDR,          // --
+        HYPERVISOR_EXT_CODE_SIZE,          // --
+        HYPERVISOR_EXT_TLS_ADDR,           // --
+        HYPERVISOR_EXT_TLS_SIZE,           // --
+        HYPERVISOR_EXT_PAGE_POOL_ADDR,     // --
+        HYPERVISOR_EXT_PAGE_POOL_SIZE,     // --
+        HYPERVISOR_EXT_HEAP_POOL_ADDR,     // --
+        HYPERVISOR_EXT_HEAP_POOL_SIZE>;    // --
 
     /// @brief defines the extension pool type to use
-    using mk_ext_pool_type = ext_pool_t<      // --
-        mk_ext_type,                          // --
-        intrinsic_t,                          // --
-        page_pool_t<HYPERVISOR_PAGE_SIZE>,    // --
-        mk_root_page_table_type,              // --
-        HYPERVISOR_MAX_EXTENSIONS>;           // --
+    using mk_ext_pool_type = ext_pool_t<    // --
+        mk_ext_type,                        // --
+        intrinsic_t,                        // --
+        mk_page_pool_type,                  // --
+        mk_slab_pool_type,                  // --
+        mk_root_page_table_type,            // --
+        HYPERVISOR_MAX_EXTENSIONS>;         // --
 
     /// @brief defines the extension pool type to use
     using mk_main_type = mk_main<    // --
         intrinsic_t,
-        page_pool_t<HYPERVISOR_PAGE_SIZE>,
-        huge_pool_t,
+        mk_page_pool_type,
+        huge_pool_t<HYPERVISOR_PAGE_SIZE>,
         mk_root_page_table_type,
         mk_vps_pool_type,
         mk_vp_pool_type,
@@ -134,10 +149,13 @@ namespace mk
     constinit inline intrinsic_t g_intrinsic{};
 
     /// @brief stores the page pool used by the microkernel
-    constinit inline page_pool_t<HYPERVISOR_PAGE_SIZE> g_page_pool{};
+    constinit inline mk_page_pool_type g_page_pool{};
+
+    /// @brief stores the slab pool used by the microkernel
+    constinit inline mk_slab_pool_type g_slab_pool{g_page_pool};
 
     /// @brief stores the huge pool used by the microkernel
-    constinit inline huge_pool_t g_huge_pool{};
+    constinit inline huge_pool_t<HYPERVISOR_PAGE_SIZE> g_huge_pool{};
 
     /// @brief stores the vps_t pool used by the microkernel
     constinit inline mk_vps_pool_type g_vps_pool{g_intrinsic, g_page_pool};
@@ -152,7 +170,8 @@ namespace mk
     constinit inline mk_root_page_table_type g_system_rpt{};
 
     /// @brief stores the ext_t pool used by the microkernel
-    constinit inline mk_ext_pool_type g_ext_pool{g_intrinsic, g_page_pool, g_system_rpt};
+    constinit inline mk_ext_pool_type g_ext_pool{
+        g_intrinsic, g_page_pool, g_slab_pool, g_system_rpt};
 
     /// @brief stores the microkernel's main class
     constinit inline mk_main_type g_mk_main{
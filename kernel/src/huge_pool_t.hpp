@@ -25,31 +25,257 @@
 #ifndef HUGE_POOL_T_HPP
 #define HUGE_POOL_T_HPP
 
+#include <lock_guard_t.hpp>
+#include <spinlock_t.hpp>
+
+#include <bsl/array.hpp>
 #include <bsl/byte.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstring.hpp>
+#include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/finally.hpp>
+#include <bsl/is_pointer.hpp>
+#include <bsl/is_standard_layout.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
 {
+    namespace details
+    {
+        /// @brief defines the number of block sizes (orders) the huge pool supports
+        constexpr bsl::safe_uintmax HUGE_POOL_NUM_ORDERS{bsl::to_umax(10U)};
+        /// @brief defines the metadata flag used to mark the first page of a free block
+        constexpr bsl::safe_uintmax HUGE_POOL_FREE_FLAG{bsl::to_umax(0x80U)};
+        /// @brief defines the metadata flag used to mark the first page of a used block
+        constexpr bsl::safe_uintmax HUGE_POOL_USED_FLAG{bsl::to_umax(0x40U)};
+        /// @brief defines the metadata mask used to extract the order of a block
+        constexpr bsl::safe_uintmax HUGE_POOL_ORDER_MASK{bsl::to_umax(0x3FU)};
+
+        /// @struct mk::details::huge_pool_node_t
+        ///
+        /// <!-- description -->
+        ///   @brief Defines the node that is stored at the beginning of
+        ///     each free block, linking the block into its free list.
+        ///
+        struct huge_pool_node_t final
+        {
+            /// @brief stores the next free block of the same order
+            huge_pool_node_t *next;
+            /// @brief stores the previous free block of the same order
+            huge_pool_node_t *prev;
+        };
+    }
+
     /// @class mk::huge_pool_t
     ///
     /// <!-- description -->
-    ///   @brief TODO
+    ///   @brief The huge pool is responsible for allocating and freeing
+    ///     physically contiguous memory. Like the page pool, the huge pool
+    ///     is given to the microkernel by the loader and exists in the
+    ///     microkernel's direct map, meaning virt to phys and phys to virt
+    ///     conversions are simple arithmetic.
+    ///
+    ///     The huge pool is implemented as a binary buddy allocator.
+    ///     Blocks are 2^order pages in size, where order is between 0
+    ///     (a single page) and HUGE_POOL_NUM_ORDERS - 1 (2M when the page
+    ///     size is 4k), and every block is naturally aligned in physical
+    ///     memory (i.e., a 2M block is always 2M aligned). Each order has
+    ///     its own doubly linked list of free blocks, the nodes of which
+    ///     are stored in the free blocks themselves. To allocate, a block
+    ///     is taken from the list of the requested order. If that list is
+    ///     empty, a larger block is split in half until a block of the
+    ///     requested order exists, with the unused halves (the buddies)
+    ///     placed in the lists of the smaller orders. To deallocate, the
+    ///     block is merged with its buddy for as long as the buddy is also
+    ///     free, and the resulting block is placed in the list of its order.
+    ///
+    ///     To be able to find the order of a block being deallocated as
+    ///     well as to determine whether or not a block's buddy is free, the
+    ///     huge pool stores one byte of metadata per page. The metadata is
+    ///     carved from the end of the pool itself, so the usable size of
+    ///     the pool is slightly smaller than the pool given to the
+    ///     microkernel by the loader.
     ///
+    /// <!-- template parameters -->
+    ///   @tparam PAGE_SIZE defines the size of a page
+    ///
+    template<bsl::uintmax PAGE_SIZE>
     class huge_pool_t final
     {
         /// @brief stores true if initialized() has been executed
         bool m_initialized{};
         /// @brief stores the range of memory used by this allocator
         bsl::span<bsl::byte> m_pool{};
+        /// @brief stores the per-page metadata (carved from the end of m_pool)
+        bsl::span<bsl::uint8> m_meta{};
         /// @brief stores the virtual address base of the page pool.
-        bsl::safe_uintmax m_base_virt{};
-        /// @brief stores the huge pool's cursor
-        bsl::safe_uintmax m_cursor{};
+        bsl::safe_uintmax m_base_virt{bsl::safe_uintmax::zero(true)};
+        /// @brief stores the physical address of the first page in the pool
+        bsl::safe_uintmax m_base_phys{bsl::safe_uintmax::zero(true)};
+        /// @brief stores the number of pages that can be allocated
+        bsl::safe_uintmax m_num_pages{bsl::safe_uintmax::zero(true)};
+        /// @brief stores the free lists (one per order)
+        bsl::array<details::huge_pool_node_t *, details::HUGE_POOL_NUM_ORDERS.get()> m_free{};
+        /// @brief stores the lock that protects the free lists and metadata
+        spinlock_t m_lock{};
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes in a block of the
+        ///     provided order.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the order of the block
+        ///   @return Returns the number of bytes in a block of the
+        ///     provided order.
+        ///
+        [[nodiscard]] static constexpr auto
+        block_size(bsl::safe_uintmax const &order) noexcept -> bsl::safe_uintmax
+        {
+            return bsl::to_umax(PAGE_SIZE) << order;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the page (i.e., the index into
+        ///     the metadata) that the provided block starts on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param block the block to get the index for
+        ///   @return Returns the index of the page that the provided block
+        ///     starts on.
+        ///
+        [[nodiscard]] constexpr auto
+        block_to_idx(void const *const block) const &noexcept -> bsl::safe_uintmax
+        {
+            return (bsl::to_umax(block) - bsl::to_umax(m_pool.data())) / bsl::to_umax(PAGE_SIZE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the block that starts on the page at the
+        ///     provided index.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the page the block starts on
+        ///   @return Returns the block that starts on the page at the
+        ///     provided index.
+        ///
+        [[nodiscard]] constexpr auto
+        idx_to_block(bsl::safe_uintmax const &idx) const &noexcept -> details::huge_pool_node_t *
+        {
+            return bsl::to_ptr<details::huge_pool_node_t *>(
+                bsl::to_umax(m_pool.data()) + (idx * bsl::to_umax(PAGE_SIZE)));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the provided block's buddy. Since
+        ///     buddies are computed using physical addresses, blocks are
+        ///     naturally aligned in physical memory.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the block to get the buddy for
+        ///   @param order the order of the block to get the buddy for
+        ///   @return Returns the index of the provided block's buddy.
+        ///
+        [[nodiscard]] constexpr auto
+        buddy_idx(bsl::safe_uintmax const &idx, bsl::safe_uintmax const &order) const &noexcept
+            -> bsl::safe_uintmax
+        {
+            constexpr auto page_size{bsl::to_umax(PAGE_SIZE)};
+            auto const phys{m_base_phys + (idx * page_size)};
+            return ((phys ^ block_size(order)) - m_base_phys) / page_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a block to the free list of the provided order and
+        ///     marks it as free. The caller must hold m_lock before calling
+        ///     this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the block to add
+        ///   @param order the order of the block to add
+        ///
+        constexpr void
+        push(bsl::safe_uintmax const &idx, bsl::safe_uintmax const &order) &noexcept
+        {
+            auto **const head{m_free.at_if(order)};
+            auto *const node{this->idx_to_block(idx)};
+
+            node->next = *head;
+            node->prev = nullptr;
+
+            if (nullptr != *head) {
+                (*head)->prev = node;
+            }
+            else {
+                bsl::touch();
+            }
+
+            *head = node;
+            *m_meta.at_if(idx) = bsl::to_u8(details::HUGE_POOL_FREE_FLAG | order).get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes a block from the free list of the provided
+        ///     order and clears its metadata. The caller must hold m_lock
+        ///     before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the block to remove
+        ///   @param order the order of the block to remove
+        ///
+        constexpr void
+        remove(bsl::safe_uintmax const &idx, bsl::safe_uintmax const &order) &noexcept
+        {
+            auto **const head{m_free.at_if(order)};
+            auto *const node{this->idx_to_block(idx)};
+
+            if (nullptr != node->prev) {
+                node->prev->next = node->next;
+            }
+            else {
+                *head = node->next;
+            }
+
+            if (nullptr != node->next) {
+                node->next->prev = node->prev;
+            }
+            else {
+                bsl::touch();
+            }
+
+            *m_meta.at_if(idx) = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the block at the provided index is
+        ///     free and of the provided order. The caller must hold m_lock
+        ///     before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the block to query
+        ///   @param order the order of the block to query
+        ///   @return Returns true if the block at the provided index is
+        ///     free and of the provided order.
+        ///
+        [[nodiscard]] constexpr auto
+        is_free(bsl::safe_uintmax const &idx, bsl::safe_uintmax const &order) const &noexcept
+            -> bool
+        {
+            if (!(idx < m_num_pages)) {
+                return false;
+            }
+
+            if ((idx + (bsl::ONE_UMAX << order)) > m_num_pages) {
+                return false;
+            }
+
+            auto const meta{bsl::to_umax(*m_meta.at_if(idx))};
+            return meta == (details::HUGE_POOL_FREE_FLAG | order);
+        }
 
     public:
         /// <!-- description -->
@@ -58,14 +284,14 @@ namespace mk
         constexpr huge_pool_t() noexcept = default;
 
         /// <!-- description -->
-        ///   @brief Creates the page pool given a mutable_buffer_t to
-        ///     the page pool as well as the virtual address base of the
-        ///     page pool which is used for virt to phys translations.
+        ///   @brief Creates the huge pool given a mutable_buffer_t to
+        ///     the huge pool as well as the virtual address base of the
+        ///     huge pool which is used for virt to phys translations.
+        ///     The provided pool must be physically contiguous.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param pool the mutable_buffer_t of the page pool
-        ///   @param base_virt the base virtual address base of the page pool
-        ///        constexpr bsl::errc_type
+        ///   @param pool the mutable_buffer_t of the huge pool
+        ///   @param base_virt the base virtual address base of the huge pool
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
@@ -83,26 +309,69 @@ namespace mk
             }};
 
             if (bsl::unlikely(pool.empty())) {
-                m_pool = {};
-                m_base_virt = bsl::safe_uintmax::zero(true);
-                m_cursor = bsl::safe_uintmax::zero(true);
-
                 bsl::error() << "pool is empty\n" << bsl::here();
                 return bsl::errc_failure;
             }
 
             if (bsl::unlikely(base_virt.is_zero())) {
-                m_pool = {};
-                m_base_virt = bsl::safe_uintmax::zero(true);
-                m_cursor = bsl::safe_uintmax::zero(true);
-
                 bsl::error() << "base_virt is 0 or invalid\n" << bsl::here();
                 return bsl::errc_failure;
             }
 
+            constexpr auto page_size{bsl::to_umax(PAGE_SIZE)};
+            auto const total_pages{pool.size() / page_size};
+
+            /// NOTE:
+            /// - One byte of metadata is needed per page, and the pages
+            ///   that store the metadata are taken from the end of the
+            ///   pool, so they are never handed out.
+            ///
+
+            auto const meta_pages{(total_pages + (page_size - bsl::ONE_UMAX)) / page_size};
+            if (bsl::unlikely(!(meta_pages < total_pages))) {
+                bsl::error() << "pool is too small\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
             m_pool = pool;
             m_base_virt = base_virt;
-            m_cursor = bsl::ZERO_UMAX;
+            m_base_phys = bsl::to_umax(pool.data()) - base_virt;
+            m_num_pages = total_pages - meta_pages;
+            m_meta = bsl::as_writable_t<bsl::uint8>(pool.at_if(m_num_pages * page_size), total_pages);
+
+            if (bsl::unlikely(!m_meta)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            bsl::builtin_memset(m_meta.data(), '\0', m_meta.size());
+
+            /// NOTE:
+            /// - Carve the pool into the largest naturally aligned blocks
+            ///   possible. If the loader gave us a pool that is aligned to
+            ///   the largest block size, this results in a list of
+            ///   largest blocks followed by a handful of smaller blocks
+            ///   at the end of the pool.
+            ///
+
+            bsl::safe_uintmax idx{};
+            while (idx < m_num_pages) {
+                bsl::safe_uintmax order{details::HUGE_POOL_NUM_ORDERS - bsl::ONE_UMAX};
+                while (!order.is_zero()) {
+                    auto const phys{m_base_phys + (idx * page_size)};
+                    bool const aligned{(phys & (block_size(order) - bsl::ONE_UMAX)).is_zero()};
+                    bool const fits{!((idx + (bsl::ONE_UMAX << order)) > m_num_pages)};
+
+                    if (aligned && fits) {
+                        break;
+                    }
+
+                    --order;
+                }
+
+                this->push(idx, order);
+                idx += (bsl::ONE_UMAX << order);
+            }
 
             release_on_error.ignore();
             m_initialized = true;
@@ -116,13 +385,307 @@ namespace mk
         constexpr void
         release() &noexcept
         {
-            m_cursor = bsl::safe_uintmax::zero(true);
+            m_free = {};
+            m_num_pages = bsl::safe_uintmax::zero(true);
+            m_base_phys = bsl::safe_uintmax::zero(true);
             m_base_virt = bsl::safe_uintmax::zero(true);
+            m_meta = {};
             m_pool = {};
 
             m_initialized = {};
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the smallest order whose blocks are large
+        ///     enough to hold the provided number of bytes.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param size the number of bytes to hold
+        ///   @return Returns the smallest order whose blocks are large
+        ///     enough to hold the provided number of bytes, or an
+        ///     invalid order if size is 0 or too large.
+        ///
+        [[nodiscard]] static constexpr auto
+        size_to_order(bsl::safe_uintmax const &size) noexcept -> bsl::safe_uintmax
+        {
+            if (bsl::unlikely(!size) || bsl::unlikely(size.is_zero())) {
+                bsl::error() << "invalid size: "    // --
+                             << bsl::hex(size)      // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            for (bsl::safe_uintmax order{}; order < details::HUGE_POOL_NUM_ORDERS; ++order) {
+                if (!(size > block_size(order))) {
+                    return order;
+                }
+            }
+
+            bsl::error() << "size is larger than the largest supported block: "    // --
+                         << bsl::hex(size)                                         // --
+                         << bsl::endl                                              // --
+                         << bsl::here();                                           // --
+
+            return bsl::safe_uintmax::zero(true);
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates a physically contiguous, naturally aligned
+        ///     block of 2^order pages and returns a pointer to the
+        ///     beginning of the block. The block is zeroed before it is
+        ///     returned (outside of the lock).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the order of the block to allocate
+        ///   @return Returns a pointer to the newly allocated block, or a
+        ///     nullptr on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        allocate(bsl::safe_uintmax const &order) &noexcept -> void *
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "huge_pool_t not initialized\n" << bsl::here();
+                return nullptr;
+            }
+
+            if (bsl::unlikely(!order) || bsl::unlikely(!(order < details::HUGE_POOL_NUM_ORDERS))) {
+                bsl::error() << "invalid order: "    // --
+                             << bsl::hex(order)      // --
+                             << bsl::endl            // --
+                             << bsl::here();         // --
+
+                return nullptr;
+            }
+
+            void *ptr{};
+            {
+                lock_guard_t lock{m_lock};
+
+                bsl::safe_uintmax current{order};
+                while (current < details::HUGE_POOL_NUM_ORDERS) {
+                    if (nullptr != *m_free.at_if(current)) {
+                        break;
+                    }
+
+                    ++current;
+                }
+
+                if (bsl::unlikely(!(current < details::HUGE_POOL_NUM_ORDERS))) {
+                    bsl::error() << "huge pool out of memory for order "    // --
+                                 << bsl::hex(order)                         // --
+                                 << bsl::endl                               // --
+                                 << bsl::here();                            // --
+
+                    return nullptr;
+                }
+
+                auto const idx{this->block_to_idx(*m_free.at_if(current))};
+                this->remove(idx, current);
+
+                while (current > order) {
+                    --current;
+                    this->push(idx + (bsl::ONE_UMAX << current), current);
+                }
+
+                *m_meta.at_if(idx) = bsl::to_u8(details::HUGE_POOL_USED_FLAG | order).get();
+                ptr = this->idx_to_block(idx);
+            }
+
+            bsl::builtin_memset(ptr, '\0', block_size(order));
+            return ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a block previously allocated using allocate()
+        ///     back to the huge pool, merging it with its buddy for as
+        ///     long as its buddy is free.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr the pointer to the block to deallocate
+        ///
+        constexpr void
+        deallocate(void *const ptr) &noexcept
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "huge_pool_t not initialized\n" << bsl::here();
+                return;
+            }
+
+            if (bsl::unlikely(nullptr == ptr)) {
+                return;
+            }
+
+            auto const addr{bsl::to_umax(ptr)};
+            auto const first{bsl::to_umax(m_pool.data())};
+            if (bsl::unlikely(addr < first) ||
+                bsl::unlikely(!(addr < (first + (m_num_pages * bsl::to_umax(PAGE_SIZE)))))) {
+                bsl::error() << "ptr "                                   // --
+                             << ptr                                      // --
+                             << " was not allocated by the huge pool"    // --
+                             << bsl::endl                                // --
+                             << bsl::here();                             // --
+
+                return;
+            }
+
+            lock_guard_t lock{m_lock};
+
+            auto idx{this->block_to_idx(ptr)};
+            auto const meta{bsl::to_umax(*m_meta.at_if(idx))};
+            if (bsl::unlikely((meta & details::HUGE_POOL_USED_FLAG).is_zero())) {
+                bsl::error() << "ptr "                                       // --
+                             << ptr                                          // --
+                             << " is not the start of an allocated block"    // --
+                             << bsl::endl                                    // --
+                             << bsl::here();                                 // --
+
+                return;
+            }
+
+            auto order{meta & details::HUGE_POOL_ORDER_MASK};
+            *m_meta.at_if(idx) = {};
+
+            while (order < (details::HUGE_POOL_NUM_ORDERS - bsl::ONE_UMAX)) {
+                auto const buddy{this->buddy_idx(idx, order)};
+                if (!this->is_free(buddy, order)) {
+                    break;
+                }
+
+                this->remove(buddy, order);
+                if (buddy < idx) {
+                    idx = buddy;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                ++order;
+            }
+
+            this->push(idx, order);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes in the block pointed to
+        ///     by ptr. The provided ptr must point to the beginning of a
+        ///     block that was allocated using allocate().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr the pointer to the block to query
+        ///   @return Returns the number of bytes in the block pointed to
+        ///     by ptr, or an invalid size on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        allocated_size(void const *const ptr) &noexcept -> bsl::safe_uintmax
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "huge_pool_t not initialized\n" << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            auto const addr{bsl::to_umax(ptr)};
+            auto const first{bsl::to_umax(m_pool.data())};
+            if (bsl::unlikely(addr < first) ||
+                bsl::unlikely(!(addr < (first + (m_num_pages * bsl::to_umax(PAGE_SIZE)))))) {
+                bsl::error() << "ptr "                                   // --
+                             << ptr                                      // --
+                             << " was not allocated by the huge pool"    // --
+                             << bsl::endl                                // --
+                             << bsl::here();                             // --
+
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            lock_guard_t lock{m_lock};
+
+            auto const meta{bsl::to_umax(*m_meta.at_if(this->block_to_idx(ptr)))};
+            if (bsl::unlikely((meta & details::HUGE_POOL_USED_FLAG).is_zero())) {
+                bsl::error() << "ptr "                                       // --
+                             << ptr                                          // --
+                             << " is not the start of an allocated block"    // --
+                             << bsl::endl                                    // --
+                             << bsl::here();                                 // --
+
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            return block_size(meta & details::HUGE_POOL_ORDER_MASK);
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts a virtual address to a physical address for
+        ///     any block allocated by the huge pool. If the provided ptr
+        ///     was not allocated using the allocate function by the same
+        ///     huge pool, this results of this function are UB.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T defines the type of virtual address being converted
+        ///   @param virt the virtual address to convert
+        ///   @return the resulting physical address
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        virt_to_phys(T const virt) const &noexcept -> bsl::safe_uintmax
+        {
+            static_assert(bsl::is_pointer<T>::value);
+            static_assert(bsl::is_standard_layout<T>::value);
+
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "huge_pool_t not initialized\n" << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            auto const ret{bsl::to_umax(virt) - m_base_virt};
+            if (bsl::unlikely(!ret)) {
+                bsl::error() << "virtual to physical address conversion failed for "    // --
+                             << virt                                                    // --
+                             << bsl::endl                                               // --
+                             << bsl::here();                                            // --
+
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            return ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Converts a physical address to a virtual address for
+        ///     any block allocated by the huge pool. If the provided address
+        ///     was not allocated using the allocate function by the same
+        ///     huge pool, this results of this function are UB.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T defines the type of virtual address to convert to
+        ///   @param phys the physical address to convert
+        ///   @return the resulting virtual address
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        phys_to_virt(bsl::safe_uintmax const &phys) const &noexcept -> T
+        {
+            static_assert(bsl::is_pointer<T>::value);
+            static_assert(bsl::is_standard_layout<T>::value);
+
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "huge_pool_t not initialized\n" << bsl::here();
+                return nullptr;
+            }
+
+            auto const ret{phys + m_base_virt};
+            if (bsl::unlikely(!ret)) {
+                bsl::error() << "physical to virtual address conversion failed for "    // --
+                             << bsl::hex(phys)                                          // --
+                             << bsl::endl                                               // --
+                             << bsl::here();                                            // --
+
+                return nullptr;
+            }
+
+            return bsl::to_ptr<T>(ret);
+        }
+
         /// <!-- description -->
         ///   @brief Destroyes a previously created huge_pool_t
         ///
@@ -0,0 +1,103 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef LOCK_GUARD_T_HPP
+#define LOCK_GUARD_T_HPP
+
+namespace mk
+{
+    /// @class mk::lock_guard_t
+    ///
+    /// <!-- description -->
+    ///   @brief Acquires the provided lock on construction and releases it
+    ///     when the lock_guard_t loses scope.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam LOCK_CONCEPT defines the type of lock to guard
+    ///
+    template<typename LOCK_CONCEPT>
+    class lock_guard_t final
+    {
+        /// @brief stores a reference to the lock being guarded
+        LOCK_CONCEPT &m_lock;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a lock_guard_t, acquiring the provided lock
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param lck the lock to acquire
+        ///
+        explicit lock_guard_t(LOCK_CONCEPT &lck) noexcept    // --
+            : m_lock{lck}
+        {
+            m_lock.lock();
+        }
+
+        /// <!-- description -->
+        ///   @brief Destroys the lock_guard_t, releasing the lock
+        ///
+        ~lock_guard_t() noexcept
+        {
+            m_lock.unlock();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        lock_guard_t(lock_guard_t const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///
+        lock_guard_t(lock_guard_t &&o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(lock_guard_t const &o) &noexcept
+            -> lock_guard_t & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(lock_guard_t &&o) &noexcept -> lock_guard_t & = delete;
+    };
+}
+
+#endif
@@ -212,7 +212,7 @@ namespace mk
             if (m_initialized) {
                 m_system_rpt.activate();
 
-                ret = m_system_rpt.add_root_vp_state(args->root_vp_state);
+                ret = m_system_rpt.add_root_vp_state(tls, args->root_vp_state);
                 if (bsl::unlikely(!ret)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return bsl::errc_failure;
@@ -237,7 +237,12 @@ namespace mk
             bsl::print() << "\n";
             bsl::print() << "\n";
 
-            ret = m_page_pool.initialize(args->page_pool, args->page_pool_base_virt);
+            ret = m_page_pool.initialize(
+                args->page_pool,
+                args->page_pool_base_virt,
+                args->pp_to_node,
+                args->page_pool_donations,
+                args->page_pool_stats);
             if (bsl::unlikely(!ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -249,7 +254,7 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            ret = m_system_rpt.initialize(&m_intrinsic, &m_page_pool);
+            ret = m_system_rpt.initialize(&m_intrinsic, &m_page_pool, loader::PAGE_POOL_OWNER_MK);
             if (bsl::unlikely(!ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -263,7 +268,7 @@ namespace mk
 
             m_system_rpt.activate();
 
-            ret = m_system_rpt.add_root_vp_state(args->root_vp_state);
+            ret = m_system_rpt.add_root_vp_state(tls, args->root_vp_state);
             if (bsl::unlikely(!ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -300,7 +305,7 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            ret = m_ext_pool.initialize(args->ext_elf_files, args->online_pps);
+            ret = m_ext_pool.initialize(tls, args->ext_elf_files, args->online_pps);
             if (bsl::unlikely(!ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -338,6 +343,10 @@ namespace mk
             set_extension_sp(tls);
             set_extension_tp(tls);
 
+            tls.vmexit_log = args->vmexit_log;
+            tls.vmexit_stats = args->vmexit_stats;
+            tls.syscall_trace = args->syscall_trace;
+
             /// TODO:
             /// - Verify the incomings args
             ///
@@ -445,16 +454,16 @@ return bsl::exit_failure;
             // [x] implement error on SVM instructions on AMD
             // [ ] implement fix for vmexit first crash (vmxoff and check state)
             // [x] implement alloc page
-            // [ ] implement free page
+            // [x] implement free page
             // [x] implement virt_to_phys
             // [ ] implement make ack
             // [ ] implement debugging mutex/transaction support
             // [ ] implement Windows support
             // [ ] implement UEFI support
-            // [ ] implement huge_pool
+            // [x] implement huge_pool
             // [ ] implement huge
-            // [ ] implement alloc physically contiguous page
-            // [ ] implement free physically contiguous page
+            // [x] implement alloc physically contiguous page
+            // [x] implement free physically contiguous page
             // [ ] implement per-VM direct maps
             // [ ] implement reduce the size of the TLS block
             // [ ] implement optimizations for release builds
@@ -468,7 +477,7 @@ return bsl::exit_failure;
             // [ ] implement reproduceable builds
             // [ ] implement complete unit tests
             // [ ] implement complete syscall tests
-            // [ ] implement heap support
+            // [x] implement heap support
             // [ ] implement IPC support
             // [ ] implement nmi support during promote
             // [ ] implement remaining todos
@@ -25,8 +25,16 @@
 #ifndef PAGE_POOL_T_HPP
 #define PAGE_POOL_T_HPP
 
+#include <lock_guard_t.hpp>
+#include <page_pool_donations_t.hpp>
+#include <page_pool_run_t.hpp>
+#include <page_pool_stats_t.hpp>
+#include <spinlock_t.hpp>
+
+#include <bsl/array.hpp>
 #include <bsl/construct_at.hpp>
 #include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
 #include <bsl/cstring.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
@@ -40,6 +48,34 @@
 
 namespace mk
 {
+    namespace details
+    {
+        /// @brief defines the number of pages moved between a PP's magazine and the pool
+        constexpr bsl::safe_uintmax PAGE_POOL_MAGAZINE_BATCH{bsl::to_umax(0x20U)};
+        /// @brief defines the bit used to mark a page in a magazine as dirty
+        constexpr bsl::safe_uintmax PAGE_POOL_DIRTY_FLAG{bsl::to_umax(0x1U)};
+
+        /// @struct mk::details::page_pool_node_t
+        ///
+        /// <!-- description -->
+        ///   @brief Stores the stacks of free pages that belong to a
+        ///     single NUMA node.
+        ///
+        struct page_pool_node_t final
+        {
+            /// @brief stores the head of the node's stack (zeroed pages).
+            void *head;
+            /// @brief stores the head of the node's stack (dirty pages).
+            void *dirty_head;
+            /// @brief stores the next run that has not been carved yet.
+            loader::page_pool_run_t *runs;
+            /// @brief stores the next page to carve from the current run.
+            bsl::safe_uintmax bump;
+            /// @brief stores the end of the current run.
+            bsl::safe_uintmax bump_end;
+        };
+    }
+
     /// @class mk::page_pool_t
     ///
     /// <!-- description -->
@@ -71,6 +107,18 @@ namespace mk
     ///      allocate and deallocate in O(1), and there is no metadata that
     ///      is needed, so no additional overhead.
     ///
+    ///      Linking every page ahead of time means that the loader would
+    ///      have to touch every page in the page pool before the
+    ///      microkernel could start, which is slow for large page pools.
+    ///      Instead, the loader only links together runs of physically
+    ///      contiguous pages (see loader::page_pool_run_t), which are
+    ///      usually 2M in size and mapped using 2M pages. The stack above
+    ///      starts empty, and when it is empty, pages are carved out of the
+    ///      current run one at a time (i.e., a bump allocator), moving on
+    ///      to the next run once the current run is used up. Pages only
+    ///      end up on the stack once they are deallocated, so the stack is
+    ///      built lazily as the page pool is used.
+    ///
     ///      To handle virt to phys and phys to virt conversions, each page
     ///      is mapped into the microkernel's address space at the physical
     ///      address + some offset. This means that virt to phys conversions
@@ -91,20 +139,604 @@ namespace mk
     ///      microkernel should be the only thing working with the unprotected
     ///      version of the secret.
     ///
+    ///      Since every PP shares the same page pool, access to the head of
+    ///      the stack is protected by a ticket lock. To keep PPs from
+    ///      fighting over this lock (and the cache line that stores the
+    ///      head), the versions of allocate/deallocate that are given a TLS
+    ///      block use a per-PP magazine of free pages that is stored in the
+    ///      PP's TLS block. Allocations pop from the magazine, and only when
+    ///      the magazine is empty is the lock taken, at which point a batch
+    ///      of pages is moved from the stack into the magazine. Likewise,
+    ///      deallocations push to the magazine, and only when the magazine
+    ///      is full is a batch of pages returned to the stack.
+    ///
+    ///      Pages handed to the microkernel by the loader are already
+    ///      zeroed (other than the pointer to the next page), so there is
+    ///      no reason to zero them again. For this reason, the page pool
+    ///      actually keeps two stacks, one for pages that are known to be
+    ///      zero, and one for pages that have been returned and are dirty.
+    ///      allocate() prefers zeroed pages, in which case the only thing
+    ///      that needs to be cleared is the pointer to the next page, and
+    ///      only falls back to zeroing an entire page when it is handed a
+    ///      dirty page. allocate_uninit() prefers dirty pages, and never
+    ///      zeros anything, which is what should be used by code that is
+    ///      going to initialize the entire page itself. Dirty pages can be
+    ///      zeroed ahead of time using scrub(). Pages in a magazine are
+    ///      tagged as dirty using the lowest bit of the pointer (which is
+    ///      always 0 as pages are page aligned).
+    ///
+    ///      On NUMA systems, the loader gives the microkernel one list of
+    ///      pages per node, each allocated from memory that is local to
+    ///      that node, as well as the node that each PP belongs to. Each
+    ///      node gets its own pair of stacks, and the versions of allocate
+    ///      that are given a TLS block take pages from the calling PP's
+    ///      node first, only falling back to the other nodes when the
+    ///      local node is out of pages. Pages do not remember which node
+    ///      they came from, so pages returned using a TLS block are given
+    ///      to the returning PP's node. Since the pages used by a PP (e.g.,
+    ///      a VMCS or the EPT it walks) are almost always allocated and
+    ///      freed by that same PP, this keeps them local without any
+    ///      per-page metadata. The versions of allocate/deallocate that
+    ///      are not given a TLS block always start with node 0.
+    ///
+    ///      The page pool can also grow while the microkernel is running.
+    ///      The loader maps new pages into the direct map, links them
+    ///      together the same way as the initial page pool, and then
+    ///      publishes them as a donation in a page that is shared with the
+    ///      microkernel (see loader::page_pool_donations_t). Any time the
+    ///      lock is taken to take pages from the stacks, the page pool
+    ///      first checks for new donations and splices each one onto the
+    ///      zeroed stack of the node that it belongs to. The loader only
+    ///      ever appends to this page, so no additional locking is needed.
+    ///
+    ///      Every allocation and deallocation is charged to an owner (the
+    ///      microkernel, the VPSs or one of the extensions, see
+    ///      loader::page_pool_stats_t). The number of pages each owner has,
+    ///      the total number of pages in use, the high-water mark and the
+    ///      number of failed allocations are kept in a page that is shared
+    ///      with the loader so that they can be read at any time without
+    ///      a syscall. These counters are updated using atomics as the TLS
+    ///      versions of allocate/deallocate do not take the lock. Pages
+    ///      that are sitting in a PP's magazine are counted as free.
+    ///
     /// <!-- template parameters -->
     ///   @tparam PAGE_SIZE defines the size of a page
+    ///   @tparam MAX_NODES the max number of NUMA nodes supported
+    ///   @tparam MAX_PPS the max number of PPs supported
     ///
-    template<bsl::uintmax PAGE_SIZE>
+    template<bsl::uintmax PAGE_SIZE, bsl::uintmax MAX_NODES, bsl::uintmax MAX_PPS>
     class page_pool_t final
     {
         /// @brief stores true if initialized() has been executed
         bool m_initialized{};
-        /// @brief stores the head of the page pool stack.
-        void *m_head{};
+        /// @brief stores the stacks of free pages for each node.
+        bsl::array<details::page_pool_node_t, MAX_NODES> m_nodes{};
+        /// @brief stores the node that each PP belongs to.
+        bsl::array<bsl::uint8, MAX_PPS> m_pp_to_node{};
         /// @brief stores the total number of bytes in the page pool.
         bsl::safe_uintmax m_size{bsl::safe_uintmax::zero(true)};
         /// @brief stores the virtual address base of the page pool.
         bsl::safe_uintmax m_base_virt{bsl::safe_uintmax::zero(true)};
+        /// @brief stores the lock that protects the head of the stack.
+        spinlock_t m_lock{};
+        /// @brief stores the page the loader uses to donate pages.
+        loader::page_pool_donations_t const *m_donations{};
+        /// @brief stores the number of donations already spliced in.
+        bsl::safe_uintmax m_absorbed{bsl::safe_uintmax::zero(true)};
+        /// @brief stores the page the page pool reports its stats in.
+        loader::page_pool_stats_t *m_stats{};
+
+        /// <!-- description -->
+        ///   @brief Pops a page off of the provided stack. The caller must
+        ///     hold m_lock before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param head the head of the stack to pop from
+        ///   @return Returns a pointer to the page that was popped, or
+        ///     a nullptr if the stack is empty.
+        ///
+        [[nodiscard]] static constexpr auto
+        pop(void *&head) noexcept -> void *
+        {
+            void *const ptr{head};
+            if (nullptr == ptr) {
+                return nullptr;
+            }
+
+            head = *static_cast<void **>(ptr);
+            return ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Pushes a page onto the provided stack. The caller must
+        ///     hold m_lock before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param head the head of the stack to push to
+        ///   @param ptr the page to push onto the stack
+        ///
+        static constexpr void
+        push(void *&head, void *const ptr) noexcept
+        {
+            *static_cast<void **>(ptr) = head;
+            head = ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the provided page with the dirty flag set.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr the page to tag
+        ///   @return Returns the provided page with the dirty flag set.
+        ///
+        [[nodiscard]] static constexpr auto
+        tag_dirty(void *const ptr) noexcept -> void *
+        {
+            return bsl::to_ptr<void *>(bsl::to_umax(ptr) | details::PAGE_POOL_DIRTY_FLAG);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided (tagged) page is dirty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr the tagged page to query
+        ///   @return Returns true if the provided (tagged) page is dirty.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_dirty(void *const ptr) noexcept -> bool
+        {
+            return !(bsl::to_umax(ptr) & details::PAGE_POOL_DIRTY_FLAG).is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the provided (tagged) page without its tag.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ptr the tagged page to untag
+        ///   @return Returns the provided (tagged) page without its tag.
+        ///
+        [[nodiscard]] static constexpr auto
+        untag(void *const ptr) noexcept -> void *
+        {
+            return bsl::to_ptr<void *>(bsl::to_umax(ptr) & ~details::PAGE_POOL_DIRTY_FLAG);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the node that the PP associated with the
+        ///     provided TLS block belongs to.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @return Returns the node that the PP associated with the
+        ///     provided TLS block belongs to.
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        node_of(TLS_CONCEPT const &tls) const &noexcept -> bsl::safe_uintmax
+        {
+            auto const *const node{m_pp_to_node.at_if(bsl::to_umax(tls.ppid()))};
+            if (bsl::unlikely(nullptr == node)) {
+                return {};
+            }
+
+            return bsl::to_umax(*node);
+        }
+
+        /// <!-- description -->
+        ///   @brief Carves a page out of the provided node's current run,
+        ///     moving on to the node's next run if the current run is used
+        ///     up. Pages carved from a run are always zeroed. The caller
+        ///     must hold m_lock before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param node the node to carve the page from
+        ///   @return Returns a pointer to the page, or a nullptr if the
+        ///     node has no more runs.
+        ///
+        [[nodiscard]] static constexpr auto
+        carve(details::page_pool_node_t &node) noexcept -> void *
+        {
+            constexpr bsl::safe_uintmax page_size{bsl::to_umax(PAGE_SIZE)};
+
+            if (!(node.bump < node.bump_end)) {
+                auto *const run{node.runs};
+                if (nullptr == run) {
+                    return nullptr;
+                }
+
+                node.runs = static_cast<loader::page_pool_run_t *>(run->next);
+                node.bump = bsl::to_umax(run);
+                node.bump_end = node.bump + bsl::to_umax(run->size);
+
+                *run = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            void *const ptr{bsl::to_ptr<void *>(node.bump)};
+            node.bump += page_size;
+
+            return ptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Takes a page from one of the provided node's stacks,
+        ///     or carves a new page out of the node's runs if the stacks
+        ///     are empty, returning a tagged pointer. The caller must hold
+        ///     m_lock before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param node the node to take the page from
+        ///   @param prefer_dirty if true, dirty pages are returned before
+        ///     zeroed pages, otherwise zeroed pages are returned first.
+        ///   @return Returns a tagged pointer to the page, or a nullptr
+        ///     if the node is out of pages.
+        ///
+        [[nodiscard]] static constexpr auto
+        take_from(details::page_pool_node_t &node, bool const prefer_dirty) noexcept -> void *
+        {
+            if (prefer_dirty) {
+                void *const dirty{pop(node.dirty_head)};
+                if (nullptr != dirty) {
+                    return tag_dirty(dirty);
+                }
+
+                void *const zeroed{pop(node.head)};
+                if (nullptr != zeroed) {
+                    return zeroed;
+                }
+
+                return carve(node);
+            }
+
+            void *const zeroed{pop(node.head)};
+            if (nullptr != zeroed) {
+                return zeroed;
+            }
+
+            void *const carved{carve(node)};
+            if (nullptr != carved) {
+                return carved;
+            }
+
+            void *const dirty{pop(node.dirty_head)};
+            if (nullptr == dirty) {
+                return nullptr;
+            }
+
+            return tag_dirty(dirty);
+        }
+
+        /// <!-- description -->
+        ///   @brief Publishes the total number of pages in the page pool
+        ///     to the stats page.
+        ///
+        constexpr void
+        publish_total() &noexcept
+        {
+            constexpr bsl::safe_uintmax page_size{bsl::to_umax(PAGE_SIZE)};
+            __atomic_store_n(&m_stats->total, (m_size / page_size).get(), __ATOMIC_RELAXED);
+        }
+
+        /// <!-- description -->
+        ///   @brief Charges a newly allocated page to the provided owner,
+        ///     updating the high-water mark if needed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param owner the owner to charge the page to
+        ///
+        constexpr void
+        charge(bsl::safe_uintmax const &owner) &noexcept
+        {
+            auto *const owned{m_stats->owners.at_if(owner)};
+            if (bsl::unlikely(nullptr == owned)) {
+                bsl::error() << "invalid page pool owner "    // --
+                             << bsl::hex(owner)               // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+            }
+            else {
+                __atomic_fetch_add(owned, 1U, __ATOMIC_RELAXED);
+            }
+
+            auto const used{__atomic_add_fetch(&m_stats->used, 1U, __ATOMIC_RELAXED)};
+            auto high_water{__atomic_load_n(&m_stats->high_water, __ATOMIC_RELAXED)};
+
+            while (used > high_water) {
+                bool const updated{__atomic_compare_exchange_n(
+                    &m_stats->high_water,
+                    &high_water,
+                    used,
+                    true,
+                    __ATOMIC_RELAXED,
+                    __ATOMIC_RELAXED)};
+
+                if (updated) {
+                    break;
+                }
+
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Credits a deallocated page back to the provided owner.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param owner the owner to credit the page to
+        ///
+        constexpr void
+        credit(bsl::safe_uintmax const &owner) &noexcept
+        {
+            auto *const owned{m_stats->owners.at_if(owner)};
+            if (bsl::unlikely(nullptr == owned)) {
+                bsl::error() << "invalid page pool owner "    // --
+                             << bsl::hex(owner)               // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+            }
+            else {
+                __atomic_fetch_sub(owned, 1U, __ATOMIC_RELAXED);
+            }
+
+            __atomic_fetch_sub(&m_stats->used, 1U, __ATOMIC_RELAXED);
+        }
+
+        /// <!-- description -->
+        ///   @brief Records an allocation that failed because the page
+        ///     pool is out of pages.
+        ///
+        constexpr void
+        record_failure() &noexcept
+        {
+            __atomic_fetch_add(&m_stats->failures, 1U, __ATOMIC_RELAXED);
+        }
+
+        /// <!-- description -->
+        ///   @brief Splices any pages that the loader has donated since the
+        ///     last time this function was called onto the zeroed stack of
+        ///     the node that they belong to. The caller must hold m_lock
+        ///     before calling this function.
+        ///
+        constexpr void
+        absorb() &noexcept
+        {
+            if (nullptr == m_donations) {
+                return;
+            }
+
+            bsl::safe_uintmax const count{__atomic_load_n(&m_donations->count, __ATOMIC_ACQUIRE)};
+
+            while (m_absorbed < count) {
+                auto const *const donation{m_donations->donations.at_if(m_absorbed)};
+                if (bsl::unlikely(nullptr == donation)) {
+                    bsl::error() << "invalid page pool donation "    // --
+                                 << bsl::hex(m_absorbed)             // --
+                                 << bsl::endl                        // --
+                                 << bsl::here();                     // --
+
+                    m_donations = nullptr;
+                    return;
+                }
+
+                ++m_absorbed;
+                if (bsl::unlikely((nullptr == donation->head) || (nullptr == donation->tail))) {
+                    bsl::error() << "empty page pool donation\n" << bsl::here();
+                    continue;
+                }
+
+                auto *node{m_nodes.at_if(bsl::to_umax(donation->node))};
+                if (bsl::unlikely(nullptr == node)) {
+                    node = m_nodes.front_if();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                *static_cast<void **>(donation->tail) = node->head;
+                node->head = donation->head;
+
+                m_size += bsl::to_umax(donation->size);
+                this->publish_total();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Takes a page from the provided node, falling back to
+        ///     the remaining nodes (in order) if the provided node is out
+        ///     of pages, returning a tagged pointer. The caller must hold
+        ///     m_lock before calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param node the preferred node to take the page from
+        ///   @param prefer_dirty if true, dirty pages are returned before
+        ///     zeroed pages, otherwise zeroed pages are returned first.
+        ///   @return Returns a tagged pointer to the page, or a nullptr
+        ///     if the page pool is out of pages.
+        ///
+        [[nodiscard]] constexpr auto
+        take(bsl::safe_uintmax const &node, bool const prefer_dirty) &noexcept -> void *
+        {
+            constexpr bsl::safe_uintmax max_nodes{bsl::to_umax(MAX_NODES)};
+            this->absorb();
+
+            for (bsl::safe_uintmax i{}; i < max_nodes; ++i) {
+                void *const ptr{take_from(*m_nodes.at_if((node + i) % max_nodes), prefer_dirty)};
+                if (nullptr != ptr) {
+                    return ptr;
+                }
+
+                bsl::touch();
+            }
+
+            return nullptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Gives a tagged page back to the provided node's stack
+        ///     that it belongs to. The caller must hold m_lock before
+        ///     calling this function.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param node the node to give the page to
+        ///   @param ptr the tagged page to give back
+        ///
+        constexpr void
+        give(bsl::safe_uintmax const &node, void *const ptr) &noexcept
+        {
+            auto *const n{m_nodes.at_if(node)};
+
+            if (is_dirty(ptr)) {
+                push(n->dirty_head, untag(ptr));
+            }
+            else {
+                push(n->head, ptr);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Finishes an allocation given a tagged page. If zero is
+        ///     true, the page is zeroed (only the pointer to the next page
+        ///     is cleared if the page is already zeroed) and T is
+        ///     constructed. Otherwise the page is returned as is.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to return
+        ///   @param ptr the tagged page to finish allocating
+        ///   @param zero if true, the resulting page is zeroed
+        ///   @return Returns a pointer to the newly allocated page
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        prepare(void *const ptr, bool const zero) noexcept -> T *
+        {
+            void *const page{untag(ptr)};
+
+            if (!zero) {
+                return static_cast<T *>(page);
+            }
+
+            if (is_dirty(ptr)) {
+                bsl::builtin_memset(page, '\0', PAGE_SIZE);
+            }
+            else {
+                *static_cast<void **>(page) = nullptr;
+            }
+
+            if constexpr (!bsl::is_void<T>::value) {
+                static_assert(bsl::is_standard_layout<T>::value, "T must be a standard layout");
+                bsl::construct_at<T>(page);
+            }
+
+            return static_cast<T *>(page);
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves up to PAGE_POOL_MAGAZINE_BATCH pages from the stack
+        ///     into the provided TLS block's magazine while holding the lock
+        ///     only once for the entire batch. Pages are taken from the
+        ///     PP's node first.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_CONCEPT>
+        constexpr void
+        refill(TLS_CONCEPT &tls) &noexcept
+        {
+            bsl::safe_uintmax count{tls.page_pool_magazine_count};
+            auto const node{this->node_of(tls)};
+            lock_guard_t lock{m_lock};
+
+            for (bsl::safe_uintmax i{}; i < details::PAGE_POOL_MAGAZINE_BATCH; ++i) {
+                auto *const elem{tls.page_pool_magazine.at_if(count)};
+                if (nullptr == elem) {
+                    break;
+                }
+
+                void *const ptr{this->take(node, false)};
+                if (nullptr == ptr) {
+                    break;
+                }
+
+                *elem = ptr;
+                ++count;
+            }
+
+            tls.page_pool_magazine_count = count.get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves up to PAGE_POOL_MAGAZINE_BATCH pages from the
+        ///     provided TLS block's magazine back onto the PP's node's stack
+        ///     while holding the lock only once for the entire batch.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_CONCEPT>
+        constexpr void
+        drain(TLS_CONCEPT &tls) &noexcept
+        {
+            bsl::safe_uintmax count{tls.page_pool_magazine_count};
+            auto const node{this->node_of(tls)};
+            lock_guard_t lock{m_lock};
+
+            for (bsl::safe_uintmax i{}; i < details::PAGE_POOL_MAGAZINE_BATCH; ++i) {
+                if (count.is_zero()) {
+                    break;
+                }
+
+                --count;
+                this->give(node, *tls.page_pool_magazine.at_if(count));
+            }
+
+            tls.page_pool_magazine_count = count.get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Pops a tagged page from the provided TLS block's
+        ///     magazine, refilling the magazine first if it is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @return Returns a tagged pointer to the page, or a nullptr
+        ///     if the page pool is out of pages.
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        magazine_pop(TLS_CONCEPT &tls) &noexcept -> void *
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "page_pool_t not initialized\n" << bsl::here();
+                return nullptr;
+            }
+
+            bsl::safe_uintmax count{tls.page_pool_magazine_count};
+            if (count.is_zero()) {
+                this->refill(tls);
+                count = tls.page_pool_magazine_count;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (bsl::unlikely(count.is_zero())) {
+                this->record_failure();
+                bsl::error() << "page pool out of pages\n" << bsl::here();
+                return nullptr;
+            }
+
+            --count;
+            tls.page_pool_magazine_count = count.get();
+
+            return *tls.page_pool_magazine.at_if(count);
+        }
 
     public:
         /// <!-- description -->
@@ -113,19 +745,35 @@ namespace mk
         constexpr page_pool_t() noexcept = default;
 
         /// <!-- description -->
-        ///   @brief Creates the page pool given a mutable_buffer_t to
-        ///     the page pool as well as the virtual address base of the
-        ///     page pool which is used for virt to phys translations.
+        ///   @brief Creates the page pool given the page pool of each node
+        ///     as well as the virtual address base of the page pool which
+        ///     is used for virt to phys translations, the node that
+        ///     each PP belongs to, the page the loader uses to donate
+        ///     pages while the microkernel is running and the page the
+        ///     page pool reports its stats in.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param pool the mutable_buffer_t of the page pool
+        ///   @tparam POOLS_CONCEPT the type of array containing the page
+        ///     pool of each node provided by the loader
+        ///   @tparam PP_TO_NODE_CONCEPT the type of array containing the
+        ///     node of each PP provided by the loader
+        ///   @param pools the page pool of each node
         ///   @param base_virt the base virtual address base of the page pool
+        ///   @param pp_to_node the node that each PP belongs to
+        ///   @param donations the page the loader uses to donate pages. If
+        ///     this is a nullptr, the page pool cannot grow.
+        ///   @param stats the page the page pool reports its stats in
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename POOLS_CONCEPT, typename PP_TO_NODE_CONCEPT>
         [[nodiscard]] constexpr auto
-        initialize(bsl::span<bsl::byte> &pool, bsl::safe_uintmax const &base_virt) &noexcept
-            -> bsl::errc_type
+        initialize(
+            POOLS_CONCEPT &pools,
+            bsl::safe_uintmax const &base_virt,
+            PP_TO_NODE_CONCEPT const &pp_to_node,
+            loader::page_pool_donations_t const *const donations,
+            loader::page_pool_stats_t *const stats) &noexcept -> bsl::errc_type
         {
             if (bsl::unlikely(m_initialized)) {
                 bsl::error() << "page_pool_t already initialized\n" << bsl::here();
@@ -136,27 +784,66 @@ namespace mk
                 this->release();
             }};
 
-            if (bsl::unlikely(pool.empty())) {
-                m_head = nullptr;
-                m_size = bsl::safe_uintmax::zero(true);
-                m_base_virt = bsl::safe_uintmax::zero(true);
+            if (bsl::unlikely(pools.size() != m_nodes.size())) {
+                bsl::error() << "invalid pools\n" << bsl::here();
+                return bsl::errc_failure;
+            }
 
-                bsl::error() << "pool is empty\n" << bsl::here();
+            if (bsl::unlikely(pp_to_node.size() != m_pp_to_node.size())) {
+                bsl::error() << "invalid pp_to_node\n" << bsl::here();
                 return bsl::errc_failure;
             }
 
             if (bsl::unlikely(base_virt.is_zero())) {
-                m_head = nullptr;
-                m_size = bsl::safe_uintmax::zero(true);
-                m_base_virt = bsl::safe_uintmax::zero(true);
-
                 bsl::error() << "base_virt is 0 or invalid\n" << bsl::here();
                 return bsl::errc_failure;
             }
 
-            m_head = pool.data();
-            m_size = pool.size();
+            if (bsl::unlikely(nullptr == stats)) {
+                bsl::error() << "invalid stats\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            m_size = {};
+            for (auto const node : m_nodes) {
+                auto &pool{*pools.at_if(node.index)};
+
+                node.data->head = nullptr;
+                node.data->dirty_head = nullptr;
+                node.data->runs = static_cast<loader::page_pool_run_t *>(
+                    static_cast<void *>(pool.data()));
+                node.data->bump = {};
+                node.data->bump_end = {};
+
+                m_size += pool.size();
+            }
+
+            if (bsl::unlikely(m_size.is_zero())) {
+                bsl::error() << "pool is empty\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            for (auto const pp : m_pp_to_node) {
+                auto const node{*pp_to_node.at_if(pp.index)};
+                if (bsl::unlikely(bsl::to_umax(node) >= m_nodes.size())) {
+                    bsl::error() << "invalid node "       // --
+                                 << bsl::to_umax(node)    // --
+                                 << " for pp "            // --
+                                 << bsl::hex(pp.index)    // --
+                                 << bsl::endl             // --
+                                 << bsl::here();          // --
+
+                    return bsl::errc_failure;
+                }
+
+                *pp.data = node;
+            }
+
             m_base_virt = base_virt;
+            m_donations = donations;
+            m_absorbed = {};
+            m_stats = stats;
+            this->publish_total();
 
             release_on_error.ignore();
             m_initialized = true;
@@ -170,9 +857,13 @@ namespace mk
         constexpr void
         release() &noexcept
         {
+            m_stats = {};
+            m_absorbed = bsl::safe_uintmax::zero(true);
+            m_donations = {};
             m_base_virt = bsl::safe_uintmax::zero(true);
             m_size = bsl::safe_uintmax::zero(true);
-            m_head = {};
+            m_pp_to_node = {};
+            m_nodes = {};
 
             m_initialized = {};
         }
@@ -219,48 +910,86 @@ namespace mk
             -> page_pool_t & = default;
 
         /// <!-- description -->
-        ///   @brief Allocates a page from the page pool.
+        ///   @brief Allocates a zeroed page from the page pool.
         ///
         /// <!-- inputs/outputs -->
         ///   @tparam T the type of pointer to return
+        ///   @param owner the owner to charge the page to
         ///   @return Returns a pointer to the newly allocated page
         ///
         template<typename T>
         [[nodiscard]] constexpr auto
-        allocate() &noexcept -> T *
+        allocate(bsl::safe_uintmax const &owner) &noexcept -> T *
         {
             if (bsl::unlikely(!m_initialized)) {
                 bsl::error() << "page_pool_t not initialized\n" << bsl::here();
                 return nullptr;
             }
 
-            if (bsl::unlikely(nullptr == m_head)) {
+            void *ptr{};
+            {
+                lock_guard_t lock{m_lock};
+                ptr = this->take({}, false);
+            }
+
+            if (bsl::unlikely(nullptr == ptr)) {
+                this->record_failure();
                 bsl::error() << "page pool out of pages\n" << bsl::here();
                 return nullptr;
             }
 
-            void *const ptr{m_head};
-            m_head = *static_cast<void **>(m_head);
+            this->charge(owner);
+            return prepare<T>(ptr, true);
+        }
 
-            bsl::builtin_memset(ptr, '\0', PAGE_SIZE);
+        /// <!-- description -->
+        ///   @brief Allocates a page from the page pool without zeroing
+        ///     it or constructing T. The contents of the resulting page are
+        ///     undefined, so this should only be used by code that will
+        ///     initialize the entire page itself.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to return
+        ///   @param owner the owner to charge the page to
+        ///   @return Returns a pointer to the newly allocated page
+        ///
+        template<typename T>
+        [[nodiscard]] constexpr auto
+        allocate_uninit(bsl::safe_uintmax const &owner) &noexcept -> T *
+        {
+            static_assert(bsl::is_void<T>::value || bsl::is_standard_layout<T>::value);
 
-            if constexpr (!bsl::is_void<T>::value) {
-                static_assert(bsl::is_standard_layout<T>::value, "T must be a standard layout");
-                bsl::construct_at<T>(ptr);
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "page_pool_t not initialized\n" << bsl::here();
+                return nullptr;
             }
 
-            return static_cast<T *>(ptr);
+            void *ptr{};
+            {
+                lock_guard_t lock{m_lock};
+                ptr = this->take({}, true);
+            }
+
+            if (bsl::unlikely(nullptr == ptr)) {
+                this->record_failure();
+                bsl::error() << "page pool out of pages\n" << bsl::here();
+                return nullptr;
+            }
+
+            this->charge(owner);
+            return prepare<T>(ptr, false);
         }
 
         /// <!-- description -->
         ///   @brief Returns a page previously allocated using the allocate
-        ///     function to the page pool.
+        ///     function to the page pool. The page is considered dirty.
         ///
         /// <!-- inputs/outputs -->
         ///   @param ptr the pointer to the page to deallocate
+        ///   @param owner the owner the page was charged to
         ///
         constexpr void
-        deallocate(void *const ptr) &noexcept
+        deallocate(void *const ptr, bsl::safe_uintmax const &owner) &noexcept
         {
             if (bsl::unlikely(!m_initialized)) {
                 bsl::error() << "page_pool_t not initialized\n" << bsl::here();
@@ -277,8 +1006,199 @@ namespace mk
             ///   error and return
             ///
 
-            *static_cast<void **>(ptr) = m_head;
-            m_head = ptr;
+            this->credit(owner);
+
+            lock_guard_t lock{m_lock};
+            this->give({}, tag_dirty(ptr));
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates a zeroed page from the provided TLS block's
+        ///     magazine, refilling the magazine from the page pool in a
+        ///     single batch if the magazine is empty. This is the version
+        ///     of allocate that should be used by any code that has access
+        ///     to the current TLS block, as the common case touches no
+        ///     shared state.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to return
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param owner the owner to charge the page to
+        ///   @return Returns a pointer to the newly allocated page
+        ///
+        template<typename T, typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        allocate(TLS_CONCEPT &tls, bsl::safe_uintmax const &owner) &noexcept -> T *
+        {
+            void *const ptr{this->magazine_pop(tls)};
+            if (bsl::unlikely(nullptr == ptr)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return nullptr;
+            }
+
+            this->charge(owner);
+            return prepare<T>(ptr, true);
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates a page from the provided TLS block's magazine
+        ///     without zeroing it or constructing T. The contents of the
+        ///     resulting page are undefined, so this should only be used by
+        ///     code that will initialize the entire page itself.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of pointer to return
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param owner the owner to charge the page to
+        ///   @return Returns a pointer to the newly allocated page
+        ///
+        template<typename T, typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        allocate_uninit(TLS_CONCEPT &tls, bsl::safe_uintmax const &owner) &noexcept -> T *
+        {
+            static_assert(bsl::is_void<T>::value || bsl::is_standard_layout<T>::value);
+
+            void *const ptr{this->magazine_pop(tls)};
+            if (bsl::unlikely(nullptr == ptr)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return nullptr;
+            }
+
+            this->charge(owner);
+            return prepare<T>(ptr, false);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a page previously allocated using one of the
+        ///     allocate functions to the provided TLS block's magazine,
+        ///     draining a batch of pages back to the page pool if the
+        ///     magazine is full. The page is considered dirty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param ptr the pointer to the page to deallocate
+        ///   @param owner the owner the page was charged to
+        ///
+        template<typename TLS_CONCEPT>
+        constexpr void
+        deallocate(TLS_CONCEPT &tls, void *const ptr, bsl::safe_uintmax const &owner) &noexcept
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "page_pool_t not initialized\n" << bsl::here();
+                return;
+            }
+
+            if (bsl::unlikely(nullptr == ptr)) {
+                return;
+            }
+
+            this->credit(owner);
+
+            bsl::safe_uintmax count{tls.page_pool_magazine_count};
+            if (count == tls.page_pool_magazine.size()) {
+                this->drain(tls);
+                count = tls.page_pool_magazine_count;
+            }
+            else {
+                bsl::touch();
+            }
+
+            *tls.page_pool_magazine.at_if(count) = tag_dirty(ptr);
+            ++count;
+
+            tls.page_pool_magazine_count = count.get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Zeros up to "num" dirty pages, moving them from the
+        ///     dirty stack to the zeroed stack. This is called when a PP
+        ///     has nothing better to do (i.e., from bf_callback_op_wait)
+        ///     so that later calls to allocate() do not have to zero pages
+        ///     on the caller's path. Each page stays with the node it was
+        ///     taken from. The lock is not held while a page is being
+        ///     zeroed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param num the max number of pages to zero
+        ///   @return Returns the number of pages that were zeroed
+        ///
+        constexpr auto
+        scrub(bsl::safe_uintmax const &num) &noexcept -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax scrubbed{};
+
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "page_pool_t not initialized\n" << bsl::here();
+                return scrubbed;
+            }
+
+            for (auto const node : m_nodes) {
+                while (scrubbed < num) {
+                    void *ptr{};
+                    {
+                        lock_guard_t lock{m_lock};
+                        ptr = pop(node.data->dirty_head);
+                    }
+
+                    if (nullptr == ptr) {
+                        break;
+                    }
+
+                    bsl::builtin_memset(ptr, '\0', PAGE_SIZE);
+
+                    {
+                        lock_guard_t lock{m_lock};
+                        push(node.data->head, ptr);
+                    }
+
+                    ++scrubbed;
+                }
+            }
+
+            return scrubbed;
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the page pool's stats (in pages) to the console
+        ///
+        constexpr void
+        dump() const &noexcept
+        {
+            constexpr bsl::safe_uintmax owner_ext{loader::PAGE_POOL_OWNER_EXT};
+
+            if constexpr (BSL_DEBUG_LEVEL == bsl::ZERO_UMAX) {
+                return;
+            }
+
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "page_pool_t not initialized\n" << bsl::here();
+                return;
+            }
+
+            bsl::print<bsl::V>() << bsl::bold_magenta << "Page Pool Dump: " << bsl::reset_color;
+            bsl::print<bsl::V>() << bsl::endl;
+
+            bsl::print<bsl::V>() << "  total:      " << bsl::hex(m_stats->total) << bsl::endl;
+            bsl::print<bsl::V>() << "  used:       " << bsl::hex(m_stats->used) << bsl::endl;
+            bsl::print<bsl::V>() << "  high water: " << bsl::hex(m_stats->high_water) << bsl::endl;
+            bsl::print<bsl::V>() << "  failures:   " << bsl::hex(m_stats->failures) << bsl::endl;
+
+            for (auto const owner : m_stats->owners) {
+                if (owner.index == loader::PAGE_POOL_OWNER_MK) {
+                    bsl::print<bsl::V>() << "  mk:         ";
+                }
+                else if (owner.index == loader::PAGE_POOL_OWNER_VPS) {
+                    bsl::print<bsl::V>() << "  vps:        ";
+                }
+                else {
+                    bsl::print<bsl::V>() << "  ext " << (owner.index - owner_ext) << ":      ";
+                }
+
+                bsl::print<bsl::V>() << bsl::hex(*owner.data) << bsl::endl;
+            }
         }
 
         /// <!-- description -->
@@ -0,0 +1,465 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SLAB_POOL_T_HPP
+#define SLAB_POOL_T_HPP
+
+#include <lock_guard_t.hpp>
+#include <page_pool_stats_t.hpp>
+#include <spinlock_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/construct_at.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/cstring.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    namespace details
+    {
+        /// @brief defines the number of size classes supported by the slab pool
+        constexpr bsl::safe_uintmax SLAB_POOL_NUM_CLASSES{bsl::to_umax(6U)};
+        /// @brief defines the size of the smallest size class
+        constexpr bsl::safe_uintmax SLAB_POOL_MIN_SIZE{bsl::to_umax(64U)};
+        /// @brief defines the number of bytes reserved for the slab header
+        constexpr bsl::safe_uintmax SLAB_POOL_HEADER_SIZE{bsl::to_umax(64U)};
+
+        /// @struct mk::details::slab_t
+        ///
+        /// <!-- description -->
+        ///   @brief Defines the header that is stored at the beginning of
+        ///     each slab (a single page from the page pool).
+        ///
+        struct slab_t final
+        {
+            /// @brief stores the next slab in the owner's partial list
+            slab_t *next;
+            /// @brief stores the previous slab in the owner's partial list
+            slab_t *prev;
+            /// @brief stores the head of the slab's free object list
+            void *free;
+            /// @brief stores the number of objects allocated from this slab
+            bsl::uintmax used;
+            /// @brief stores the size class this slab belongs to
+            bsl::uintmax size_class;
+            /// @brief stores the ID of the PP that owns this slab
+            bsl::uintmax ppid;
+        };
+
+        /// @struct mk::details::slab_pool_pp_t
+        ///
+        /// <!-- description -->
+        ///   @brief Defines the state of the slab pool that is owned by
+        ///     a single PP.
+        ///
+        struct slab_pool_pp_t final
+        {
+            /// @brief protects the partial lists and the owned slabs
+            spinlock_t lock;
+            /// @brief stores the slabs with free objects (one list per size class)
+            bsl::array<slab_t *, SLAB_POOL_NUM_CLASSES.get()> partial;
+        };
+    }
+
+    /// @class mk::slab_pool_t
+    ///
+    /// <!-- description -->
+    ///   @brief The slab pool is responsible for allocating and freeing
+    ///     objects that are smaller than a page. Objects are grouped into
+    ///     size classes (64, 128, 256, 512 and 1024 bytes, plus a largest
+    ///     class that fits two objects in a slab, which is just under 2k
+    ///     when the page size is 4k), and each size class is backed by
+    ///     slabs, each of which is a single page from the page pool that
+    ///     is carved up into objects of the same size. The slab's header
+    ///     lives at the beginning of the page, which means the slab that
+    ///     an object belongs to can always be found by page aligning the
+    ///     object's address (i.e., no lookups are needed to deallocate).
+    ///     Objects are always 64 byte (cache line) aligned.
+    ///
+    ///     Each PP owns its own list of partially used slabs for each size
+    ///     class. Allocations are always served from the allocating PP's
+    ///     lists, which keeps objects allocated by a PP close together
+    ///     and keeps PPs from touching each other's cache lines. Each PP's
+    ///     lists are protected by a lock that is only contended when an
+    ///     object is freed on a PP other than the one that allocated it.
+    ///     Full slabs are not on any list, and empty slabs are returned to
+    ///     the page pool, unless the slab is the only partial slab that
+    ///     the PP has for that size class.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam PAGE_POOL_CONCEPT defines the type of page pool to use
+    ///   @tparam PAGE_SIZE defines the size of a page
+    ///   @tparam MAX_PPS the max number of PPs supported
+    ///
+    template<typename PAGE_POOL_CONCEPT, bsl::uintmax PAGE_SIZE, bsl::uintmax MAX_PPS>
+    class slab_pool_t final
+    {
+        /// @brief stores a reference to the page pool to use
+        PAGE_POOL_CONCEPT &m_page_pool;
+        /// @brief stores the per-PP state of the slab pool
+        bsl::array<details::slab_pool_pp_t, MAX_PPS> m_pps;
+
+        static_assert(sizeof(details::slab_t) <= details::SLAB_POOL_HEADER_SIZE);
+
+        /// <!-- description -->
+        ///   @brief Returns the size of the objects in the provided size
+        ///     class.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param size_class the size class to query
+        ///   @return Returns the size of the objects in the provided size
+        ///     class.
+        ///
+        [[nodiscard]] static constexpr auto
+        class_to_size(bsl::safe_uintmax const &size_class) noexcept -> bsl::safe_uintmax
+        {
+            constexpr auto last{details::SLAB_POOL_NUM_CLASSES - bsl::ONE_UMAX};
+            if (size_class == last) {
+                constexpr auto two{bsl::to_umax(2U)};
+                return (bsl::to_umax(PAGE_SIZE) - details::SLAB_POOL_HEADER_SIZE) / two;
+            }
+
+            return details::SLAB_POOL_MIN_SIZE << size_class;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the smallest size class that can hold an
+        ///     object of the provided size, or an invalid size class if
+        ///     the object is too large.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param size the size of the object
+        ///   @return Returns the smallest size class that can hold an
+        ///     object of the provided size, or an invalid size class if
+        ///     the object is too large.
+        ///
+        [[nodiscard]] static constexpr auto
+        size_to_class(bsl::safe_uintmax const &size) noexcept -> bsl::safe_uintmax
+        {
+            for (bsl::safe_uintmax i{}; i < details::SLAB_POOL_NUM_CLASSES; ++i) {
+                if (!(size > class_to_size(i))) {
+                    return i;
+                }
+            }
+
+            return bsl::safe_uintmax::zero(true);
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a slab to the front of the provided partial list.
+        ///     The caller must hold the owner's lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param head the head of the partial list
+        ///   @param slab the slab to add
+        ///
+        static constexpr void
+        push(details::slab_t *&head, details::slab_t *const slab) noexcept
+        {
+            slab->prev = nullptr;
+            slab->next = head;
+
+            if (nullptr != head) {
+                head->prev = slab;
+            }
+            else {
+                bsl::touch();
+            }
+
+            head = slab;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes a slab from the provided partial list. The
+        ///     caller must hold the owner's lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param head the head of the partial list
+        ///   @param slab the slab to remove
+        ///
+        static constexpr void
+        remove(details::slab_t *&head, details::slab_t *const slab) noexcept
+        {
+            if (nullptr != slab->prev) {
+                slab->prev->next = slab->next;
+            }
+            else {
+                head = slab->next;
+            }
+
+            if (nullptr != slab->next) {
+                slab->next->prev = slab->prev;
+            }
+            else {
+                bsl::touch();
+            }
+
+            slab->next = nullptr;
+            slab->prev = nullptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Allocates a new slab from the page pool and carves it
+        ///     up into objects of the provided size class.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param size_class the size class of the new slab
+        ///   @return Returns the new slab, or a nullptr on failure
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        new_slab(TLS_CONCEPT &tls, bsl::safe_uintmax const &size_class) &noexcept
+            -> details::slab_t *
+        {
+            auto *const page{
+                m_page_pool.template allocate_uninit<void>(tls, loader::PAGE_POOL_OWNER_MK)};
+            if (bsl::unlikely(nullptr == page)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return nullptr;
+            }
+
+            auto *const slab{static_cast<details::slab_t *>(page)};
+            slab->next = nullptr;
+            slab->prev = nullptr;
+            slab->free = nullptr;
+            slab->used = {};
+            slab->size_class = size_class.get();
+            slab->ppid = bsl::to_umax(tls.ppid()).get();
+
+            auto const size{class_to_size(size_class)};
+            auto const last{bsl::to_umax(page) + bsl::to_umax(PAGE_SIZE) - size};
+
+            auto obj{bsl::to_umax(page) + details::SLAB_POOL_HEADER_SIZE};
+            while (!(obj > last)) {
+                *bsl::to_ptr<void **>(obj) = slab->free;
+                slab->free = bsl::to_ptr<void *>(obj);
+                obj += size;
+            }
+
+            return slab;
+        }
+
+    public:
+        /// @brief an alias for PAGE_POOL_CONCEPT
+        using page_pool_type = PAGE_POOL_CONCEPT;
+
+        /// <!-- description -->
+        ///   @brief Creates a slab_pool_t
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_pool the page pool to use
+        ///
+        explicit constexpr slab_pool_t(PAGE_POOL_CONCEPT &page_pool) noexcept
+            : m_page_pool{page_pool}, m_pps{}
+        {}
+
+        /// <!-- description -->
+        ///   @brief Destroyes a previously created slab_pool_t
+        ///
+        constexpr ~slab_pool_t() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr slab_pool_t(slab_pool_t const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///
+        constexpr slab_pool_t(slab_pool_t &&o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(slab_pool_t const &o) &noexcept
+            -> slab_pool_t & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(slab_pool_t &&o) &noexcept
+            -> slab_pool_t & = default;
+
+        /// <!-- description -->
+        ///   @brief Allocates a zeroed object of type T from the calling
+        ///     PP's slabs, and constructs it. T must fit in the largest size
+        ///     class. Anything larger should be allocated from the page
+        ///     pool instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of object to allocate
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @return Returns a pointer to the newly allocated object, or a
+        ///     nullptr on failure.
+        ///
+        template<typename T, typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        allocate(TLS_CONCEPT &tls) &noexcept -> T *
+        {
+            constexpr auto last{details::SLAB_POOL_NUM_CLASSES - bsl::ONE_UMAX};
+            static_assert(sizeof(T) <= class_to_size(last).get());
+
+            constexpr auto size_class{size_to_class(bsl::to_umax(sizeof(T)))};
+
+            auto *const pp{m_pps.at_if(bsl::to_umax(tls.ppid()))};
+            if (bsl::unlikely(nullptr == pp)) {
+                bsl::error() << "invalid ppid: "        // --
+                             << bsl::hex(tls.ppid())    // --
+                             << bsl::endl               // --
+                             << bsl::here();            // --
+
+                return nullptr;
+            }
+
+            void *obj{};
+            {
+                lock_guard_t lock{pp->lock};
+
+                auto **const head{pp->partial.at_if(size_class)};
+                if (nullptr == *head) {
+                    auto *const slab{this->new_slab(tls, size_class)};
+                    if (bsl::unlikely(nullptr == slab)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return nullptr;
+                    }
+
+                    push(*head, slab);
+                }
+                else {
+                    bsl::touch();
+                }
+
+                auto *const slab{*head};
+                obj = slab->free;
+                slab->free = *static_cast<void **>(obj);
+                slab->used = (bsl::to_umax(slab->used) + bsl::ONE_UMAX).get();
+
+                if (nullptr == slab->free) {
+                    remove(*head, slab);
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            bsl::builtin_memset(obj, '\0', sizeof(T));
+            return bsl::construct_at<T>(obj);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an object previously allocated using allocate()
+        ///     to the slab it was allocated from. The object may be freed
+        ///     on any PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of object to deallocate
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param ptr the object to deallocate
+        ///
+        template<typename T, typename TLS_CONCEPT>
+        constexpr void
+        deallocate(TLS_CONCEPT &tls, T *const ptr) &noexcept
+        {
+            if (bsl::unlikely(nullptr == ptr)) {
+                return;
+            }
+
+            auto const page{bsl::to_umax(ptr) & ~(bsl::to_umax(PAGE_SIZE) - bsl::ONE_UMAX)};
+            auto *const slab{bsl::to_ptr<details::slab_t *>(page)};
+
+            auto *const pp{m_pps.at_if(bsl::to_umax(slab->ppid))};
+            if (bsl::unlikely(nullptr == pp)) {
+                bsl::error() << "object "                                // --
+                             << static_cast<void *>(ptr)                 // --
+                             << " was not allocated by the slab pool"    // --
+                             << bsl::endl                                // --
+                             << bsl::here();                             // --
+
+                return;
+            }
+
+            bool release_slab{};
+            {
+                lock_guard_t lock{pp->lock};
+
+                auto **const head{pp->partial.at_if(bsl::to_umax(slab->size_class))};
+                if (nullptr == slab->free) {
+                    push(*head, slab);
+                }
+                else {
+                    bsl::touch();
+                }
+
+                *bsl::to_ptr<void **>(bsl::to_umax(ptr)) = slab->free;
+                slab->free = ptr;
+                slab->used = (bsl::to_umax(slab->used) - bsl::ONE_UMAX).get();
+
+                if (bsl::to_umax(slab->used).is_zero()) {
+                    if ((nullptr != slab->next) || (nullptr != slab->prev)) {
+                        remove(*head, slab);
+                        release_slab = true;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            if (release_slab) {
+                m_page_pool.deallocate(tls, slab, loader::PAGE_POOL_OWNER_MK);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,156 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SYSCALL_TRACE_HPP
+#define SYSCALL_TRACE_HPP
+
+#include <syscall_trace_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// @brief true if the microkernel was built with HYPERVISOR_SYSCALL_TRACE
+    constexpr bool SYSCALL_TRACE_ENABLED{
+        bsl::ZERO_UMAX != bsl::to_umax(HYPERVISOR_SYSCALL_TRACE)};
+
+    /// NOTE:
+    /// - When HYPERVISOR_SYSCALL_TRACE is enabled, every syscall is
+    ///   recorded into the syscall trace of the PP it was made on. A record
+    ///   is opened by syscall_trace_begin when the syscall enters the
+    ///   microkernel and is closed by syscall_trace_end when it returns.
+    /// - The run syscalls never return to the extension. Their records are
+    ///   closed by syscall_trace_resume right before the VPS is run, which
+    ///   is the point at which the syscall actually finished. A record that
+    ///   is never closed (e.g., a syscall that fast failed) keeps a tsc_end
+    ///   of 0.
+    /// - Each PP owns its own trace, so none of this needs to be atomic.
+    ///   When the feature is disabled, all of these functions compile down
+    ///   to nothing.
+    ///
+
+    /// <!-- description -->
+    ///   @brief Opens a new record in the current PP's syscall trace for
+    ///     the syscall that the extension just made.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @tparam EXT_CONCEPT defines the type of ext_t to use
+    ///   @param tls the current TLS block
+    ///   @param ext the extension that made the syscall
+    ///
+    template<typename TLS_CONCEPT, typename EXT_CONCEPT>
+    constexpr void
+    syscall_trace_begin(TLS_CONCEPT &tls, EXT_CONCEPT const &ext) noexcept
+    {
+        if constexpr (!SYSCALL_TRACE_ENABLED) {
+            return;
+        }
+
+        auto *const trace{tls.syscall_trace};
+        if (nullptr == trace) {
+            return;
+        }
+
+        auto const total{bsl::to_u64(trace->total)};
+        auto *const rec{trace->records.at_if(total % loader::SYSCALL_TRACE_SIZE)};
+        if (bsl::unlikely(nullptr == rec)) {
+            bsl::error() << "syscall trace is corrupt\n" << bsl::here();
+            return;
+        }
+
+        rec->syscall = tls.ext_syscall;
+        rec->tsc_begin = EXT_CONCEPT::intrinsic_type::rdtsc().get();
+        rec->tsc_end = {};
+        rec->ppid = tls.ppid().get();
+        rec->vpsid = tls.active_vpsid;
+
+        if (ext.is_handle_valid(tls.ext_reg0)) {
+            rec->handle_valid = static_cast<bsl::uint8>(1);
+        }
+        else {
+            rec->handle_valid = {};
+        }
+
+        trace->total = (total + bsl::ONE_U64).get();
+        tls.syscall_trace_rec = rec;
+    }
+
+    /// <!-- description -->
+    ///   @brief Closes the current PP's open syscall trace record (if
+    ///     there is one) using the provided TSC.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @param tls the current TLS block
+    ///   @param tsc the TSC when the syscall finished
+    ///
+    template<typename TLS_CONCEPT>
+    constexpr void
+    syscall_trace_resume(TLS_CONCEPT &tls, bsl::safe_uintmax const &tsc) noexcept
+    {
+        if constexpr (!SYSCALL_TRACE_ENABLED) {
+            return;
+        }
+
+        auto *const rec{tls.syscall_trace_rec};
+        if (nullptr == rec) {
+            return;
+        }
+
+        rec->tsc_end = tsc.get();
+        tls.syscall_trace_rec = nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Closes the current PP's open syscall trace record as the
+    ///     syscall returns to the extension.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @param tls the current TLS block
+    ///
+    template<typename INTRINSIC_CONCEPT, typename TLS_CONCEPT>
+    constexpr void
+    syscall_trace_end(TLS_CONCEPT &tls) noexcept
+    {
+        if constexpr (!SYSCALL_TRACE_ENABLED) {
+            return;
+        }
+
+        if (nullptr == tls.syscall_trace_rec) {
+            return;
+        }
+
+        syscall_trace_resume(tls, INTRINSIC_CONCEPT::rdtsc());
+    }
+}
+
+#endif
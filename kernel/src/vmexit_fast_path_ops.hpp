@@ -0,0 +1,284 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMEXIT_FAST_PATH_OPS_HPP
+#define VMEXIT_FAST_PATH_OPS_HPP
+
+#include <fast_path_t.hpp>
+#include <mk_interface.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    namespace details
+    {
+        /// @brief defines the mask used to get the lower 32 bits of a GPR
+        constexpr bsl::safe_uintmax FAST_PATH_GPR32_MASK{bsl::to_umax(0x00000000FFFFFFFFU)};
+        /// @brief defines the shift used to get the upper 32 bits of an MSR
+        constexpr bsl::safe_uintmax FAST_PATH_MSR_SHIFT{bsl::to_umax(32U)};
+
+        /// <!-- description -->
+        ///   @brief Emulates a CPUID VMExit for the active VPS if the leaf
+        ///     and subleaf are found in the fast path table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+        ///   @param tls the current TLS block
+        ///   @param vps_pool the VPS pool to use
+        ///   @param fast_path the fast path table to use
+        ///   @return Returns fast_path_status_t::handled if the VMExit was
+        ///     handled, fast_path_status_t::unhandled if it must be given to
+        ///     the extension, or fast_path_status_t::failed if the VMExit
+        ///     was only partially emulated.
+        ///
+        template<typename INTRINSIC_CONCEPT, typename TLS_CONCEPT, typename VPS_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        vmexit_fast_path_cpuid(
+            TLS_CONCEPT &tls, VPS_POOL_CONCEPT &vps_pool, fast_path_t const &fast_path) noexcept
+            -> fast_path_status_t
+        {
+            auto const vpsid{tls.active_vpsid};
+
+            auto const rax{vps_pool.read_reg(tls, vpsid, syscall::bf_reg_t::bf_reg_t_rax)};
+            auto const rcx{vps_pool.read_reg(tls, vpsid, syscall::bf_reg_t::bf_reg_t_rcx)};
+            if (bsl::unlikely((!rax) || (!rcx))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::unhandled;
+            }
+
+            bsl::safe_uintmax eax{rax & FAST_PATH_GPR32_MASK};
+            bsl::safe_uintmax ebx{};
+            bsl::safe_uintmax ecx{rcx & FAST_PATH_GPR32_MASK};
+            bsl::safe_uintmax edx{};
+
+            auto const *const entry{fast_path.cpuid(eax, ecx)};
+            if (nullptr == entry) {
+                return fast_path_status_t::unhandled;
+            }
+
+            INTRINSIC_CONCEPT::cpuid(eax, ebx, ecx, edx);
+
+            eax &= ~bsl::to_umax(entry->eax_clear);
+            eax |= bsl::to_umax(entry->eax_set) & FAST_PATH_GPR32_MASK;
+            ebx &= ~bsl::to_umax(entry->ebx_clear);
+            ebx |= bsl::to_umax(entry->ebx_set) & FAST_PATH_GPR32_MASK;
+            ecx &= ~bsl::to_umax(entry->ecx_clear);
+            ecx |= bsl::to_umax(entry->ecx_set) & FAST_PATH_GPR32_MASK;
+            edx &= ~bsl::to_umax(entry->edx_clear);
+            edx |= bsl::to_umax(entry->edx_set) & FAST_PATH_GPR32_MASK;
+
+            /// NOTE:
+            /// - The results are staged above, and nothing has touched the
+            ///   VPS yet, so up to here the VMExit can still be given to
+            ///   the extension. advance_ip() only changes the VPS once it
+            ///   cannot fail, so it goes first. After that, the VMExit has
+            ///   been partially emulated, so any failure is fatal.
+            ///
+
+            bsl::errc_type ret{};
+            ret = vps_pool.advance_ip(tls, vpsid);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::unhandled;
+            }
+
+            ret = vps_pool.write_reg(tls, vpsid, syscall::bf_reg_t::bf_reg_t_rax, eax);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::failed;
+            }
+
+            ret = vps_pool.write_reg(tls, vpsid, syscall::bf_reg_t::bf_reg_t_rbx, ebx);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::failed;
+            }
+
+            ret = vps_pool.write_reg(tls, vpsid, syscall::bf_reg_t::bf_reg_t_rcx, ecx);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::failed;
+            }
+
+            ret = vps_pool.write_reg(tls, vpsid, syscall::bf_reg_t::bf_reg_t_rdx, edx);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::failed;
+            }
+
+            return fast_path_status_t::handled;
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates a RDMSR VMExit for the active VPS if the MSR is
+        ///     found in the fast path table's rdmsr list. If the RDMSR
+        ///     faults, the VMExit is given to the extension so that it can
+        ///     decide what to do (e.g., inject a #GP).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+        ///   @param tls the current TLS block
+        ///   @param vps_pool the VPS pool to use
+        ///   @param fast_path the fast path table to use
+        ///   @return Returns fast_path_status_t::handled if the VMExit was
+        ///     handled, fast_path_status_t::unhandled if it must be given to
+        ///     the extension, or fast_path_status_t::failed if the VMExit
+        ///     was only partially emulated.
+        ///
+        template<typename INTRINSIC_CONCEPT, typename TLS_CONCEPT, typename VPS_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        vmexit_fast_path_rdmsr(
+            TLS_CONCEPT &tls, VPS_POOL_CONCEPT &vps_pool, fast_path_t const &fast_path) noexcept
+            -> fast_path_status_t
+        {
+            auto const vpsid{tls.active_vpsid};
+
+            auto const rcx{vps_pool.read_reg(tls, vpsid, syscall::bf_reg_t::bf_reg_t_rcx)};
+            if (bsl::unlikely(!rcx)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::unhandled;
+            }
+
+            auto const msr{rcx & FAST_PATH_GPR32_MASK};
+            if (!fast_path.is_rdmsr_passthrough(msr)) {
+                return fast_path_status_t::unhandled;
+            }
+
+            auto const val{bsl::to_umax(INTRINSIC_CONCEPT::rdmsr(bsl::to_u32_unsafe(msr)))};
+            if (bsl::unlikely(!val)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::unhandled;
+            }
+
+            /// NOTE:
+            /// - Like CPUID, the IP is advanced first, and any failure
+            ///   after that is fatal.
+            ///
+
+            bsl::errc_type ret{};
+            ret = vps_pool.advance_ip(tls, vpsid);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::unhandled;
+            }
+
+            ret = vps_pool.write_reg(
+                tls, vpsid, syscall::bf_reg_t::bf_reg_t_rax, val & FAST_PATH_GPR32_MASK);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::failed;
+            }
+
+            ret = vps_pool.write_reg(
+                tls, vpsid, syscall::bf_reg_t::bf_reg_t_rdx, val >> FAST_PATH_MSR_SHIFT);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::failed;
+            }
+
+            return fast_path_status_t::handled;
+        }
+
+        /// <!-- description -->
+        ///   @brief Emulates a WRMSR VMExit for the active VPS if the MSR is
+        ///     found in the fast path table's wrmsr list. If the WRMSR
+        ///     faults, the VMExit is given to the extension so that it can
+        ///     decide what to do (e.g., inject a #GP).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+        ///   @param tls the current TLS block
+        ///   @param vps_pool the VPS pool to use
+        ///   @param fast_path the fast path table to use
+        ///   @return Returns fast_path_status_t::handled if the VMExit was
+        ///     handled, fast_path_status_t::unhandled if it must be given to
+        ///     the extension, or fast_path_status_t::failed if the VMExit
+        ///     was only partially emulated.
+        ///
+        template<typename INTRINSIC_CONCEPT, typename TLS_CONCEPT, typename VPS_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        vmexit_fast_path_wrmsr(
+            TLS_CONCEPT &tls, VPS_POOL_CONCEPT &vps_pool, fast_path_t const &fast_path) noexcept
+            -> fast_path_status_t
+        {
+            auto const vpsid{tls.active_vpsid};
+
+            auto const rcx{vps_pool.read_reg(tls, vpsid, syscall::bf_reg_t::bf_reg_t_rcx)};
+            if (bsl::unlikely(!rcx)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::unhandled;
+            }
+
+            auto const msr{rcx & FAST_PATH_GPR32_MASK};
+            if (!fast_path.is_wrmsr_passthrough(msr)) {
+                return fast_path_status_t::unhandled;
+            }
+
+            auto const rax{vps_pool.read_reg(tls, vpsid, syscall::bf_reg_t::bf_reg_t_rax)};
+            auto const rdx{vps_pool.read_reg(tls, vpsid, syscall::bf_reg_t::bf_reg_t_rdx)};
+            if (bsl::unlikely((!rax) || (!rdx))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::unhandled;
+            }
+
+            auto const val{
+                ((rdx & FAST_PATH_GPR32_MASK) << FAST_PATH_MSR_SHIFT) |
+                (rax & FAST_PATH_GPR32_MASK)};
+
+            /// NOTE:
+            /// - A WRMSR that faults did not write anything, so it can still
+            ///   be given to the extension. Once the MSR is written, it
+            ///   cannot be given to the extension again, so failing to
+            ///   advance the IP is fatal.
+            ///
+
+            bsl::errc_type ret{};
+            ret = INTRINSIC_CONCEPT::wrmsr(bsl::to_u32_unsafe(msr), bsl::to_u64(val));
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::unhandled;
+            }
+
+            ret = vps_pool.advance_ip(tls, vpsid);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::failed;
+            }
+
+            return fast_path_status_t::handled;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,235 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMEXIT_LOG_HPP
+#define VMEXIT_LOG_HPP
+
+#include <mk_interface.hpp>
+#include <vmexit_log_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// @brief passing this as the VPID to vmexit_log_dump dumps every record
+    constexpr bsl::safe_uint16 VMEXIT_LOG_ALL_VPS{bsl::to_u16(0xFFFFU)};
+
+    /// NOTE:
+    /// - Every VMExit is recorded into the VMExit log of the PP it occurred
+    ///   on. A record is opened by vmexit_log_exit once the VPS returns to
+    ///   the microkernel and is closed by vmexit_log_resume right before
+    ///   the next run. The extension does not have to return from its
+    ///   VMExit handler (it can use one of the run syscalls instead), so
+    ///   the time spent in the extension is computed when the record is
+    ///   closed, using the TSC that vmexit_log_ext saved in the TLS block.
+    /// - These functions are on the VMExit path, so they do not validate
+    ///   the log beyond what is needed to stay in bounds, and they never
+    ///   fail. vmexit_loop reads the TSC once and shares it with the
+    ///   VMExit stats (see vmexit_stats.hpp).
+    ///
+
+    /// <!-- description -->
+    ///   @brief Opens a new record in the current PP's VMExit log.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @param tls the current TLS block
+    ///   @param exit_reason the exit reason of the VMExit being recorded
+    ///   @param tsc the TSC when the VMExit was handed to the microkernel
+    ///
+    template<typename INTRINSIC_CONCEPT, typename TLS_CONCEPT>
+    constexpr void
+    vmexit_log_exit(
+        TLS_CONCEPT &tls,
+        bsl::safe_uintmax const &exit_reason,
+        bsl::safe_uintmax const &tsc) noexcept
+    {
+        auto *const log{tls.vmexit_log};
+        if (nullptr == log) {
+            return;
+        }
+
+        bsl::safe_uintmax pos{log->pos};
+        auto *const rec{log->records.at_if(pos)};
+        if (bsl::unlikely(nullptr == rec)) {
+            bsl::error() << "vmexit log is corrupt\n" << bsl::here();
+            return;
+        }
+
+        rec->exit_reason = exit_reason.get();
+        rec->rip = INTRINSIC_CONCEPT::tls_reg(syscall::TLS_OFFSET_EXIT_RIP).get();
+        rec->tsc_exit = tsc.get();
+        rec->tsc_resume = {};
+        rec->ext_cycles = {};
+        rec->vmid = tls.vmid().get();
+        rec->vpid = tls.vpid().get();
+        rec->vpsid = tls.active_vpsid;
+
+        ++pos;
+        if (pos == log->records.size()) {
+            pos = {};
+        }
+        else {
+            bsl::touch();
+        }
+
+        log->pos = pos.get();
+        log->total = (bsl::to_umax(log->total) + bsl::ONE_UMAX).get();
+
+        tls.vmexit_log_rec = rec;
+        tls.vmexit_log_ext_tsc = {};
+    }
+
+    /// <!-- description -->
+    ///   @brief Marks the point at which the current VMExit was handed to
+    ///     the extension's VMExit handler.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @param tls the current TLS block
+    ///   @param tsc the TSC right before the VMExit handler is called
+    ///
+    template<typename TLS_CONCEPT>
+    constexpr void
+    vmexit_log_ext(TLS_CONCEPT &tls, bsl::safe_uintmax const &tsc) noexcept
+    {
+        if (nullptr == tls.vmexit_log_rec) {
+            return;
+        }
+
+        tls.vmexit_log_ext_tsc = tsc.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Closes the record that vmexit_log_exit opened (if any),
+    ///     as the VPS is about to be resumed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @param tls the current TLS block
+    ///   @param tsc the TSC right before the VPS is resumed
+    ///
+    template<typename TLS_CONCEPT>
+    constexpr void
+    vmexit_log_resume(TLS_CONCEPT &tls, bsl::safe_uintmax const &tsc) noexcept
+    {
+        auto *const rec{tls.vmexit_log_rec};
+        if (nullptr == rec) {
+            return;
+        }
+
+        rec->tsc_resume = tsc.get();
+        if (bsl::ZERO_UMAX != tls.vmexit_log_ext_tsc) {
+            rec->ext_cycles = (tsc - bsl::to_u64(tls.vmexit_log_ext_tsc)).get();
+        }
+        else {
+            bsl::touch();
+        }
+
+        tls.vmexit_log_rec = nullptr;
+    }
+
+    /// <!-- description -->
+    ///   @brief Outputs the current PP's VMExit log to the console, from
+    ///     the oldest record to the newest.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @param tls the current TLS block
+    ///   @param vpid only records from this VP are output. If this is set
+    ///     to VMEXIT_LOG_ALL_VPS, all records are output.
+    ///
+    template<typename TLS_CONCEPT>
+    constexpr void
+    vmexit_log_dump(TLS_CONCEPT &tls, bsl::safe_uint16 const &vpid) noexcept
+    {
+        if constexpr (BSL_DEBUG_LEVEL == bsl::ZERO_UMAX) {
+            return;
+        }
+
+        auto const *const log{tls.vmexit_log};
+        if (bsl::unlikely(nullptr == log)) {
+            bsl::error() << "vmexit log not provided by the loader\n" << bsl::here();
+            return;
+        }
+
+        bsl::safe_uintmax idx{};
+        bsl::safe_uintmax num{log->records.size()};
+        if (bsl::to_umax(log->total) < num) {
+            num = bsl::to_umax(log->total);
+        }
+        else {
+            idx = bsl::to_umax(log->pos);
+        }
+
+        bsl::print() << bsl::bold_magenta << "VMExit Log Dump: " << bsl::reset_color;
+        bsl::print() << "pp " << bsl::hex(tls.ppid()) << ", ";
+        bsl::print() << bsl::hex(log->total) << " total exits" << bsl::endl;
+
+        for (bsl::safe_uintmax i{}; i < num; ++i) {
+            auto const *const rec{log->records.at_if(idx)};
+            if (bsl::unlikely(nullptr == rec)) {
+                bsl::error() << "vmexit log is corrupt\n" << bsl::here();
+                return;
+            }
+
+            ++idx;
+            if (idx == log->records.size()) {
+                idx = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            if ((vpid != VMEXIT_LOG_ALL_VPS) && (vpid != rec->vpid)) {
+                continue;
+            }
+
+            bsl::print() << "  vm " << bsl::hex(rec->vmid);
+            bsl::print() << " vp " << bsl::hex(rec->vpid);
+            bsl::print() << " vps " << bsl::hex(rec->vpsid);
+            bsl::print() << " reason " << bsl::hex(rec->exit_reason);
+            bsl::print() << " rip " << bsl::hex(rec->rip);
+            bsl::print() << " tsc " << bsl::hex(rec->tsc_exit);
+
+            if (bsl::ZERO_U64 != rec->tsc_resume) {
+                auto const cycles{bsl::to_u64(rec->tsc_resume) - bsl::to_u64(rec->tsc_exit)};
+                bsl::print() << " cycles " << bsl::hex(cycles);
+                bsl::print() << " ext " << bsl::hex(rec->ext_cycles);
+            }
+            else {
+                bsl::print() << " (in progress)";
+            }
+
+            bsl::print() << bsl::endl;
+        }
+    }
+}
+
+#endif
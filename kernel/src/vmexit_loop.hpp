@@ -25,12 +25,116 @@
 #ifndef VMEXIT_LOOP_HPP
 #define VMEXIT_LOOP_HPP
 
+#include <fast_path_t.hpp>
+#include <mk_interface.hpp>
+#include <syscall_trace.hpp>
+#include <vmexit_fast_path.hpp>
+#include <vmexit_log.hpp>
+#include <vmexit_stats.hpp>
+
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
 #include <bsl/exit_code.hpp>
+#include <bsl/safe_integral.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
 {
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Acts on the disposition returned by the extension's
+        ///     VMExit handler. This does the same thing as the "run"
+        ///     syscalls, without the extension having to make a syscall.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+        ///   @param tls the current TLS block
+        ///   @param vps_pool the VPS pool to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT, typename VPS_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        vmexit_loop_disposition(TLS_CONCEPT &tls, VPS_POOL_CONCEPT &vps_pool) noexcept
+            -> bsl::errc_type
+        {
+            constexpr bsl::safe_uintmax id_mask{bsl::to_umax(0xFFFFU)};
+            bsl::safe_uintmax const disposition{tls.vmexit_disposition};
+
+            switch ((disposition & syscall::BF_VMEXIT_DISPOSITION_MASK).get()) {
+                case syscall::BF_VMEXIT_DISPOSITION_RESUME.get(): {
+                    return bsl::errc_success;
+                }
+
+                case syscall::BF_VMEXIT_DISPOSITION_ADVANCE_IP_AND_RESUME.get(): {
+                    auto const ret{vps_pool.advance_ip(tls, tls.active_vpsid)};
+                    if (bsl::unlikely(!ret)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
+                    return bsl::errc_success;
+                }
+
+                case syscall::BF_VMEXIT_DISPOSITION_RUN.get(): {
+                    auto const vpsid{
+                        (disposition >> syscall::BF_VMEXIT_DISPOSITION_VPSID_SHIFT) & id_mask};
+                    auto const vpid{
+                        (disposition >> syscall::BF_VMEXIT_DISPOSITION_VPID_SHIFT) & id_mask};
+                    auto const vmid{
+                        (disposition >> syscall::BF_VMEXIT_DISPOSITION_VMID_SHIFT) & id_mask};
+
+                    if (bsl::unlikely(!(vpsid < bsl::to_umax(HYPERVISOR_MAX_VPSS)))) {
+                        bsl::error() << "invalid vpsid: "    // --
+                                     << bsl::hex(vpsid)      // --
+                                     << bsl::endl            // --
+                                     << bsl::here();         // --
+
+                        return bsl::errc_failure;
+                    }
+
+                    if (bsl::unlikely(!(vpid < bsl::to_umax(HYPERVISOR_MAX_VPS)))) {
+                        bsl::error() << "invalid vpid: "    // --
+                                     << bsl::hex(vpid)      // --
+                                     << bsl::endl           // --
+                                     << bsl::here();        // --
+
+                        return bsl::errc_failure;
+                    }
+
+                    if (bsl::unlikely(!(vmid < bsl::to_umax(HYPERVISOR_MAX_VMS)))) {
+                        bsl::error() << "invalid vmid: "    // --
+                                     << bsl::hex(vmid)      // --
+                                     << bsl::endl           // --
+                                     << bsl::here();        // --
+
+                        return bsl::errc_failure;
+                    }
+
+                    tls.active_vpsid = bsl::to_u16_unsafe(vpsid).get();
+                    tls.set_vpid(bsl::to_u16_unsafe(vpid));
+                    tls.set_vmid(bsl::to_u16_unsafe(vmid));
+
+                    return bsl::errc_success;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            bsl::error() << "unknown vmexit disposition: "    // --
+                         << bsl::hex(disposition)            // --
+                         << bsl::endl                        // --
+                         << bsl::here();                     // --
+
+            return bsl::errc_failure;
+        }
+    }
+
     /// <!-- description -->
     ///   @brief Provides the main entry point for VMExits that occur
     ///     after a successful launch of the hypervisor.
@@ -48,18 +152,79 @@ namespace mk
     vmexit_loop(TLS_CONCEPT &tls, EXT_CONCEPT &ext_vmexit, VPS_POOL_CONCEPT &vps_pool) noexcept
         -> bsl::exit_code
     {
+        using intrinsic_type = typename EXT_CONCEPT::intrinsic_type;
+
+        /// NOTE:
+        /// - The "run" syscalls come back here without returning from
+        ///   ext_t::vmexit(), so bf_callback_op_vmexit_return is disabled
+        ///   here as well.
+        ///
+
+        tls.ext_vmexit_handle = {};
+
+        auto const resume_tsc{intrinsic_type::rdtsc()};
+        vmexit_log_resume(tls, resume_tsc);
+        vmexit_stats_resume(tls, resume_tsc);
+        syscall_trace_resume(tls, resume_tsc);
+
         auto const exit_reason{vps_pool.run(tls, tls.active_vpsid)};
         if (bsl::unlikely(!exit_reason)) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::exit_failure;
         }
 
+        auto const exit_tsc{intrinsic_type::rdtsc()};
+        vmexit_log_exit<intrinsic_type>(tls, exit_reason, exit_tsc);
+        vmexit_stats_exit(tls, exit_reason, exit_tsc);
+
+        /// NOTE:
+        /// - Trivially emulated VMExits that the extension asked us to
+        ///   handle (see bf_callback_op_register_fast_path) never leave
+        ///   the microkernel, which saves two privilege transitions.
+        ///
+
+        auto const status{
+            vmexit_fast_path<intrinsic_type>(tls, vps_pool, ext_vmexit.fast_path(), exit_reason)};
+
+        if (fast_path_status_t::handled == status) {
+            return bsl::exit_success;
+        }
+
+        if (bsl::unlikely(fast_path_status_t::failed == status)) {
+            bsl::error() << "fast path partially emulated vmexit: "    // --
+                         << bsl::hex(exit_reason)                     // --
+                         << bsl::endl                                 // --
+                         << bsl::here();                              // --
+
+            return bsl::exit_failure;
+        }
+
+        /// NOTE:
+        /// - The exit information block is only filled in for VMExits that
+        ///   are given to the extension, so the fast path does not pay for
+        ///   VMREADs that it does not need.
+        ///
+
+        if (bsl::unlikely(!vps_pool.set_exit_info(tls, tls.active_vpsid, exit_reason))) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::exit_failure;
+        }
+
+        auto const ext_tsc{intrinsic_type::rdtsc()};
+        vmexit_log_ext(tls, ext_tsc);
+        vmexit_stats_ext(tls, ext_tsc);
+
         auto const ret{ext_vmexit.vmexit(tls, exit_reason)};
         if (bsl::unlikely(!ret)) {
             bsl::print<bsl::V>() << bsl::here();
             return bsl::exit_failure;
         }
 
+        if (bsl::unlikely(!details::vmexit_loop_disposition(tls, vps_pool))) {
+            bsl::print<bsl::V>() << bsl::here();
+            return bsl::exit_failure;
+        }
+
         return bsl::exit_success;
     }
 }
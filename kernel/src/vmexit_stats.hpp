@@ -0,0 +1,246 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMEXIT_STATS_HPP
+#define VMEXIT_STATS_HPP
+
+#include <vmexit_stats_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    namespace details
+    {
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the counter that VMExits with the
+        ///     provided exit reason are counted in.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param stats the VMExit stats to get the counter from
+        ///   @param exit_reason the exit reason to get the counter for
+        ///   @return Returns a pointer to the counter that VMExits with the
+        ///     provided exit reason are counted in.
+        ///
+        [[nodiscard]] constexpr auto
+        vmexit_stats_counter(
+            loader::vmexit_stats_t *const stats, bsl::safe_uintmax const &exit_reason) noexcept
+            -> bsl::uint64 *
+        {
+            if (exit_reason < loader::VMEXIT_STATS_FOLD_IDX) {
+                return stats->reasons.at_if(exit_reason);
+            }
+
+            if (exit_reason >= loader::VMEXIT_STATS_FOLD_REASON) {
+                auto const folded{exit_reason - loader::VMEXIT_STATS_FOLD_REASON};
+                if (folded < loader::VMEXIT_STATS_FOLD_SIZE) {
+                    return stats->reasons.at_if(loader::VMEXIT_STATS_FOLD_IDX + folded);
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            return &stats->other;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a sample to one of the log2 latency histograms.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param stats the VMExit stats that own the histogram
+        ///   @param hist the histogram to add the sample to
+        ///   @param cycles the sample to add, in TSC cycles
+        ///
+        constexpr void
+        vmexit_stats_sample(
+            loader::vmexit_stats_t *const stats,
+            bsl::safe_uintmax const &hist,
+            bsl::safe_uintmax const &cycles) noexcept
+        {
+            constexpr bsl::safe_uintmax last{loader::VMEXIT_STATS_BUCKETS - bsl::ONE_UMAX};
+
+            /// NOTE:
+            /// - The TSC is read on the same PP every time, so it cannot go
+            ///   backwards, but a bogus sample is still better dropped than
+            ///   turned into a failure on the VMExit path.
+            ///
+
+            if (bsl::unlikely(!cycles)) {
+                return;
+            }
+
+            bsl::safe_uintmax idx{};
+            if (!cycles.is_zero()) {
+                idx = last - bsl::to_umax(static_cast<bsl::uintmax>(__builtin_clzll(cycles.get())));
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto *const buckets{stats->hists.at_if(hist)};
+            if (bsl::unlikely(nullptr == buckets)) {
+                bsl::error() << "vmexit stats histogram out of range\n" << bsl::here();
+                return;
+            }
+
+            auto *const bucket{buckets->at_if(idx)};
+            if (bsl::unlikely(nullptr == bucket)) {
+                bsl::error() << "vmexit stats bucket out of range\n" << bsl::here();
+                return;
+            }
+
+            *bucket = (bsl::to_u64(*bucket) + bsl::ONE_U64).get();
+        }
+    }
+
+    /// NOTE:
+    /// - Every VMExit is aggregated into the VMExit stats of the PP it
+    ///   occurred on: a counter for its exit reason and three log2
+    ///   histograms. vmexit_loop reads the TSC once at each of the points
+    ///   below and hands it to both the VMExit log and these functions:
+    ///   - vmexit_stats_exit: the VPS returned to the microkernel. The
+    ///     time since the last resume is the time spent in the guest.
+    ///   - vmexit_stats_ext: the VMExit is handed to the extension. The
+    ///     time since the VMExit is the microkernel's dispatch overhead.
+    ///   - vmexit_stats_resume: the VPS is about to be run again. The
+    ///     time since the extension was called is the callback duration.
+    ///     The extension might not return from its VMExit handler (it
+    ///     can use a run syscall instead), which is why this is measured
+    ///     here and not when ext_t::vmexit returns.
+    /// - Each PP owns its own page, so none of this needs to be atomic and
+    ///   nothing is shared between PPs.
+    ///
+
+    /// <!-- description -->
+    ///   @brief Counts a VMExit and records how long the guest ran for.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @param tls the current TLS block
+    ///   @param exit_reason the exit reason of the VMExit being counted
+    ///   @param tsc the TSC when the VMExit was handed to the microkernel
+    ///
+    template<typename TLS_CONCEPT>
+    constexpr void
+    vmexit_stats_exit(
+        TLS_CONCEPT &tls,
+        bsl::safe_uintmax const &exit_reason,
+        bsl::safe_uintmax const &tsc) noexcept
+    {
+        auto *const stats{tls.vmexit_stats};
+        if (nullptr == stats) {
+            return;
+        }
+
+        auto *const counter{details::vmexit_stats_counter(stats, exit_reason)};
+        if (bsl::unlikely(nullptr == counter)) {
+            bsl::error() << "vmexit stats are corrupt\n" << bsl::here();
+            return;
+        }
+
+        *counter = (bsl::to_u64(*counter) + bsl::ONE_U64).get();
+        stats->total = (bsl::to_u64(stats->total) + bsl::ONE_U64).get();
+
+        if (bsl::ZERO_UMAX != tls.vmexit_stats_resume_tsc) {
+            details::vmexit_stats_sample(
+                stats,
+                loader::VMEXIT_STATS_HIST_GUEST,
+                tsc - bsl::to_umax(tls.vmexit_stats_resume_tsc));
+        }
+        else {
+            bsl::touch();
+        }
+
+        tls.vmexit_stats_exit_tsc = tsc.get();
+        tls.vmexit_stats_ext_tsc = {};
+    }
+
+    /// <!-- description -->
+    ///   @brief Records how long it took the microkernel to hand the
+    ///     current VMExit to the extension's VMExit handler.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @param tls the current TLS block
+    ///   @param tsc the TSC right before the VMExit handler is called
+    ///
+    template<typename TLS_CONCEPT>
+    constexpr void
+    vmexit_stats_ext(TLS_CONCEPT &tls, bsl::safe_uintmax const &tsc) noexcept
+    {
+        auto *const stats{tls.vmexit_stats};
+        if (nullptr == stats) {
+            return;
+        }
+
+        details::vmexit_stats_sample(
+            stats,
+            loader::VMEXIT_STATS_HIST_EXIT_TO_EXT,
+            tsc - bsl::to_umax(tls.vmexit_stats_exit_tsc));
+
+        tls.vmexit_stats_ext_tsc = tsc.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Records how long the extension spent handling the current
+    ///     VMExit (if it was handed one), as the VPS is about to be resumed.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @param tls the current TLS block
+    ///   @param tsc the TSC right before the VPS is resumed
+    ///
+    template<typename TLS_CONCEPT>
+    constexpr void
+    vmexit_stats_resume(TLS_CONCEPT &tls, bsl::safe_uintmax const &tsc) noexcept
+    {
+        auto *const stats{tls.vmexit_stats};
+        if (nullptr == stats) {
+            return;
+        }
+
+        if (bsl::ZERO_UMAX != tls.vmexit_stats_ext_tsc) {
+            details::vmexit_stats_sample(
+                stats,
+                loader::VMEXIT_STATS_HIST_EXT,
+                tsc - bsl::to_umax(tls.vmexit_stats_ext_tsc));
+        }
+        else {
+            bsl::touch();
+        }
+
+        tls.vmexit_stats_resume_tsc = tsc.get();
+        tls.vmexit_stats_ext_tsc = {};
+    }
+}
+
+#endif
@@ -25,10 +25,13 @@
 #ifndef VPS_POOL_T_HPP
 #define VPS_POOL_T_HPP
 
+#include <mk_interface.hpp>
+
 #include <bsl/array.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/finally.hpp>
+#include <bsl/span.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
@@ -393,6 +396,163 @@ namespace mk
             return vps->template write<FIELD_TYPE>(tls, index, value);
         }
 
+        /// <!-- description -->
+        ///   @brief Reads a batch of fields from the requested VPS. The
+        ///     VPS is looked up (and on Intel, loaded) once, after which
+        ///     each field is read using the same path as read(), stopping
+        ///     at the first field that fails.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param vpsid the ID of the VPS to read from
+        ///   @param fields the fields to read. On success, the value of
+        ///     each field is set to the value read from the VPS. These
+        ///     must live in the microkernel's memory (see
+        ///     ext_t::copy_from_user()).
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        read_batch(
+            TLS_CONCEPT &tls,
+            bsl::safe_uint16 const &vpsid,
+            bsl::span<syscall::bf_vps_field_t> const &fields) &noexcept -> bsl::errc_type
+        {
+            auto *const vps{m_pool.at_if(bsl::to_umax(vpsid))};
+            if (bsl::unlikely(nullptr == vps)) {
+                bsl::error() << "invalid vpsid: "    // --
+                             << bsl::hex(vpsid)      // --
+                             << bsl::endl            // --
+                             << bsl::here();         // --
+
+                return bsl::errc_failure;
+            }
+
+            for (auto const elem : fields) {
+                bsl::safe_uintmax val{};
+                bsl::safe_uintmax const index{elem.data->index};
+
+                switch (elem.data->width) {
+                    case syscall::BF_VPS_FIELD_WIDTH_8.get(): {
+                        val = bsl::to_umax(vps->template read<bsl::uint8>(tls, index));
+                        break;
+                    }
+
+                    case syscall::BF_VPS_FIELD_WIDTH_16.get(): {
+                        val = bsl::to_umax(vps->template read<bsl::uint16>(tls, index));
+                        break;
+                    }
+
+                    case syscall::BF_VPS_FIELD_WIDTH_32.get(): {
+                        val = bsl::to_umax(vps->template read<bsl::uint32>(tls, index));
+                        break;
+                    }
+
+                    case syscall::BF_VPS_FIELD_WIDTH_64.get(): {
+                        val = vps->template read<bsl::uint64>(tls, index);
+                        break;
+                    }
+
+                    default: {
+                        bsl::error() << "invalid field width: "       // --
+                                     << bsl::hex(elem.data->width)    // --
+                                     << bsl::endl                     // --
+                                     << bsl::here();                  // --
+
+                        return bsl::errc_failure;
+                    }
+                }
+
+                if (bsl::unlikely(!val)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                elem.data->value = val.get();
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes a batch of fields to the requested VPS. The
+        ///     VPS is looked up (and on Intel, loaded) once, after which
+        ///     each field is written using the same path as write(),
+        ///     stopping at the first field that fails.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param vpsid the ID of the VPS to write to
+        ///   @param fields the fields to write (see read_batch())
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        write_batch(
+            TLS_CONCEPT &tls,
+            bsl::safe_uint16 const &vpsid,
+            bsl::span<syscall::bf_vps_field_t const> const &fields) &noexcept -> bsl::errc_type
+        {
+            bsl::errc_type ret{};
+
+            auto *const vps{m_pool.at_if(bsl::to_umax(vpsid))};
+            if (bsl::unlikely(nullptr == vps)) {
+                bsl::error() << "invalid vpsid: "    // --
+                             << bsl::hex(vpsid)      // --
+                             << bsl::endl            // --
+                             << bsl::here();         // --
+
+                return bsl::errc_failure;
+            }
+
+            for (auto const elem : fields) {
+                bsl::safe_uintmax const index{elem.data->index};
+                bsl::safe_uintmax const val{elem.data->value};
+
+                switch (elem.data->width) {
+                    case syscall::BF_VPS_FIELD_WIDTH_8.get(): {
+                        ret = vps->template write<bsl::uint8>(tls, index, bsl::to_u8_unsafe(val));
+                        break;
+                    }
+
+                    case syscall::BF_VPS_FIELD_WIDTH_16.get(): {
+                        ret = vps->template write<bsl::uint16>(tls, index, bsl::to_u16_unsafe(val));
+                        break;
+                    }
+
+                    case syscall::BF_VPS_FIELD_WIDTH_32.get(): {
+                        ret = vps->template write<bsl::uint32>(tls, index, bsl::to_u32_unsafe(val));
+                        break;
+                    }
+
+                    case syscall::BF_VPS_FIELD_WIDTH_64.get(): {
+                        ret = vps->template write<bsl::uint64>(tls, index, val);
+                        break;
+                    }
+
+                    default: {
+                        bsl::error() << "invalid field width: "       // --
+                                     << bsl::hex(elem.data->width)    // --
+                                     << bsl::endl                     // --
+                                     << bsl::here();                  // --
+
+                        return bsl::errc_failure;
+                    }
+                }
+
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Reads a field from the requested VPS given a bf_reg_t
         ///     defining the field to read.
@@ -487,6 +647,39 @@ namespace mk
             return vps->run(tls);
         }
 
+        /// <!-- description -->
+        ///   @brief Fills in the exit information block of the extension's
+        ///     TLS block for the requested VPS. This should only be called
+        ///     right before a VMExit is given to the extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param vpsid the ID of the VPS that generated the VMExit
+        ///   @param exit_reason the reason for the VMExit
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        set_exit_info(
+            TLS_CONCEPT &tls,
+            bsl::safe_uint16 const &vpsid,
+            bsl::safe_uintmax const &exit_reason) &noexcept -> bsl::errc_type
+        {
+            auto *const vps{m_pool.at_if(bsl::to_umax(vpsid))};
+            if (bsl::unlikely(nullptr == vps)) {
+                bsl::error() << "invalid vpsid: "    // --
+                             << bsl::hex(vpsid)      // --
+                             << bsl::endl            // --
+                             << bsl::here();         // --
+
+                return bsl::errc_failure;
+            }
+
+            return vps->set_exit_info(tls, exit_reason);
+        }
+
         /// <!-- description -->
         ///   @brief Advance the IP of the requested VPS
         ///
@@ -514,6 +707,34 @@ namespace mk
             return vps->advance_ip(tls);
         }
 
+        /// <!-- description -->
+        ///   @brief Flushes the TLB entries tagged with the VPID/ASID of the
+        ///     requested VPS on the current PP
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param vpsid the ID of the VPS to flush the TLB for
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        flush_tlb(TLS_CONCEPT &tls, bsl::safe_uint16 const &vpsid) &noexcept -> bsl::errc_type
+        {
+            auto *const vps{m_pool.at_if(bsl::to_umax(vpsid))};
+            if (bsl::unlikely(nullptr == vps)) {
+                bsl::error() << "invalid vpsid: "    // --
+                             << bsl::hex(vpsid)      // --
+                             << bsl::endl            // --
+                             << bsl::here();         // --
+
+                return bsl::errc_failure;
+            }
+
+            return vps->flush_tlb(tls);
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the requested VPS
         ///
@@ -0,0 +1,67 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VPS_TLB_TAG_HPP
+#define VPS_TLB_TAG_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// @brief the TLB tag used by the host (i.e., VPID/ASID 0)
+    constexpr bsl::safe_uint16 VPS_TLB_TAG_HOST{bsl::to_u16(0x0000U)};
+    /// @brief used to mark a VPS that has not run on any PP yet
+    constexpr bsl::safe_uint16 VPS_INVALID_PPID{bsl::to_u16(0xFFFFU)};
+
+    /// <!-- description -->
+    ///   @brief Returns the TLB tag (i.e., the VPID on Intel or the ASID
+    ///     on AMD) owned by the VPS with the provided VPSID. VPSIDs are
+    ///     handed out by the vps_pool_t, and a VPSID is never given to
+    ///     more than one VPS at a time, so the vps_pool_t doubles as the
+    ///     tag allocator: every VPS gets its own tag when it is created,
+    ///     and the tag is returned when the VPS is destroyed. Tag 0
+    ///     belongs to the host, so the tag is the VPSID + 1.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param vpsid the ID of the VPS to get the TLB tag for
+    ///   @return Returns the TLB tag owned by the provided VPS, or
+    ///     bsl::safe_uint16::zero(true) if the VPSID is invalid.
+    ///
+    [[nodiscard]] constexpr auto
+    vps_tlb_tag(bsl::safe_uint16 const &vpsid) noexcept -> bsl::safe_uint16
+    {
+        constexpr bsl::safe_uint16 one{bsl::to_u16(0x0001U)};
+
+        auto const tag{vpsid + one};
+        if (bsl::unlikely(!tag)) {
+            return bsl::safe_uint16::zero(true);
+        }
+
+        return tag;
+    }
+}
+
+#endif
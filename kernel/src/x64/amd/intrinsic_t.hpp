@@ -30,6 +30,7 @@
 #include <bsl/errc_type.hpp>
 #include <bsl/is_constant_evaluated.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 
 namespace mk
 {
@@ -51,6 +52,14 @@ namespace mk
         ///
         extern "C" void intrinsic_set_cr3(bsl::uint64 const val) noexcept;
 
+        /// <!-- description -->
+        ///   @brief Implements intrinsic_t::invlpg
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param addr n/a
+        ///
+        extern "C" void intrinsic_invlpg(bsl::uint64 const addr) noexcept;
+
         /// <!-- description -->
         ///   @brief Implements intrinsic_t::tp
         ///
@@ -92,6 +101,29 @@ namespace mk
         ///
         extern "C" void intrinsic_halt() noexcept;
 
+        /// <!-- description -->
+        ///   @brief Implements intrinsic_t::cpuid
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rax n/a
+        ///   @param rbx n/a
+        ///   @param rcx n/a
+        ///   @param rdx n/a
+        ///
+        extern "C" void intrinsic_cpuid(
+            bsl::uint64 *const rax,
+            bsl::uint64 *const rbx,
+            bsl::uint64 *const rcx,
+            bsl::uint64 *const rdx) noexcept;
+
+        /// <!-- description -->
+        ///   @brief Implements intrinsic_t::rdtsc
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return n/a
+        ///
+        extern "C" [[nodiscard]] auto intrinsic_rdtsc() noexcept -> bsl::uint64;
+
         /// <!-- description -->
         ///   @brief Implements intrinsic_t::rdmsr
         ///
@@ -226,6 +258,32 @@ namespace mk
             details::intrinsic_set_cr3(val.get());
         }
 
+        /// <!-- description -->
+        ///   @brief Invalidates the TLB entries associated with the
+        ///     provided virtual address on the current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param addr the virtual address to invalidate
+        ///
+        static constexpr void
+        invlpg(bsl::safe_uint64 const &addr) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            if (bsl::unlikely(!addr)) {
+                bsl::error() << "invalid addr: "    // --
+                             << bsl::hex(addr)      // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return;
+            }
+
+            details::intrinsic_invlpg(addr.get());
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of tp (TLS pointer)
         ///
@@ -341,6 +399,60 @@ namespace mk
             details::intrinsic_halt();
         }
 
+        /// <!-- description -->
+        ///   @brief On AMD, the syscall MSRs are swapped by the VMLoad and
+        ///     VMSave instructions as part of every VMRun, so the
+        ///     microkernel's syscall MSRs are always loaded after a VMExit
+        ///     and there is nothing to do.
+        ///
+        static constexpr void
+        load_host_syscall_msrs() noexcept
+        {
+            bsl::touch();
+        }
+
+        /// <!-- description -->
+        ///   @brief Executes the CPUID instruction given the provided EAX
+        ///     and ECX and returns the results
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rax the index used by CPUID, returns resulting rax
+        ///   @param rbx returns resulting rbx
+        ///   @param rcx the subindex used by CPUID, returns the resulting rcx
+        ///   @param rdx returns resulting rdx
+        ///
+        static constexpr void
+        cpuid(
+            bsl::safe_uint64 &rax,
+            bsl::safe_uint64 &rbx,
+            bsl::safe_uint64 &rcx,
+            bsl::safe_uint64 &rdx) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            details::intrinsic_cpuid(rax.data(), rbx.data(), rcx.data(), rdx.data());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the TSC. RDTSC is not serializing,
+        ///     so this is only suitable for timing that can tolerate a
+        ///     few instructions of skew.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the TSC
+        ///
+        [[nodiscard]] static constexpr auto
+        rdtsc() noexcept -> bsl::safe_uint64
+        {
+            if (bsl::is_constant_evaluated()) {
+                return {};
+            }
+
+            return details::intrinsic_rdtsc();
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of requested MSR
         ///
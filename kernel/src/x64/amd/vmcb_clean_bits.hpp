@@ -0,0 +1,174 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMCB_CLEAN_BITS_HPP
+#define VMCB_CLEAN_BITS_HPP
+
+#include <vmcb_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @brief intercepts, pause filter and TSC offset
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_I{bsl::to_u32(0x00000001U)};
+    /// @brief IOPM_BASE_PA and MSRPM_BASE_PA
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_IOPM{bsl::to_u32(0x00000002U)};
+    /// @brief the guest ASID
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_ASID{bsl::to_u32(0x00000004U)};
+    /// @brief V_TPR, V_IRQ, V_INTR_* and V_INTR_MASKING
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_TPR{bsl::to_u32(0x00000008U)};
+    /// @brief NP_ENABLE, N_CR3 and G_PAT
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_NP{bsl::to_u32(0x00000010U)};
+    /// @brief CR0, CR3, CR4 and EFER
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_CRX{bsl::to_u32(0x00000020U)};
+    /// @brief DR6 and DR7
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_DRX{bsl::to_u32(0x00000040U)};
+    /// @brief GDTR and IDTR
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_DT{bsl::to_u32(0x00000080U)};
+    /// @brief ES, CS, SS, DS and CPL
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_SEG{bsl::to_u32(0x00000100U)};
+    /// @brief CR2
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_CR2{bsl::to_u32(0x00000200U)};
+    /// @brief DbgCtlMsr, br_from/to and lastint_from/to
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_LBR{bsl::to_u32(0x00000400U)};
+    /// @brief AVIC APIC_BAR, backing page and logical/physical tables
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_AVIC{bsl::to_u32(0x00000800U)};
+    /// @brief all of the clean bits defined above
+    constexpr bsl::safe_uint32 VMCB_CLEAN_BITS_ALL{bsl::to_u32(0x00000FFFU)};
+
+    namespace details
+    {
+        /// @brief the granularity (in bytes) of the clean bits table
+        constexpr bsl::safe_uintmax VMCB_CLEAN_BITS_GRANULARITY{bsl::to_umax(8U)};
+        /// @brief the total number of entries in the clean bits table
+        constexpr bsl::safe_uintmax VMCB_CLEAN_BITS_TABLE_SIZE{
+            bsl::to_umax(sizeof(vmcb_t)) / VMCB_CLEAN_BITS_GRANULARITY};
+        /// @brief the number of entries in VMCB_CLEAN_BITS_RANGES
+        constexpr bsl::safe_uintmax VMCB_CLEAN_BITS_NUM_RANGES{bsl::to_umax(21U)};
+
+        /// @struct mk::details::vmcb_clean_bits_range_t
+        ///
+        /// <!-- description -->
+        ///   @brief Defines a range of VMCB offsets [begin, end) and the
+        ///     clean bits that must be cleared when any of them are written.
+        ///
+        struct vmcb_clean_bits_range_t final
+        {
+            /// @brief the first offset in the range
+            bsl::uintmax begin;
+            /// @brief one past the last offset in the range
+            bsl::uintmax end;
+            /// @brief the clean bits associated with the range
+            bsl::uint32 bits;
+        };
+
+        /// @brief defines which VMCB offsets are covered by which clean
+        ///   bits. Any offset that is not listed is never cached by the
+        ///   CPU (e.g., RIP, RSP, RAX, RFLAGS, FS, GS, TR, LDTR and the
+        ///   syscall MSRs), and can be written without clearing anything.
+        constexpr bsl::array<vmcb_clean_bits_range_t, VMCB_CLEAN_BITS_NUM_RANGES.get()>
+            VMCB_CLEAN_BITS_RANGES{
+                vmcb_clean_bits_range_t{0x0000U, 0x0040U, VMCB_CLEAN_BITS_I.get()},
+                vmcb_clean_bits_range_t{0x0040U, 0x0050U, VMCB_CLEAN_BITS_IOPM.get()},
+                vmcb_clean_bits_range_t{0x0050U, 0x0058U, VMCB_CLEAN_BITS_I.get()},
+                vmcb_clean_bits_range_t{0x0058U, 0x0060U, VMCB_CLEAN_BITS_ASID.get()},
+                vmcb_clean_bits_range_t{0x0060U, 0x0068U, VMCB_CLEAN_BITS_TPR.get()},
+                vmcb_clean_bits_range_t{0x0090U, 0x0098U, VMCB_CLEAN_BITS_NP.get()},
+                vmcb_clean_bits_range_t{0x0098U, 0x00A0U, VMCB_CLEAN_BITS_AVIC.get()},
+                vmcb_clean_bits_range_t{0x00B0U, 0x00B8U, VMCB_CLEAN_BITS_NP.get()},
+                vmcb_clean_bits_range_t{0x00B8U, 0x00C0U, VMCB_CLEAN_BITS_LBR.get()},
+                vmcb_clean_bits_range_t{0x00E0U, 0x00E8U, VMCB_CLEAN_BITS_AVIC.get()},
+                vmcb_clean_bits_range_t{0x00F0U, 0x0100U, VMCB_CLEAN_BITS_AVIC.get()},
+                vmcb_clean_bits_range_t{0x0400U, 0x0440U, VMCB_CLEAN_BITS_SEG.get()},
+                vmcb_clean_bits_range_t{0x0460U, 0x0470U, VMCB_CLEAN_BITS_DT.get()},
+                vmcb_clean_bits_range_t{0x0480U, 0x0490U, VMCB_CLEAN_BITS_DT.get()},
+                vmcb_clean_bits_range_t{0x04C8U, 0x04D0U, VMCB_CLEAN_BITS_SEG.get()},
+                vmcb_clean_bits_range_t{0x04D0U, 0x04D8U, VMCB_CLEAN_BITS_CRX.get()},
+                vmcb_clean_bits_range_t{0x0548U, 0x0560U, VMCB_CLEAN_BITS_CRX.get()},
+                vmcb_clean_bits_range_t{0x0560U, 0x0570U, VMCB_CLEAN_BITS_DRX.get()},
+                vmcb_clean_bits_range_t{0x0640U, 0x0648U, VMCB_CLEAN_BITS_CR2.get()},
+                vmcb_clean_bits_range_t{0x0668U, 0x0670U, VMCB_CLEAN_BITS_NP.get()},
+                vmcb_clean_bits_range_t{0x0670U, 0x06A0U, VMCB_CLEAN_BITS_LBR.get()},
+            };
+
+        /// <!-- description -->
+        ///   @brief Expands VMCB_CLEAN_BITS_RANGES into a table with one
+        ///     entry per VMCB_CLEAN_BITS_GRANULARITY bytes of the VMCB so
+        ///     that looking up the clean bits for an offset is a single
+        ///     load.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the resulting clean bits table
+        ///
+        [[nodiscard]] constexpr auto
+        make_vmcb_clean_bits_table() noexcept
+            -> bsl::array<bsl::uint32, VMCB_CLEAN_BITS_TABLE_SIZE.get()>
+        {
+            bsl::array<bsl::uint32, VMCB_CLEAN_BITS_TABLE_SIZE.get()> table{};
+
+            for (auto const elem : VMCB_CLEAN_BITS_RANGES) {
+                auto i{bsl::to_umax(elem.data->begin) / VMCB_CLEAN_BITS_GRANULARITY};
+                auto const end{bsl::to_umax(elem.data->end) / VMCB_CLEAN_BITS_GRANULARITY};
+
+                for (; i < end; ++i) {
+                    *table.at_if(i) |= elem.data->bits;
+                }
+            }
+
+            return table;
+        }
+
+        /// @brief stores the clean bits for every 8 bytes of the VMCB
+        constexpr auto VMCB_CLEAN_BITS_TABLE{make_vmcb_clean_bits_table()};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the VMCB clean bits that must be cleared when the
+    ///     field at the provided VMCB offset is written. Returns 0 if the
+    ///     field is never cached by the CPU, or if the offset is invalid.
+    ///     When the offset is a constant expression, the result is as well.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param offset the offset of the VMCB field being written
+    ///   @return Returns the VMCB clean bits that must be cleared when the
+    ///     field at the provided VMCB offset is written.
+    ///
+    [[nodiscard]] constexpr auto
+    vmcb_clean_bits_for(bsl::safe_uintmax const &offset) noexcept -> bsl::safe_uint32
+    {
+        auto const *const bits{
+            details::VMCB_CLEAN_BITS_TABLE.at_if(offset / details::VMCB_CLEAN_BITS_GRANULARITY)};
+
+        if (nullptr == bits) {
+            return bsl::ZERO_U32;
+        }
+
+        return bsl::to_u32(*bits);
+    }
+}
+
+#endif
@@ -0,0 +1,103 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMEXIT_FAST_PATH_HPP
+#define VMEXIT_FAST_PATH_HPP
+
+#include <fast_path_t.hpp>
+#include <vmexit_fast_path_ops.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    namespace details
+    {
+        /// @brief defines the CPUID VMExit reason
+        constexpr bsl::safe_uintmax EXIT_REASON_CPUID{bsl::to_umax(0x72U)};
+        /// @brief defines the MSR VMExit reason
+        constexpr bsl::safe_uintmax EXIT_REASON_MSR{bsl::to_umax(0x7CU)};
+        /// @brief defines the VMCB index of EXITINFO1
+        constexpr bsl::safe_uintmax VMCB_EXITINFO1_IDX{bsl::to_umax(0x78U)};
+        /// @brief defines the EXITINFO1 value for a RDMSR
+        constexpr bsl::safe_uintmax EXITINFO1_RDMSR{bsl::to_umax(0U)};
+    }
+
+    /// <!-- description -->
+    ///   @brief Attempts to handle a VMExit in the microkernel using the
+    ///     fast path table registered by the extension. If the VMExit
+    ///     cannot be handled here, fast_path_status_t::unhandled is
+    ///     returned and the VMExit is given to the extension like normal.
+    ///
+    ///   @note NMI windows are not supported on AMD, so the
+    ///     BF_FAST_PATH_FLAG_NMI_WINDOW flag is ignored.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+    ///   @param tls the current TLS block
+    ///   @param vps_pool the VPS pool to use
+    ///   @param fast_path the fast path table to use
+    ///   @param exit_reason the exit reason returned by the VPS
+    ///   @return Returns fast_path_status_t::handled if the VMExit was
+    ///     handled, fast_path_status_t::unhandled if it must be given to
+    ///     the extension, or fast_path_status_t::failed if the VMExit was
+    ///     only partially emulated.
+    ///
+    template<typename INTRINSIC_CONCEPT, typename TLS_CONCEPT, typename VPS_POOL_CONCEPT>
+    [[nodiscard]] constexpr auto
+    vmexit_fast_path(
+        TLS_CONCEPT &tls,
+        VPS_POOL_CONCEPT &vps_pool,
+        fast_path_t const &fast_path,
+        bsl::safe_uintmax const &exit_reason) noexcept -> fast_path_status_t
+    {
+        if (details::EXIT_REASON_CPUID == exit_reason) {
+            return details::vmexit_fast_path_cpuid<INTRINSIC_CONCEPT>(tls, vps_pool, fast_path);
+        }
+
+        if (details::EXIT_REASON_MSR != exit_reason) {
+            return fast_path_status_t::unhandled;
+        }
+
+        auto const exitinfo1{vps_pool.template read<bsl::uint64>(
+            tls, tls.active_vpsid, details::VMCB_EXITINFO1_IDX)};
+        if (bsl::unlikely(!exitinfo1)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return fast_path_status_t::unhandled;
+        }
+
+        if (details::EXITINFO1_RDMSR == exitinfo1) {
+            return details::vmexit_fast_path_rdmsr<INTRINSIC_CONCEPT>(tls, vps_pool, fast_path);
+        }
+
+        return details::vmexit_fast_path_wrmsr<INTRINSIC_CONCEPT>(tls, vps_pool, fast_path);
+    }
+}
+
+#endif
@@ -26,13 +26,17 @@
 #define VPS_T_HPP
 
 #include <mk_interface.hpp>
+#include <page_pool_stats_t.hpp>
+#include <vmcb_clean_bits.hpp>
 #include <vmcb_t.hpp>
+#include <vps_tlb_tag.hpp>
 
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/finally.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
@@ -42,6 +46,13 @@ namespace mk
 
     namespace details
     {
+        /// @brief defines the CPUID leaf that reports the number of ASIDs
+        constexpr bsl::safe_uint64 CPUID_SVM_FEATURES{bsl::to_u64(0x8000000AU)};
+        /// @brief defines the TLB_CONTROL value that does not flush anything
+        constexpr bsl::safe_uint8 TLB_CONTROL_DO_NOTHING{bsl::to_u8(0x00U)};
+        /// @brief defines the TLB_CONTROL value that flushes the guest's ASID
+        constexpr bsl::safe_uint8 TLB_CONTROL_FLUSH_GUEST{bsl::to_u8(0x03U)};
+
         /// <!-- description -->
         ///   @brief Converts attributes in the form 0xF0FF to the form
         ///     0x0FFF.
@@ -112,6 +123,25 @@ namespace mk
         vmcb_t *m_host_vmcb{};
         /// @brief stores the physical address of the host VMCB
         bsl::safe_uintmax m_host_vmcb_phys{bsl::safe_uintmax::zero(true)};
+        /// @brief stores the ID of the PP this VPS was last run on
+        bsl::safe_uint16 m_last_ppid{VPS_INVALID_PPID};
+        /// @brief stores the ASID owned by this VPS
+        bsl::safe_uint16 m_asid{bsl::safe_uint16::zero(true)};
+
+        /// <!-- description -->
+        ///   @brief Clears the provided VMCB clean bits, telling the CPU
+        ///     that the fields covered by these bits have been modified
+        ///     and must be reloaded from the guest VMCB on the next VMRUN.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bits the VMCB clean bits to clear
+        ///
+        constexpr void
+        clear_clean_bits(bsl::safe_uint32 const &bits) &noexcept
+        {
+            auto const clean_bits{bsl::to_u32(m_guest_vmcb->vmcb_clean_bits)};
+            m_guest_vmcb->vmcb_clean_bits = (clean_bits & ~bits).get();
+        }
 
     public:
         /// @brief an alias for INTRINSIC_CONCEPT
@@ -167,6 +197,12 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            m_asid = vps_tlb_tag(i);
+            if (bsl::unlikely(!m_asid)) {
+                bsl::error() << "invalid asid\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
             release_on_error.ignore();
             m_initialized = true;
 
@@ -182,6 +218,7 @@ namespace mk
             this->deallocate();
 
             m_next = {};
+            m_asid = bsl::safe_uint16::zero(true);
             m_id = bsl::safe_uint16::zero(true);
             m_page_pool = {};
             m_intrinsic = {};
@@ -276,8 +313,6 @@ namespace mk
         [[nodiscard]] constexpr auto
         allocate(TLS_CONCEPT &tls) &noexcept -> bsl::errc_type
         {
-            bsl::discard(tls);
-
             if (bsl::unlikely(!m_initialized)) {
                 bsl::error() << "vps_t not initialized\n" << bsl::here();
                 return bsl::errc_failure;
@@ -287,7 +322,7 @@ namespace mk
                 this->release();
             }};
 
-            m_guest_vmcb = m_page_pool->template allocate<vmcb_t>();
+            m_guest_vmcb = m_page_pool->template allocate<vmcb_t>(tls, loader::PAGE_POOL_OWNER_VPS);
             if (bsl::unlikely(nullptr == m_guest_vmcb)) {
                 bsl::print() << bsl::here();
                 return bsl::errc_failure;
@@ -299,7 +334,7 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            m_host_vmcb = m_page_pool->template allocate<vmcb_t>();
+            m_host_vmcb = m_page_pool->template allocate<vmcb_t>(tls, loader::PAGE_POOL_OWNER_VPS);
             if (bsl::unlikely(nullptr == m_host_vmcb)) {
                 bsl::print() << bsl::here();
                 return bsl::errc_failure;
@@ -311,6 +346,31 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            bsl::safe_uint64 rax{details::CPUID_SVM_FEATURES};
+            bsl::safe_uint64 rbx{};
+            bsl::safe_uint64 rcx{};
+            bsl::safe_uint64 rdx{};
+            m_intrinsic->cpuid(rax, rbx, rcx, rdx);
+
+            /// NOTE:
+            /// - EBX reports the number of ASIDs, including ASID 0, which
+            ///   belongs to the host. If this VPS's ASID does not fit, the
+            ///   VPS cannot be created without sharing its ASID with
+            ///   another VPS, which is exactly what we are trying to avoid.
+            ///
+
+            if (bsl::unlikely(bsl::to_u64(m_asid) >= rbx)) {
+                bsl::error() << "asid "                            // --
+                             << bsl::hex(m_asid)                   // --
+                             << " is not supported by this cpu"    // --
+                             << bsl::endl                          // --
+                             << bsl::here();                       // --
+
+                return bsl::errc_failure;
+            }
+
+            m_guest_vmcb->guest_asid = bsl::to_u32(m_asid).get();
+
             release_on_error.ignore();
             m_allocated = true;
 
@@ -326,7 +386,7 @@ namespace mk
             m_host_vmcb_phys = bsl::safe_uintmax::zero(true);
 
             if (nullptr != m_page_pool) {
-                m_page_pool->deallocate(m_host_vmcb);
+                m_page_pool->deallocate(m_host_vmcb, loader::PAGE_POOL_OWNER_VPS);
                 m_host_vmcb = {};
             }
             else {
@@ -336,13 +396,14 @@ namespace mk
             m_guest_vmcb_phys = bsl::safe_uintmax::zero(true);
 
             if (nullptr != m_page_pool) {
-                m_page_pool->deallocate(m_guest_vmcb);
+                m_page_pool->deallocate(m_guest_vmcb, loader::PAGE_POOL_OWNER_VPS);
                 m_guest_vmcb = {};
             }
             else {
                 bsl::touch();
             }
 
+            m_last_ppid = VPS_INVALID_PPID;
             m_allocated = {};
         }
 
@@ -460,6 +521,7 @@ namespace mk
             m_guest_vmcb->g_pat = state->ia32_pat;
             m_guest_vmcb->dbgctl = state->ia32_debugctl;
 
+            m_guest_vmcb->vmcb_clean_bits = bsl::ZERO_U32.get();
             return bsl::errc_success;
         }
 
@@ -671,6 +733,8 @@ namespace mk
             }
 
             *ptr = value.get();
+            this->clear_clean_bits(vmcb_clean_bits_for(index));
+
             return bsl::errc_success;
         }
 
@@ -1123,101 +1187,121 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_gdtr_base_addr: {
                     m_guest_vmcb->gdtr_base = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_DT);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_gdtr_limit: {
                     m_guest_vmcb->gdtr_limit = bsl::to_u32(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_DT);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_idtr_base_addr: {
                     m_guest_vmcb->idtr_base = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_DT);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_idtr_limit: {
                     m_guest_vmcb->idtr_limit = bsl::to_u32(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_DT);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_es: {
                     m_guest_vmcb->es_selector = bsl::to_u16(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_es_base_addr: {
                     m_guest_vmcb->es_base = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_es_limit: {
                     m_guest_vmcb->es_limit = bsl::to_u32(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_es_attributes: {
                     m_guest_vmcb->es_attrib = bsl::to_u16(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cs: {
                     m_guest_vmcb->cs_selector = bsl::to_u16(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cs_base_addr: {
                     m_guest_vmcb->cs_base = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cs_limit: {
                     m_guest_vmcb->cs_limit = bsl::to_u32(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cs_attributes: {
                     m_guest_vmcb->cs_attrib = bsl::to_u16(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ss: {
                     m_guest_vmcb->ss_selector = bsl::to_u16(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ss_base_addr: {
                     m_guest_vmcb->ss_base = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ss_limit: {
                     m_guest_vmcb->ss_limit = bsl::to_u32(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ss_attributes: {
                     m_guest_vmcb->ss_attrib = bsl::to_u16(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ds: {
                     m_guest_vmcb->ds_selector = bsl::to_u16(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ds_base_addr: {
                     m_guest_vmcb->ds_base = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ds_limit: {
                     m_guest_vmcb->ds_limit = bsl::to_u32(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ds_attributes: {
                     m_guest_vmcb->ds_attrib = bsl::to_u16(val).get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_SEG);
                     break;
                 }
 
@@ -1303,36 +1387,43 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_cr0: {
                     m_guest_vmcb->cr0 = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_CRX);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cr2: {
                     m_guest_vmcb->cr2 = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_CR2);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cr3: {
                     m_guest_vmcb->cr3 = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_CRX);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cr4: {
                     m_guest_vmcb->cr4 = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_CRX);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_dr6: {
                     m_guest_vmcb->dr6 = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_DRX);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_dr7: {
                     m_guest_vmcb->dr7 = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_DRX);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_efer: {
                     m_guest_vmcb->efer = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_CRX);
                     break;
                 }
 
@@ -1388,11 +1479,13 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_pat: {
                     m_guest_vmcb->g_pat = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_NP);
                     break;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_debugctl: {
                     m_guest_vmcb->dbgctl = val.get();
+                    this->clear_clean_bits(VMCB_CLEAN_BITS_LBR);
                     break;
                 }
 
@@ -1427,6 +1520,25 @@ namespace mk
                 return bsl::safe_uintmax::zero(true);
             }
 
+            /// NOTE:
+            /// - The clean bits only describe what the CPU has cached for
+            ///   this VMCB on the PP it last ran on. If the VPS has been
+            ///   migrated, nothing is cached on this PP, so all of the
+            ///   fields must be reloaded.
+            /// - The same is true for the TLB. Any entries tagged with our
+            ///   ASID on this PP are stale (they were either created the
+            ///   last time this VPS ran here, or by a destroyed VPS that
+            ///   owned the same ASID), so they are flushed on entry.
+            ///
+
+            if (tls.ppid() != m_last_ppid) {
+                m_guest_vmcb->vmcb_clean_bits = bsl::ZERO_U32.get();
+                m_guest_vmcb->tlb_control = details::TLB_CONTROL_FLUSH_GUEST.get();
+            }
+            else {
+                bsl::touch();
+            }
+
             auto const exit_reason{details::intrinsic_vmrun(
                 m_guest_vmcb, m_guest_vmcb_phys.get(), m_host_vmcb, m_host_vmcb_phys.get())};
 
@@ -1437,6 +1549,10 @@ namespace mk
                 return bsl::safe_uintmax::zero(true);
             }
 
+            m_guest_vmcb->vmcb_clean_bits = VMCB_CLEAN_BITS_ALL.get();
+            m_guest_vmcb->tlb_control = details::TLB_CONTROL_DO_NOTHING.get();
+            m_last_ppid = tls.ppid();
+
             /// TODO:
             /// - Add check logic to if an entry failure occurs and output
             ///   what the error was and why.
@@ -1445,6 +1561,60 @@ namespace mk
             return exit_reason;
         }
 
+        /// <!-- description -->
+        ///   @brief Fills in the exit information block of the extension's
+        ///     TLS block, so that most VMExit handlers do not have to read
+        ///     these fields from the VMCB using a syscall. This is only
+        ///     called for VMExits that are given to the extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param exit_reason the reason for the VMExit
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        set_exit_info(TLS_CONCEPT &tls, bsl::safe_uintmax const &exit_reason) &noexcept
+            -> bsl::errc_type
+        {
+            bsl::discard(tls);
+
+            if (bsl::unlikely(!m_allocated)) {
+                bsl::error() << "invalid vps\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto const rip{bsl::to_umax(m_guest_vmcb->rip)};
+            auto const nrip{bsl::to_umax(m_guest_vmcb->nrip)};
+
+            m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_REASON, exit_reason);
+            m_intrinsic->set_tls_reg(
+                syscall::TLS_OFFSET_EXIT_INFO1, bsl::to_umax(m_guest_vmcb->exitinfo1));
+            m_intrinsic->set_tls_reg(
+                syscall::TLS_OFFSET_EXIT_INFO2, bsl::to_umax(m_guest_vmcb->exitinfo2));
+            m_intrinsic->set_tls_reg(
+                syscall::TLS_OFFSET_EXIT_GPA, bsl::to_umax(m_guest_vmcb->exitinfo2));
+            m_intrinsic->set_tls_reg(
+                syscall::TLS_OFFSET_EXIT_INTR_INFO, bsl::to_umax(m_guest_vmcb->exitininfo));
+            m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_RIP, rip);
+
+            /// NOTE:
+            /// - nrip is only provided for instruction intercepts, and is
+            ///   zero otherwise, in which case there is no length to report.
+            ///
+
+            if (nrip > rip) {
+                m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_INSTR_LEN, nrip - rip);
+            }
+            else {
+                m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_INSTR_LEN, bsl::ZERO_UMAX);
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Advance the IP of the VPS
         ///
@@ -1469,6 +1639,33 @@ namespace mk
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Flushes the TLB entries tagged with this VPS's ASID.
+        ///     On AMD, this is done by the next VMRUN of this VPS using
+        ///     TLB_CONTROL, which only flushes this ASID and leaves the
+        ///     TLB entries of every other VPS (and the host) alone.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        flush_tlb(TLS_CONCEPT &tls) &noexcept -> bsl::errc_type
+        {
+            bsl::discard(tls);
+
+            if (bsl::unlikely(!m_allocated)) {
+                bsl::error() << "invalid vps\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            m_guest_vmcb->tlb_control = details::TLB_CONTROL_FLUSH_GUEST.get();
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the contents of the VPS to the console
         ///
@@ -53,6 +53,14 @@ namespace mk
         ///
         extern "C" void intrinsic_set_cr3(bsl::uint64 const val) noexcept;
 
+        /// <!-- description -->
+        ///   @brief Implements intrinsic_t::invlpg
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param addr n/a
+        ///
+        extern "C" void intrinsic_invlpg(bsl::uint64 const addr) noexcept;
+
         /// <!-- description -->
         ///   @brief Implements intrinsic_t::tp
         ///
@@ -94,6 +102,29 @@ namespace mk
         ///
         extern "C" void intrinsic_halt() noexcept;
 
+        /// <!-- description -->
+        ///   @brief Implements intrinsic_t::cpuid
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rax n/a
+        ///   @param rbx n/a
+        ///   @param rcx n/a
+        ///   @param rdx n/a
+        ///
+        extern "C" void intrinsic_cpuid(
+            bsl::uint64 *const rax,
+            bsl::uint64 *const rbx,
+            bsl::uint64 *const rcx,
+            bsl::uint64 *const rdx) noexcept;
+
+        /// <!-- description -->
+        ///   @brief Implements intrinsic_t::rdtsc
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return n/a
+        ///
+        extern "C" [[nodiscard]] auto intrinsic_rdtsc() noexcept -> bsl::uint64;
+
         /// <!-- description -->
         ///   @brief Implements intrinsic_t::rdmsr
         ///
@@ -123,6 +154,19 @@ namespace mk
         ///
         extern "C" [[nodiscard]] auto intrinsic_vmload(void *const phys) noexcept -> bsl::uint64;
 
+        /// <!-- description -->
+        ///   @brief Implements intrinsic_t::invvpid
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param type n/a
+        ///   @param vpid n/a
+        ///   @param addr n/a
+        ///   @return n/a
+        ///
+        extern "C" [[nodiscard]] auto intrinsic_invvpid(
+            bsl::uint64 const type, bsl::uint16 const vpid, bsl::uint64 const addr) noexcept
+            -> bsl::uint64;
+
         /// <!-- description -->
         ///   @brief Implements intrinsic_t::vmread16
         ///
@@ -200,6 +244,11 @@ namespace mk
         ///
         extern "C" [[nodiscard]] auto intrinsic_vmrun(void *const vmcs_missing_registers) noexcept
             -> bsl::uintmax;
+
+        /// <!-- description -->
+        ///   @brief Implements intrinsic_t::load_host_syscall_msrs
+        ///
+        extern "C" void intrinsic_load_host_syscall_msrs() noexcept;
     }
 
     /// @class mk::intrinsic
@@ -299,6 +348,32 @@ namespace mk
             details::intrinsic_set_cr3(val.get());
         }
 
+        /// <!-- description -->
+        ///   @brief Invalidates the TLB entries associated with the
+        ///     provided virtual address on the current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param addr the virtual address to invalidate
+        ///
+        static constexpr void
+        invlpg(bsl::safe_uint64 const &addr) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            if (bsl::unlikely(!addr)) {
+                bsl::error() << "invalid addr: "    // --
+                             << bsl::hex(addr)      // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return;
+            }
+
+            details::intrinsic_invlpg(addr.get());
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of tp (TLS pointer)
         ///
@@ -414,6 +489,68 @@ namespace mk
             details::intrinsic_halt();
         }
 
+        /// <!-- description -->
+        ///   @brief VMExits leave the guest's syscall MSRs loaded so that
+        ///     VMExits that never leave the microkernel do not have to pay
+        ///     for swapping them. This saves the guest's syscall MSRs to
+        ///     the VPS they belong to and loads the microkernel's, and must
+        ///     be called before an extension is executed, or before the
+        ///     guest's syscall MSRs are accessed through the VPS. If the
+        ///     microkernel's syscall MSRs are already loaded, this function
+        ///     does nothing.
+        ///
+        static constexpr void
+        load_host_syscall_msrs() noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            details::intrinsic_load_host_syscall_msrs();
+        }
+
+        /// <!-- description -->
+        ///   @brief Executes the CPUID instruction given the provided EAX
+        ///     and ECX and returns the results
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rax the index used by CPUID, returns resulting rax
+        ///   @param rbx returns resulting rbx
+        ///   @param rcx the subindex used by CPUID, returns the resulting rcx
+        ///   @param rdx returns resulting rdx
+        ///
+        static constexpr void
+        cpuid(
+            bsl::safe_uint64 &rax,
+            bsl::safe_uint64 &rbx,
+            bsl::safe_uint64 &rcx,
+            bsl::safe_uint64 &rdx) noexcept
+        {
+            if (bsl::is_constant_evaluated()) {
+                return;
+            }
+
+            details::intrinsic_cpuid(rax.data(), rbx.data(), rcx.data(), rdx.data());
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of the TSC. RDTSC is not serializing,
+        ///     so this is only suitable for timing that can tolerate a
+        ///     few instructions of skew.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the value of the TSC
+        ///
+        [[nodiscard]] static constexpr auto
+        rdtsc() noexcept -> bsl::safe_uint64
+        {
+            if (bsl::is_constant_evaluated()) {
+                return {};
+            }
+
+            return details::intrinsic_rdtsc();
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of requested MSR
         ///
@@ -543,6 +680,69 @@ namespace mk
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Invalidates the TLB mappings tagged with the provided
+        ///     VPID using the INVVPID instruction.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param type the INVVPID type to execute (e.g., 1 for a
+        ///     single-context invalidation)
+        ///   @param vpid the VPID whose TLB mappings are invalidated
+        ///   @param addr the linear address to invalidate (only used by
+        ///     the individual-address type, set to 0 otherwise)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        invvpid(
+            bsl::safe_uint64 const &type,
+            bsl::safe_uint16 const &vpid,
+            bsl::safe_uint64 const &addr) noexcept -> bsl::errc_type
+        {
+            if (bsl::is_constant_evaluated()) {
+                return bsl::errc_success;
+            }
+
+            if (bsl::unlikely(!type)) {
+                bsl::error() << "invalid type: "    // --
+                             << bsl::hex(type)      // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!vpid)) {
+                bsl::error() << "invalid vpid: "    // --
+                             << bsl::hex(vpid)      // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!addr)) {
+                bsl::error() << "invalid addr: "    // --
+                             << bsl::hex(addr)      // --
+                             << bsl::endl           // --
+                             << bsl::here();        // --
+
+                return bsl::errc_failure;
+            }
+
+            auto const ret{details::intrinsic_invvpid(type.get(), vpid.get(), addr.get())};
+            if (bsl::unlikely(ret != bsl::ZERO_UMAX)) {
+                bsl::error() << "invvpid failed for vpid "    // --
+                             << bsl::hex(vpid)                // --
+                             << bsl::endl                     // --
+                             << bsl::here();                  // --
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of requested 16 bit VMCS field
         ///
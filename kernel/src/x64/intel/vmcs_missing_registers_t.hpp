@@ -76,6 +76,14 @@ namespace mk
         /// @brief stores the value of dr6 (0x080)
         bsl::uintmax dr6;
 
+        /// NOTE:
+        /// - The guest syscall MSRs are left loaded after a VMExit, and are
+        ///   only saved here once intrinsic_t::load_host_syscall_msrs is
+        ///   called on the PP they are loaded on (tls_t::loaded_syscall_msrs
+        ///   tracks which VPS is loaded, and syscall_msrs_tls tracks which
+        ///   PP this VPS is loaded on).
+        ///
+
         /// @brief stores the guest value of ia32_star (0x088)
         bsl::uintmax guest_ia32_star;
         /// @brief stores the guest value of ia32_lstar (0x090)
@@ -100,6 +108,12 @@ namespace mk
 
         /// @brief stores the launch status of the hypervisor (0x0D8)
         bsl::uintmax launched;
+
+        /// @brief stores the generation of the guest syscall MSRs (0x0E0)
+        bsl::uintmax syscall_msrs_gen;
+        /// @brief stores the TLS block of the PP the guest syscall MSRs
+        ///   are loaded on, or nullptr if they are stored here (0x0E8)
+        void *syscall_msrs_tls;
     };
 }
 
@@ -0,0 +1,326 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMCS_SHADOW_T_HPP
+#define VMCS_SHADOW_T_HPP
+
+#include <vmcs_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/is_same.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// @brief defines the number of VMCS fields stored in a vmcs_shadow_t
+    constexpr bsl::safe_uintmax VMCS_SHADOW_NUM_FIELDS{bsl::to_umax(8U)};
+    /// @brief defines the number of VMCS_SHADOW_FIELDS that can be written
+    constexpr bsl::safe_uintmax VMCS_SHADOW_NUM_WRITABLE_FIELDS{bsl::to_umax(5U)};
+
+    /// @brief defines the VMCS fields that are stored in a vmcs_shadow_t.
+    ///   The first VMCS_SHADOW_NUM_WRITABLE_FIELDS fields are guest state
+    ///   that can be written, the rest are read-only exit information.
+    constexpr bsl::array<bsl::uintmax, VMCS_SHADOW_NUM_FIELDS.get()> VMCS_SHADOW_FIELDS{
+        VMCS_GUEST_RIP.get(),
+        VMCS_GUEST_RSP.get(),
+        VMCS_GUEST_RFLAGS.get(),
+        VMCS_GUEST_CR0.get(),
+        VMCS_GUEST_CR4.get(),
+        VMCS_EXIT_REASON.get(),
+        VMCS_VMEXIT_INSTRUCTION_LENGTH.get(),
+        VMCS_EXIT_QUALIFICATION.get(),
+    };
+
+    /// @struct mk::vmcs_shadow_field_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores the shadowed value of a single VMCS field
+    ///
+    struct vmcs_shadow_field_t final
+    {
+        /// @brief stores the value of the field
+        bsl::uint64 val;
+        /// @brief true if val holds the current value of the field
+        bool valid;
+        /// @brief true if val must be written to the VMCS before a VMEntry
+        bool dirty;
+    };
+
+    /// @class mk::vmcs_shadow_t
+    ///
+    /// <!-- description -->
+    ///   @brief Stores a copy of the VMCS fields that are accessed on most
+    ///     VMExits (see VMCS_SHADOW_FIELDS) so that reads and writes of these
+    ///     fields do not require a VMREAD/VMWRITE. Fields are filled in
+    ///     after a VMExit (or lazily on the first read), and writes are held
+    ///     in the shadow until flush() is called right before the next
+    ///     VMEntry. All values are stored zero extended to 64 bits, which
+    ///     matches what VMREAD/VMWRITE do with a 64 bit operand.
+    ///
+    class vmcs_shadow_t final
+    {
+        /// @brief stores the shadowed fields
+        bsl::array<vmcs_shadow_field_t, VMCS_SHADOW_NUM_FIELDS.get()> m_fields{};
+
+        /// <!-- description -->
+        ///   @brief Returns the index of the provided VMCS field in
+        ///     VMCS_SHADOW_FIELDS, or bsl::safe_uintmax::zero(true) if
+        ///     the field is not shadowed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the VMCS field to look up
+        ///   @return Returns the index of the provided VMCS field in
+        ///     VMCS_SHADOW_FIELDS, or bsl::safe_uintmax::zero(true) if
+        ///     the field is not shadowed.
+        ///
+        [[nodiscard]] static constexpr auto
+        slot(bsl::safe_uintmax const &index) noexcept -> bsl::safe_uintmax
+        {
+            for (auto const elem : VMCS_SHADOW_FIELDS) {
+                if (index == *elem.data) {
+                    return elem.index;
+                }
+
+                bsl::touch();
+            }
+
+            return bsl::safe_uintmax::zero(true);
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Returns true if the provided VMCS field is in the shadow
+        ///     and holds the current value of the field.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the VMCS field to query
+        ///   @return Returns true if the provided VMCS field is in the shadow
+        ///     and holds the current value of the field.
+        ///
+        [[nodiscard]] constexpr auto
+        is_valid(bsl::safe_uintmax const &index) const &noexcept -> bool
+        {
+            auto const i{slot(index)};
+            if (!i) {
+                return false;
+            }
+
+            auto const *const field{m_fields.at_if(i)};
+            if (bsl::unlikely(nullptr == field)) {
+                bsl::error() << "index out of bounds: "    // --
+                             << bsl::hex(i)                // --
+                             << bsl::endl                  // --
+                             << bsl::here();               // --
+
+                return false;
+            }
+
+            return field->valid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the shadowed value of the provided VMCS field,
+        ///     truncated to FIELD_TYPE. The caller must first make sure the
+        ///     field is valid using is_valid().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam FIELD_TYPE the type (i.e., size) of field to read
+        ///   @param index the VMCS field to read
+        ///   @return Returns the shadowed value of the provided VMCS field,
+        ///     or bsl::safe_integral<FIELD_TYPE>::zero(true) on failure.
+        ///
+        template<typename FIELD_TYPE>
+        [[nodiscard]] constexpr auto
+        get(bsl::safe_uintmax const &index) const &noexcept -> bsl::safe_integral<FIELD_TYPE>
+        {
+            auto const i{slot(index)};
+            if (bsl::unlikely(!i)) {
+                bsl::error() << "vmcs field "         // --
+                             << bsl::hex(index)       // --
+                             << " is not shadowed"    // --
+                             << bsl::endl             // --
+                             << bsl::here();          // --
+
+                return bsl::safe_integral<FIELD_TYPE>::zero(true);
+            }
+
+            auto const *const field{m_fields.at_if(i)};
+            if (bsl::unlikely(nullptr == field)) {
+                bsl::error() << "index out of bounds: "    // --
+                             << bsl::hex(i)                // --
+                             << bsl::endl                  // --
+                             << bsl::here();               // --
+
+                return bsl::safe_integral<FIELD_TYPE>::zero(true);
+            }
+
+            if constexpr (bsl::is_same<FIELD_TYPE, bsl::uint16>::value) {
+                return bsl::to_u16_unsafe(field->val);
+            }
+
+            if constexpr (bsl::is_same<FIELD_TYPE, bsl::uint32>::value) {
+                return bsl::to_u32_unsafe(field->val);
+            }
+
+            if constexpr (bsl::is_same<FIELD_TYPE, bsl::uint64>::value) {
+                return bsl::to_u64(field->val);
+            }
+
+            bsl::error() << "unsupported field type\n" << bsl::here();
+            return bsl::safe_integral<FIELD_TYPE>::zero(true);
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores the value of the provided VMCS field as read from
+        ///     the VMCS. If the field is not shadowed, this does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the VMCS field that was read
+        ///   @param val the value read from the VMCS
+        ///
+        constexpr void
+        fill(bsl::safe_uintmax const &index, bsl::safe_uint64 const &val) &noexcept
+        {
+            auto const i{slot(index)};
+            if (!i) {
+                return;
+            }
+
+            auto *const field{m_fields.at_if(i)};
+            if (bsl::unlikely(nullptr == field)) {
+                bsl::error() << "index out of bounds: "    // --
+                             << bsl::hex(i)                // --
+                             << bsl::endl                  // --
+                             << bsl::here();               // --
+
+                return;
+            }
+
+            field->val = val.get();
+            field->valid = true;
+            field->dirty = false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores a value for the provided VMCS field that will
+        ///     be written to the VMCS by flush(). Returns false if the field
+        ///     is not a writable, shadowed field, in which case the caller
+        ///     must write the VMCS itself.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param index the VMCS field to write
+        ///   @param val the value to write
+        ///   @return Returns true if the write was stored in the shadow,
+        ///     false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        write(bsl::safe_uintmax const &index, bsl::safe_uint64 const &val) &noexcept -> bool
+        {
+            auto const i{slot(index)};
+            if ((!i) || (i >= VMCS_SHADOW_NUM_WRITABLE_FIELDS)) {
+                return false;
+            }
+
+            auto *const field{m_fields.at_if(i)};
+            if (bsl::unlikely(nullptr == field)) {
+                bsl::error() << "index out of bounds: "    // --
+                             << bsl::hex(i)                // --
+                             << bsl::endl                  // --
+                             << bsl::here();               // --
+
+                return false;
+            }
+
+            field->val = val.get();
+            field->valid = true;
+            field->dirty = true;
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes all of the dirty fields to the currently loaded
+        ///     VMCS. This must be called before the VMCS is used by anything
+        ///     that does not go through the shadow (e.g., a VMEntry).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
+        ///   @param intrinsic the intrinsics to use
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename INTRINSIC_CONCEPT>
+        [[nodiscard]] constexpr auto
+        flush(INTRINSIC_CONCEPT &intrinsic) &noexcept -> bsl::errc_type
+        {
+            for (auto const elem : m_fields) {
+                if (!elem.data->dirty) {
+                    continue;
+                }
+
+                auto const *const index{VMCS_SHADOW_FIELDS.at_if(elem.index)};
+                if (bsl::unlikely(nullptr == index)) {
+                    bsl::error() << "index out of bounds: "    // --
+                                 << bsl::hex(elem.index)       // --
+                                 << bsl::endl                  // --
+                                 << bsl::here();               // --
+
+                    return bsl::errc_failure;
+                }
+
+                auto const ret{
+                    intrinsic.vmwrite64(bsl::to_umax(*index), bsl::to_u64(elem.data->val))};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                elem.data->dirty = false;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Invalidates all of the fields in the shadow, dropping any
+        ///     writes that have not been flushed. This must be called after
+        ///     anything changes the VMCS without going through the shadow
+        ///     (e.g., a VMExit).
+        ///
+        constexpr void
+        invalidate() &noexcept
+        {
+            for (auto const elem : m_fields) {
+                *elem.data = {};
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,155 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMEXIT_FAST_PATH_HPP
+#define VMEXIT_FAST_PATH_HPP
+
+#include <fast_path_t.hpp>
+#include <vmexit_fast_path_ops.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    namespace details
+    {
+        /// @brief defines the NMI window VMExit reason
+        constexpr bsl::safe_uintmax EXIT_REASON_NMI_WINDOW{bsl::to_umax(8U)};
+        /// @brief defines the CPUID VMExit reason
+        constexpr bsl::safe_uintmax EXIT_REASON_CPUID{bsl::to_umax(10U)};
+        /// @brief defines the RDMSR VMExit reason
+        constexpr bsl::safe_uintmax EXIT_REASON_RDMSR{bsl::to_umax(31U)};
+        /// @brief defines the WRMSR VMExit reason
+        constexpr bsl::safe_uintmax EXIT_REASON_WRMSR{bsl::to_umax(32U)};
+
+        /// <!-- description -->
+        ///   @brief Injects the NMI that the microkernel deferred when it
+        ///     enabled NMI window exiting, and then disables NMI window
+        ///     exiting again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+        ///   @param tls the current TLS block
+        ///   @param vps_pool the VPS pool to use
+        ///   @return Returns fast_path_status_t::handled if the VMExit was
+        ///     handled, fast_path_status_t::unhandled if it must be given to
+        ///     the extension, or fast_path_status_t::failed if the VMExit
+        ///     was only partially emulated.
+        ///
+        template<typename TLS_CONCEPT, typename VPS_POOL_CONCEPT>
+        [[nodiscard]] constexpr auto
+        vmexit_fast_path_nmi_window(TLS_CONCEPT &tls, VPS_POOL_CONCEPT &vps_pool) noexcept
+            -> fast_path_status_t
+        {
+            bsl::errc_type ret{};
+
+            constexpr bsl::safe_uintmax vmcs_procbased_ctls_idx{bsl::to_umax(0x4002U)};
+            constexpr bsl::safe_uint32 vmcs_clear_nmi_window_exiting{bsl::to_u32(0xFFBFFFFFU)};
+            constexpr bsl::safe_uintmax vmcs_entry_interruption_info_idx{bsl::to_umax(0x4016U)};
+            constexpr bsl::safe_uint32 vmcs_inject_nmi{bsl::to_u32(0x80000202U)};
+
+            auto const vpsid{tls.active_vpsid};
+
+            auto val{vps_pool.template read<bsl::uint32>(tls, vpsid, vmcs_procbased_ctls_idx)};
+            if (bsl::unlikely(!val)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::unhandled;
+            }
+
+            val &= vmcs_clear_nmi_window_exiting;
+
+            ret = vps_pool.template write<bsl::uint32>(tls, vpsid, vmcs_procbased_ctls_idx, val);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::unhandled;
+            }
+
+            ret = vps_pool.template write<bsl::uint32>(
+                tls, vpsid, vmcs_entry_interruption_info_idx, vmcs_inject_nmi);
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return fast_path_status_t::failed;
+            }
+
+            return fast_path_status_t::handled;
+        }
+    }
+
+    /// <!-- description -->
+    ///   @brief Attempts to handle a VMExit in the microkernel using the
+    ///     fast path table registered by the extension. If the VMExit
+    ///     cannot be handled here, fast_path_status_t::unhandled is
+    ///     returned and the VMExit is given to the extension like normal.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam INTRINSIC_CONCEPT defines the type of intrinsics to use
+    ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+    ///   @tparam VPS_POOL_CONCEPT defines the type of VPS pool to use
+    ///   @param tls the current TLS block
+    ///   @param vps_pool the VPS pool to use
+    ///   @param fast_path the fast path table to use
+    ///   @param exit_reason the exit reason returned by the VPS
+    ///   @return Returns fast_path_status_t::handled if the VMExit was
+    ///     handled, fast_path_status_t::unhandled if it must be given to
+    ///     the extension, or fast_path_status_t::failed if the VMExit was
+    ///     only partially emulated.
+    ///
+    template<typename INTRINSIC_CONCEPT, typename TLS_CONCEPT, typename VPS_POOL_CONCEPT>
+    [[nodiscard]] constexpr auto
+    vmexit_fast_path(
+        TLS_CONCEPT &tls,
+        VPS_POOL_CONCEPT &vps_pool,
+        fast_path_t const &fast_path,
+        bsl::safe_uintmax const &exit_reason) noexcept -> fast_path_status_t
+    {
+        if (details::EXIT_REASON_NMI_WINDOW == exit_reason) {
+            if (!fast_path.is_nmi_window_enabled()) {
+                return fast_path_status_t::unhandled;
+            }
+
+            return details::vmexit_fast_path_nmi_window(tls, vps_pool);
+        }
+
+        if (details::EXIT_REASON_CPUID == exit_reason) {
+            return details::vmexit_fast_path_cpuid<INTRINSIC_CONCEPT>(tls, vps_pool, fast_path);
+        }
+
+        if (details::EXIT_REASON_RDMSR == exit_reason) {
+            return details::vmexit_fast_path_rdmsr<INTRINSIC_CONCEPT>(tls, vps_pool, fast_path);
+        }
+
+        if (details::EXIT_REASON_WRMSR == exit_reason) {
+            return details::vmexit_fast_path_wrmsr<INTRINSIC_CONCEPT>(tls, vps_pool, fast_path);
+        }
+
+        return fast_path_status_t::unhandled;
+    }
+}
+
+#endif
@@ -26,10 +26,14 @@
 #define VPS_T_HPP
 
 #include <mk_interface.hpp>
+#include <page_pool_stats_t.hpp>
 #include <vmcs_missing_registers_t.hpp>
+#include <vmcs_shadow_t.hpp>
 #include <vmcs_t.hpp>
+#include <vps_tlb_tag.hpp>
 
 #include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/finally.hpp>
 #include <bsl/is_same.hpp>
@@ -51,6 +55,27 @@ namespace mk
     {
         /// @brief defines the VMX BASIC MSR
         constexpr bsl::safe_uint32 IA32_VMX_BASIC{bsl::to_u32(0x480)};
+        /// @brief defines the VMX primary processor-based controls MSR
+        constexpr bsl::safe_uint32 IA32_VMX_PROCBASED_CTLS{bsl::to_u32(0x482)};
+        /// @brief defines the VMX secondary processor-based controls MSR
+        constexpr bsl::safe_uint32 IA32_VMX_PROCBASED_CTLS2{bsl::to_u32(0x48B)};
+        /// @brief defines the VMX EPT/VPID capabilities MSR
+        constexpr bsl::safe_uint32 IA32_VMX_EPT_VPID_CAP{bsl::to_u32(0x48C)};
+
+        /// @brief the allowed-1 bit for "activate secondary controls"
+        constexpr bsl::safe_uint64 VMX_ALLOWED1_SECONDARY_CONTROLS{
+            bsl::to_u64(0x8000000000000000U)};
+        /// @brief the allowed-1 bit for "enable VPID"
+        constexpr bsl::safe_uint64 VMX_ALLOWED1_ENABLE_VPID{bsl::to_u64(0x0000002000000000U)};
+        /// @brief the IA32_VMX_EPT_VPID_CAP bit for single-context INVVPID
+        constexpr bsl::safe_uint64 VMX_CAP_INVVPID_SINGLE{bsl::to_u64(0x0000020000000000U)};
+        /// @brief the IA32_VMX_EPT_VPID_CAP bit for all-context INVVPID
+        constexpr bsl::safe_uint64 VMX_CAP_INVVPID_ALL{bsl::to_u64(0x0000040000000000U)};
+
+        /// @brief defines the single-context INVVPID type
+        constexpr bsl::safe_uint64 INVVPID_TYPE_SINGLE{bsl::to_u64(0x1U)};
+        /// @brief defines the all-context INVVPID type
+        constexpr bsl::safe_uint64 INVVPID_TYPE_ALL{bsl::to_u64(0x2U)};
     }
 
     /// @class mk::vps_t
@@ -84,6 +109,92 @@ namespace mk
         bsl::safe_uintmax m_vmcs_phys{bsl::safe_uintmax::zero(true)};
         /// @brief stores the rest of the state the vmcs doesn't
         vmcs_missing_registers_t m_vmcs_missing_registers{};
+        /// @brief stores a shadow of the most commonly accessed vmcs fields
+        vmcs_shadow_t m_vmcs_shadow{};
+        /// @brief stores the VPID owned by this VPS
+        bsl::safe_uint16 m_vpid{bsl::safe_uint16::zero(true)};
+        /// @brief stores the INVVPID type to use, invalid if VPIDs are not supported
+        bsl::safe_uint64 m_invvpid_type{bsl::safe_uint64::zero(true)};
+        /// @brief stores the ID of the PP this VPS was last run on
+        bsl::safe_uint16 m_last_ppid{VPS_INVALID_PPID};
+
+        /// <!-- description -->
+        ///   @brief Returns the INVVPID type that should be used to flush
+        ///     the TLB entries of a single VPID. If the CPU supports VPIDs,
+        ///     but not single-context invalidations, an all-context
+        ///     invalidation is used instead. If the CPU does not support
+        ///     VPIDs, bsl::safe_uint64::zero(true) is returned.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the INVVPID type that should be used to flush
+        ///     the TLB entries of a single VPID, or
+        ///     bsl::safe_uint64::zero(true) if VPIDs are not supported.
+        ///
+        [[nodiscard]] constexpr auto
+        get_invvpid_type() const &noexcept -> bsl::safe_uint64
+        {
+            auto const ctls{m_intrinsic->rdmsr(details::IA32_VMX_PROCBASED_CTLS)};
+            if ((ctls & details::VMX_ALLOWED1_SECONDARY_CONTROLS).is_zero()) {
+                return bsl::safe_uint64::zero(true);
+            }
+
+            auto const ctls2{m_intrinsic->rdmsr(details::IA32_VMX_PROCBASED_CTLS2)};
+            if ((ctls2 & details::VMX_ALLOWED1_ENABLE_VPID).is_zero()) {
+                return bsl::safe_uint64::zero(true);
+            }
+
+            auto const cap{m_intrinsic->rdmsr(details::IA32_VMX_EPT_VPID_CAP)};
+            if (!(cap & details::VMX_CAP_INVVPID_SINGLE).is_zero()) {
+                return details::INVVPID_TYPE_SINGLE;
+            }
+
+            if (!(cap & details::VMX_CAP_INVVPID_ALL).is_zero()) {
+                return details::INVVPID_TYPE_ALL;
+            }
+
+            return bsl::safe_uint64::zero(true);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the VPID field of the VMCS to the VPID owned by
+        ///     this VPS, so that an extension only has to turn on "enable
+        ///     VPID" to get a VPID that is not shared with any other VPS.
+        ///     The VPID field only exists if the CPU supports VPIDs, so
+        ///     nothing is done if it does not.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        init_vpid() &noexcept -> bsl::errc_type
+        {
+            m_invvpid_type = this->get_invvpid_type();
+            if (!m_invvpid_type) {
+                return bsl::errc_success;
+            }
+
+            return m_intrinsic->vmwrite16(VMCS_VIRTUAL_PROCESSOR_IDENTIFIER, m_vpid);
+        }
+
+        /// <!-- description -->
+        ///   @brief Flushes the TLB entries tagged with this VPS's VPID on
+        ///     the current PP. Does nothing if VPIDs are not supported, as
+        ///     in that case, the TLB is flushed on every VMEntry/VMExit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        invvpid() &noexcept -> bsl::errc_type
+        {
+            if (!m_invvpid_type) {
+                return bsl::errc_success;
+            }
+
+            return m_intrinsic->invvpid(m_invvpid_type, m_vpid, bsl::ZERO_U64);
+        }
 
         /// <!-- description -->
         ///   @brief Stores the provided ES segment state info in the VPS.
@@ -1155,6 +1266,43 @@ namespace mk
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Ensures that the guest's syscall MSRs are stored in
+        ///     this VPS and not still loaded on a PP, so that they can be
+        ///     read or written. The MSRs can only be saved by the PP that
+        ///     they are loaded on, so this fails if that is another PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        ensure_syscall_msrs_are_saved(TLS_CONCEPT &tls) noexcept -> bsl::errc_type
+        {
+            auto const *const loaded_tls{
+                __atomic_load_n(&m_vmcs_missing_registers.syscall_msrs_tls, __ATOMIC_ACQUIRE)};
+
+            if (nullptr == loaded_tls) {
+                return bsl::errc_success;
+            }
+
+            if (bsl::unlikely(loaded_tls != tls.self)) {
+                bsl::error() << "the syscall MSRs of vps "            // --
+                             << bsl::hex(m_id)                        // --
+                             << " are still loaded on another pp"    // --
+                             << bsl::endl                             // --
+                             << bsl::here();                          // --
+
+                return bsl::errc_failure;
+            }
+
+            m_intrinsic->load_host_syscall_msrs();
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Ensures that this VPS is loaded
         ///
@@ -1374,6 +1522,12 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            m_vpid = vps_tlb_tag(i);
+            if (bsl::unlikely(!m_vpid)) {
+                bsl::error() << "invalid vpid\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
             release_on_error.ignore();
             m_initialized = true;
 
@@ -1389,6 +1543,7 @@ namespace mk
             this->deallocate();
 
             m_next = {};
+            m_vpid = bsl::safe_uint16::zero(true);
             m_id = bsl::safe_uint16::zero(true);
             m_page_pool = {};
             m_intrinsic = {};
@@ -1492,7 +1647,7 @@ namespace mk
                 this->release();
             }};
 
-            m_vmcs = m_page_pool->template allocate<vmcs_t>();
+            m_vmcs = m_page_pool->template allocate<vmcs_t>(tls, loader::PAGE_POOL_OWNER_VPS);
             if (bsl::unlikely(nullptr == m_vmcs)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -1509,6 +1664,11 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            if (bsl::unlikely(!this->init_vpid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
             /// TODO:
             /// - Extensions should not be able to touch host state fields.
             ///
@@ -1525,11 +1685,40 @@ namespace mk
         constexpr void
         deallocate() &noexcept
         {
-            m_vmcs_missing_registers = {};
+            if (nullptr != m_intrinsic) {
+                m_intrinsic->load_host_syscall_msrs();
+            }
+            else {
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - Other PPs might still think that they have this VPS's
+            ///   syscall MSRs loaded. Bumping the generation first tells
+            ///   them that the guest's values are gone. The host values are
+            ///   kept as those PPs still need them to restore their own.
+            ///
+
+            auto *const gen_ptr{&m_vmcs_missing_registers.syscall_msrs_gen};
+            auto const gen{bsl::safe_uintmax{*gen_ptr} + bsl::ONE_UMAX};
+            __atomic_store_n(gen_ptr, gen.get(), __ATOMIC_RELEASE);
+
+            vmcs_missing_registers_t regs{};
+            regs.host_ia32_star = m_vmcs_missing_registers.host_ia32_star;
+            regs.host_ia32_lstar = m_vmcs_missing_registers.host_ia32_lstar;
+            regs.host_ia32_cstar = m_vmcs_missing_registers.host_ia32_cstar;
+            regs.host_ia32_fmask = m_vmcs_missing_registers.host_ia32_fmask;
+            regs.host_ia32_kernel_gs_base = m_vmcs_missing_registers.host_ia32_kernel_gs_base;
+            regs.syscall_msrs_gen = gen.get();
+
+            m_vmcs_missing_registers = regs;
+            m_vmcs_shadow.invalidate();
+            m_last_ppid = VPS_INVALID_PPID;
+            m_invvpid_type = bsl::safe_uint64::zero(true);
             m_vmcs_phys = bsl::safe_uintmax::zero(true);
 
             if (nullptr != m_page_pool) {
-                m_page_pool->deallocate(m_vmcs);
+                m_page_pool->deallocate(m_vmcs, loader::PAGE_POOL_OWNER_VPS);
                 m_vmcs = {};
             }
             else {
@@ -1572,6 +1761,13 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            /// NOTE:
+            /// - The guest fields in the shadow are all written directly to
+            ///   the VMCS below, so anything in the shadow is now stale.
+            ///
+
+            m_vmcs_shadow.invalidate();
+
             m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_RAX, state->rax);
             m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_RBX, state->rbx);
             m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_RCX, state->rcx);
@@ -1708,6 +1904,11 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
             m_vmcs_missing_registers.guest_ia32_star = state->ia32_star;
             m_vmcs_missing_registers.guest_ia32_lstar = state->ia32_lstar;
             m_vmcs_missing_registers.guest_ia32_cstar = state->ia32_cstar;
@@ -1793,6 +1994,11 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            if (bsl::unlikely(!m_vmcs_shadow.flush(*m_intrinsic))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
             state->rax = m_intrinsic->tls_reg(syscall::TLS_OFFSET_RAX).get();
             state->rbx = m_intrinsic->tls_reg(syscall::TLS_OFFSET_RBX).get();
             state->rcx = m_intrinsic->tls_reg(syscall::TLS_OFFSET_RCX).get();
@@ -1931,6 +2137,11 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
             state->ia32_star = m_vmcs_missing_registers.guest_ia32_star;
             state->ia32_lstar = m_vmcs_missing_registers.guest_ia32_lstar;
             state->ia32_cstar = m_vmcs_missing_registers.guest_ia32_cstar;
@@ -2015,6 +2226,12 @@ namespace mk
                 return bsl::safe_integral<FIELD_TYPE>::zero(true);
             }
 
+            if constexpr (!bsl::is_same<FIELD_TYPE, bsl::uint8>::value) {
+                if (m_vmcs_shadow.is_valid(index)) {
+                    return m_vmcs_shadow.template get<FIELD_TYPE>(index);
+                }
+            }
+
             if (bsl::unlikely(!this->ensure_this_vps_is_loaded(tls))) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::safe_integral<FIELD_TYPE>::zero(true);
@@ -2047,6 +2264,7 @@ namespace mk
                     return val;
                 }
 
+                m_vmcs_shadow.fill(index, val);
                 return val;
             }
 
@@ -2164,6 +2382,12 @@ namespace mk
                 }
             }
 
+            if constexpr (!bsl::is_same<FIELD_TYPE, bsl::uint8>::value) {
+                if (m_vmcs_shadow.write(index, bsl::to_u64(sanitized))) {
+                    return bsl::errc_success;
+                }
+            }
+
             if constexpr (bsl::is_same<FIELD_TYPE, bsl::uint16>::value) {
                 ret = m_intrinsic->vmwrite16(index, sanitized);
                 if (bsl::unlikely(!ret)) {
@@ -2510,18 +2734,38 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_star: {
+                    if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::safe_uintmax::zero(true);
+                    }
+
                     return m_vmcs_missing_registers.guest_ia32_star;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_lstar: {
+                    if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::safe_uintmax::zero(true);
+                    }
+
                     return m_vmcs_missing_registers.guest_ia32_lstar;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_cstar: {
+                    if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::safe_uintmax::zero(true);
+                    }
+
                     return m_vmcs_missing_registers.guest_ia32_cstar;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_fmask: {
+                    if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::safe_uintmax::zero(true);
+                    }
+
                     return m_vmcs_missing_registers.guest_ia32_fmask;
                 }
 
@@ -2536,6 +2780,11 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_kernel_gs_base: {
+                    if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::safe_uintmax::zero(true);
+                    }
+
                     return m_vmcs_missing_registers.guest_ia32_kernel_gs_base;
                 }
 
@@ -2920,21 +3169,41 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_star: {
+                    if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
                     m_vmcs_missing_registers.guest_ia32_star = val.get();
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_lstar: {
+                    if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
                     m_vmcs_missing_registers.guest_ia32_lstar = val.get();
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_cstar: {
+                    if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
                     m_vmcs_missing_registers.guest_ia32_cstar = val.get();
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_fmask: {
+                    if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
                     m_vmcs_missing_registers.guest_ia32_fmask = val.get();
                     return bsl::errc_success;
                 }
@@ -2950,6 +3219,11 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ia32_kernel_gs_base: {
+                    if (bsl::unlikely(!this->ensure_syscall_msrs_are_saved(tls))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
                     m_vmcs_missing_registers.guest_ia32_kernel_gs_base = val.get();
                     return bsl::errc_success;
                 }
@@ -3021,7 +3295,52 @@ namespace mk
                 return bsl::safe_uintmax::zero(true);
             }
 
+            if (bsl::unlikely(!m_vmcs_shadow.flush(*m_intrinsic))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            /// NOTE:
+            /// - If the guest's syscall MSRs are still loaded on another PP,
+            ///   only that PP can save them, so running this VPS here would
+            ///   hand the guest stale values.
+            ///
+
+            auto const *const loaded_tls{
+                __atomic_load_n(&m_vmcs_missing_registers.syscall_msrs_tls, __ATOMIC_ACQUIRE)};
+
+            if (bsl::unlikely((nullptr != loaded_tls) && (loaded_tls != tls.self))) {
+                bsl::error() << "the syscall MSRs of vps "            // --
+                             << bsl::hex(m_id)                        // --
+                             << " are still loaded on another pp"    // --
+                             << bsl::endl                             // --
+                             << bsl::here();                          // --
+
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            /// NOTE:
+            /// - Any TLB entries tagged with our VPID on this PP are stale
+            ///   if this VPS did not run here last (they were either
+            ///   created the last time this VPS ran here, or by a
+            ///   destroyed VPS that owned the same VPID).
+            ///
+
+            if (tls.ppid() != m_last_ppid) {
+                if (bsl::unlikely(!this->invvpid())) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::safe_uintmax::zero(true);
+                }
+
+                m_last_ppid = tls.ppid();
+            }
+            else {
+                bsl::touch();
+            }
+
             auto const exit_reason{details::intrinsic_vmrun(&m_vmcs_missing_registers)};
+            m_vmcs_shadow.invalidate();
+
             if (invalid_exit_reason == exit_reason) {
                 this->dump(tls);
 
@@ -3034,49 +3353,95 @@ namespace mk
             ///   what the error was and why.
             ///
 
+            m_vmcs_shadow.fill(VMCS_EXIT_REASON, bsl::to_u64(exit_reason));
             return exit_reason;
         }
 
         /// <!-- description -->
-        ///   @brief Advance the IP of the VPS
+        ///   @brief Fills in the exit information block of the extension's
+        ///     TLS block, so that most VMExit handlers do not have to read
+        ///     these fields from the VMCS using a syscall. This is only
+        ///     called for VMExits that are given to the extension, so
+        ///     VMExits handled by the fast path only read the fields they
+        ///     need. Shadowed fields that were already read are not read
+        ///     from the VMCS again.
         ///
         /// <!-- inputs/outputs -->
         ///   @tparam TLS_CONCEPT defines the type of TLS block to use
         ///   @param tls the current TLS block
+        ///   @param exit_reason the reason for the VMExit
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
         template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        advance_ip(TLS_CONCEPT &tls) &noexcept -> bsl::errc_type
+        set_exit_info(TLS_CONCEPT &tls, bsl::safe_uintmax const &exit_reason) &noexcept
+            -> bsl::errc_type
         {
-            bsl::errc_type ret{};
-            bsl::safe_uint64 rip{};
-            bsl::safe_uint64 len{};
-
-            if (bsl::unlikely(!m_allocated)) {
-                bsl::error() << "invalid vps\n" << bsl::here();
+            auto const exit_qualification{
+                this->template read<bsl::uint64>(tls, VMCS_EXIT_QUALIFICATION)};
+            auto const guest_linear_address{
+                this->template read<bsl::uint64>(tls, VMCS_GUEST_LINEAR_ADDRESS)};
+            auto const guest_physical_address{
+                this->template read<bsl::uint64>(tls, VMCS_GUEST_PHYSICAL_ADDRESS)};
+            auto const interruption_info{
+                this->template read<bsl::uint64>(tls, VMCS_VMEXIT_INTERRUPTION_INFORMATION)};
+            auto const rip{this->template read<bsl::uint64>(tls, VMCS_GUEST_RIP)};
+            auto const len{this->template read<bsl::uint64>(tls, VMCS_VMEXIT_INSTRUCTION_LENGTH)};
+
+            if (bsl::unlikely(!exit_qualification)) {
+                bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
 
-            if (bsl::unlikely(!this->ensure_this_vps_is_loaded(tls))) {
+            if (bsl::unlikely((!guest_linear_address) || (!guest_physical_address))) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
 
-            ret = m_intrinsic->vmread64(VMCS_GUEST_RIP, rip.data());
-            if (bsl::unlikely(!ret)) {
+            if (bsl::unlikely((!interruption_info) || (!rip) || (!len))) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
 
-            ret = m_intrinsic->vmread64(VMCS_VMEXIT_INSTRUCTION_LENGTH, len.data());
-            if (bsl::unlikely(!ret)) {
+            m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_REASON, exit_reason);
+            m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_INFO1, exit_qualification);
+            m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_INFO2, guest_linear_address);
+            m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_GPA, guest_physical_address);
+            m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_INTR_INFO, interruption_info);
+            m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_RIP, rip);
+            m_intrinsic->set_tls_reg(syscall::TLS_OFFSET_EXIT_INSTR_LEN, len);
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Advance the IP of the VPS
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        advance_ip(TLS_CONCEPT &tls) &noexcept -> bsl::errc_type
+        {
+            /// NOTE:
+            /// - Both fields are read from the VMCS at most once per VMExit,
+            ///   and this only updates the shadow's copy of the guest RIP,
+            ///   which is written to the VMCS on the next VMEntry.
+            ///
+
+            auto const rip{this->template read<bsl::uint64>(tls, VMCS_GUEST_RIP)};
+            auto const len{this->template read<bsl::uint64>(tls, VMCS_VMEXIT_INSTRUCTION_LENGTH)};
+            if (bsl::unlikely((!rip) || (!len))) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
 
-            ret = m_intrinsic->vmwrite64(VMCS_GUEST_RIP, rip + len);
+            auto const ret{this->template write<bsl::uint64>(tls, VMCS_GUEST_RIP, rip + len)};
             if (bsl::unlikely(!ret)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return ret;
@@ -3085,6 +3450,36 @@ namespace mk
             return ret;
         }
 
+        /// <!-- description -->
+        ///   @brief Flushes the TLB entries tagged with this VPS's VPID on
+        ///     the current PP using a single-context INVVPID, which leaves
+        ///     the TLB entries of every other VPS (and the host) alone.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        flush_tlb(TLS_CONCEPT &tls) &noexcept -> bsl::errc_type
+        {
+            bsl::discard(tls);
+
+            if (bsl::unlikely(!m_allocated)) {
+                bsl::error() << "invalid vps\n" << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            if (bsl::unlikely(!this->invvpid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the contents of a VMCS field to the console
         ///
@@ -3256,6 +3651,11 @@ namespace mk
                 return;
             }
 
+            if (bsl::unlikely(!m_vmcs_shadow.flush(*m_intrinsic))) {
+                bsl::print<bsl::V>() << bsl::here();
+                return;
+            }
+
             // clang-format off
 
             bsl::print<bsl::V>() << bsl::bold_magenta << "VPS" << bsl::reset_color;
@@ -3313,6 +3713,7 @@ namespace mk
             this->dump_missing_register(
                 "dr6", type_64bit_m, m_vmcs_missing_registers.dr6);
 
+            bsl::discard(this->ensure_syscall_msrs_are_saved(tls));
             this->dump_missing_register(
                 "guest_ia32_star", type_64bit_m, m_vmcs_missing_registers.guest_ia32_star);
             this->dump_missing_register(
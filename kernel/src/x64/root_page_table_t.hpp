@@ -77,6 +77,8 @@ namespace mk
         bsl::safe_uintmax m_pml4t_phys;
         /// @brief stores the map cursor used for mapping when needed
         bsl::safe_uintmax m_map_cursor{MAP_ADDR};
+        /// @brief stores the page pool owner that pages are charged to
+        bsl::safe_uintmax m_owner{};
 
         /// <!-- description -->
         ///   @brief Returns the index of the last entry present in a page
@@ -316,16 +318,20 @@ namespace mk
         ///   @brief Adds a pdpt_t to the provided pml4te_t.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param pml4te the pml4te_t to add a pdpt_t too
         ///   @param us if true, this function will map the table with
         ///     userspace privileges.
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        add_pdpt(loader::pml4te_t *const pml4te, bool const us) noexcept -> bsl::errc_type
+        add_pdpt(TLS_CONCEPT &tls, loader::pml4te_t *const pml4te, bool const us) noexcept
+            -> bsl::errc_type
         {
-            auto const *const table{m_page_pool->template allocate<void>()};
+            auto const *const table{m_page_pool->template allocate<void>(tls, m_owner)};
             if (bsl::unlikely(nullptr == table)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -369,7 +375,7 @@ namespace mk
                 }
             }
 
-            m_page_pool->deallocate(get_pdpt(pml4te));
+            m_page_pool->deallocate(get_pdpt(pml4te), m_owner);
         }
 
         /// <!-- description -->
@@ -459,16 +465,20 @@ namespace mk
         ///   @brief Adds a pdt_t to the provided pdpte_t.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param pdpte the pdpte_t to add a pdt_t too
         ///   @param us if true, this function will map the table with
         ///     userspace privileges.
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        add_pdt(loader::pdpte_t *const pdpte, bool const us) noexcept -> bsl::errc_type
+        add_pdt(TLS_CONCEPT &tls, loader::pdpte_t *const pdpte, bool const us) noexcept
+            -> bsl::errc_type
         {
-            auto const *const table{m_page_pool->template allocate<void>()};
+            auto const *const table{m_page_pool->template allocate<void>(tls, m_owner)};
             if (bsl::unlikely(nullptr == table)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -512,7 +522,7 @@ namespace mk
                 }
             }
 
-            m_page_pool->deallocate(get_pdt(pdpte));
+            m_page_pool->deallocate(get_pdt(pdpte), m_owner);
         }
 
         /// <!-- description -->
@@ -599,6 +609,10 @@ namespace mk
                 o << bsl::blue;
                 this->output_entry_and_flags(o, elem.data);
 
+                if (bsl::ZERO_UMAX != elem.data->ps) {
+                    continue;
+                }
+
                 this->dump_pt(
                     o,
                     this->get_pt(elem.data),
@@ -612,16 +626,20 @@ namespace mk
         ///   @brief Adds a pt_t to the provided pdte_t.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param pdte the pdte_t to add a pt_t too
         ///   @param us if true, this function will map the table with
         ///     userspace privileges.
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        add_pt(loader::pdte_t *const pdte, bool const us) noexcept -> bsl::errc_type
+        add_pt(TLS_CONCEPT &tls, loader::pdte_t *const pdte, bool const us) noexcept
+            -> bsl::errc_type
         {
-            auto const *const table{m_page_pool->template allocate<void>()};
+            auto const *const table{m_page_pool->template allocate<void>(tls, m_owner)};
             if (bsl::unlikely(nullptr == table)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -656,7 +674,7 @@ namespace mk
         constexpr void
         remove_pt(loader::pdte_t *const pdte) noexcept
         {
-            m_page_pool->deallocate(get_pt(pdte));
+            m_page_pool->deallocate(get_pt(pdte), m_owner);
         }
 
         /// <!-- description -->
@@ -780,6 +798,8 @@ namespace mk
         ///     by this class.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param page_virt the virtual address to map the physical address
         ///     too
         ///   @param page_phys the physical address to map
@@ -793,8 +813,10 @@ namespace mk
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
         map_page(
+            TLS_CONCEPT &tls,
             bsl::safe_uintmax const &page_virt,
             bsl::safe_uintmax const &page_phys,
             bool const executable,
@@ -803,7 +825,7 @@ namespace mk
         {
             auto *const pml4te{m_pml4t->entries.at_if(this->pml4to(page_virt))};
             if (pml4te->p == bsl::ZERO_UMAX) {
-                if (bsl::unlikely(!this->add_pdpt(pml4te, us))) {
+                if (bsl::unlikely(!this->add_pdpt(tls, pml4te, us))) {
                     bsl::print<bsl::V>() << bsl::here();
                     return bsl::errc_failure;
                 }
@@ -841,7 +863,7 @@ namespace mk
 
             auto *const pdpte{this->get_pdpt(pml4te)->entries.at_if(this->pdpto(page_virt))};
             if (pdpte->p == bsl::ZERO_UMAX) {
-                if (bsl::unlikely(!this->add_pdt(pdpte, us))) {
+                if (bsl::unlikely(!this->add_pdt(tls, pdpte, us))) {
                     bsl::print<bsl::V>() << bsl::here();
                     return bsl::errc_failure;
                 }
@@ -854,7 +876,7 @@ namespace mk
 
             auto *const pdte{this->get_pdt(pdpte)->entries.at_if(this->pdto(page_virt))};
             if (pdte->p == bsl::ZERO_UMAX) {
-                if (bsl::unlikely(!this->add_pt(pdte, us))) {
+                if (bsl::unlikely(!this->add_pt(tls, pdte, us))) {
                     bsl::print<bsl::V>() << bsl::here();
                     return bsl::errc_failure;
                 }
@@ -905,6 +927,178 @@ namespace mk
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Allocates a page from the provided page pool and maps it
+        ///     into the root page table being managed by this class. The
+        ///     page is marked as "auto release".
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param page_virt the virtual address to map the page too
+        ///   @param executable if true, the page is mapped as read/execute,
+        ///     otherwise the page is mapped as read/write
+        ///   @param zero if true, the page is zeroed, otherwise the contents
+        ///     of the page are undefined
+        ///   @return Returns a pointer to the allocated page, or a nullptr
+        ///     on failure.
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        allocate_page(
+            TLS_CONCEPT &tls,
+            bsl::safe_uintmax const &page_virt,
+            bool const executable,
+            bool const zero) &noexcept -> void *
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return nullptr;
+            }
+
+            if (bsl::unlikely(!page_virt)) {
+                bsl::error() << "virtual address is invalid: "    // --
+                             << bsl::hex(page_virt)               // --
+                             << bsl::endl                         // --
+                             << bsl::here();                      // --
+
+                return nullptr;
+            }
+
+            if (bsl::unlikely(!this->is_page_aligned(page_virt))) {
+                bsl::error() << "virtual address is not page aligned: "    // --
+                             << bsl::hex(page_virt)                        // --
+                             << bsl::endl                                  // --
+                             << bsl::here();                               // --
+
+                return nullptr;
+            }
+
+            void *page{};
+            if (zero) {
+                page = m_page_pool->template allocate<void>(tls, m_owner);
+            }
+            else {
+                page = m_page_pool->template allocate_uninit<void>(tls, m_owner);
+            }
+
+            if (bsl::unlikely(nullptr == page)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return nullptr;
+            }
+
+            auto const page_phys{m_page_pool->virt_to_phys(page)};
+            if (bsl::unlikely(!page_phys)) {
+                bsl::error() << "physical address is invalid: "    // --
+                             << bsl::hex(page_phys)                // --
+                             << bsl::endl                          // --
+                             << bsl::here();                       // --
+
+                return nullptr;
+            }
+
+            auto const ret{this->map_page(tls, page_virt, page_phys, executable, true, true)};
+            if (bsl::unlikely(!ret)) {
+                m_page_pool->deallocate(tls, page, m_owner);
+                bsl::print<bsl::V>() << bsl::here();
+                return nullptr;
+            }
+
+            return page;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the PTE that maps the provided userspace virtual
+        ///     address, or a nullptr if the address is invalid, is owned by
+        ///     the kernel or was never mapped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_virt the virtual address to look up
+        ///   @return Returns the PTE that maps the provided userspace virtual
+        ///     address, or a nullptr on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        find_user_pte(bsl::safe_uintmax const &page_virt) &noexcept -> loader::pte_t *
+        {
+            if (bsl::unlikely(!m_initialized)) {
+                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
+                return nullptr;
+            }
+
+            if (bsl::unlikely(!page_virt)) {
+                bsl::error() << "virtual address is invalid: "    // --
+                             << bsl::hex(page_virt)               // --
+                             << bsl::endl                         // --
+                             << bsl::here();                      // --
+
+                return nullptr;
+            }
+
+            if (bsl::unlikely(!this->is_page_aligned(page_virt))) {
+                bsl::error() << "virtual address is not page aligned: "    // --
+                             << bsl::hex(page_virt)                        // --
+                             << bsl::endl                                  // --
+                             << bsl::here();                               // --
+
+                return nullptr;
+            }
+
+            auto *const pml4te{m_pml4t->entries.at_if(this->pml4to(page_virt))};
+            if (bsl::unlikely(pml4te->p == bsl::ZERO_UMAX)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " was never mapped"    // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return nullptr;
+            }
+
+            if (bsl::unlikely(pml4te->us == bsl::ZERO_UMAX)) {
+                bsl::error() << "virtual address is owned by the kernel: "    // --
+                             << bsl::hex(page_virt)                           // --
+                             << bsl::endl                                     // --
+                             << bsl::here();                                  // --
+
+                return nullptr;
+            }
+
+            auto *const pdpte{this->get_pdpt(pml4te)->entries.at_if(this->pdpto(page_virt))};
+            if (bsl::unlikely(pdpte->p == bsl::ZERO_UMAX)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " was never mapped"    // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return nullptr;
+            }
+
+            auto *const pdte{this->get_pdt(pdpte)->entries.at_if(this->pdto(page_virt))};
+            if (bsl::unlikely(pdte->p == bsl::ZERO_UMAX)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " was never mapped"    // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return nullptr;
+            }
+
+            auto *const pte{this->get_pt(pdte)->entries.at_if(this->pto(page_virt))};
+            if (bsl::unlikely(pte->p == bsl::ZERO_UMAX)) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " was never mapped"    // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return nullptr;
+            }
+
+            return pte;
+        }
+
     public:
         /// @brief an alias for INTRINSIC_CONCEPT
         using intrinsic_type = INTRINSIC_CONCEPT;
@@ -922,12 +1116,16 @@ namespace mk
         /// <!-- inputs/outputs -->
         ///   @param intrinsic the intrinsics to use
         ///   @param page_pool the page pool to use
+        ///   @param owner the page pool owner that pages are charged to
+        ///     (see loader::page_pool_stats_t)
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
         [[nodiscard]] constexpr auto
-        initialize(INTRINSIC_CONCEPT *const intrinsic, PAGE_POOL_CONCEPT *const page_pool) &noexcept
-            -> bsl::errc_type
+        initialize(
+            INTRINSIC_CONCEPT *const intrinsic,
+            PAGE_POOL_CONCEPT *const page_pool,
+            bsl::safe_uintmax const &owner) &noexcept -> bsl::errc_type
         {
             if (bsl::unlikely(m_initialized)) {
                 bsl::error() << "root_page_table_t already initialized\n" << bsl::here();
@@ -950,7 +1148,9 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            m_pml4t = m_page_pool->template allocate<pml4t_t>();
+            m_owner = owner;
+
+            m_pml4t = m_page_pool->template allocate<pml4t_t>(m_owner);
             if (bsl::unlikely(nullptr == m_pml4t)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
@@ -992,12 +1192,13 @@ namespace mk
                     bsl::touch();
                 }
 
-                m_page_pool->deallocate(m_pml4t);
+                m_page_pool->deallocate(m_pml4t, m_owner);
             }
             else {
                 bsl::touch();
             }
 
+            m_owner = {};
             m_map_cursor = {};
             m_pml4t = {};
             m_page_pool = {};
@@ -1140,14 +1341,18 @@ namespace mk
         ///     ensure the entire root VP state is mapped in as needed.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
         ///   @tparam STATE_SAVE_CONCEPT the type of state save to use
+        ///   @param tls the current TLS block
         ///   @param root_vp_state the state of the root_vp
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
-        template<typename STATE_SAVE_CONCEPT>
+        template<typename TLS_CONCEPT, typename STATE_SAVE_CONCEPT>
         [[nodiscard]] constexpr auto
-        add_root_vp_state(STATE_SAVE_CONCEPT const *const root_vp_state) &noexcept -> bsl::errc_type
+        add_root_vp_state(
+            TLS_CONCEPT &tls, STATE_SAVE_CONCEPT const *const root_vp_state) &noexcept
+            -> bsl::errc_type
         {
             if (bsl::unlikely(!m_initialized)) {
                 bsl::error() << "root_page_table_t already initialized\n" << bsl::here();
@@ -1168,7 +1373,7 @@ namespace mk
 
             virt = MAP_ADDR + m_map_cursor;
             m_map_cursor += PAGE_SIZE;
-            if (!this->map_page(virt, cr3_phys, false, false, false)) {
+            if (!this->map_page(tls, virt, cr3_phys, false, false, false)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
@@ -1189,7 +1394,7 @@ namespace mk
 
             virt = MAP_ADDR + m_map_cursor;
             m_map_cursor += PAGE_SIZE;
-            if (!this->map_page(virt, phys, false, false, false)) {
+            if (!this->map_page(tls, virt, phys, false, false, false)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
@@ -1210,7 +1415,7 @@ namespace mk
 
             virt = MAP_ADDR + m_map_cursor;
             m_map_cursor += PAGE_SIZE;
-            if (!this->map_page(virt, phys, false, false, false)) {
+            if (!this->map_page(tls, virt, phys, false, false, false)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
@@ -1231,7 +1436,7 @@ namespace mk
 
             virt = MAP_ADDR + m_map_cursor;
             m_map_cursor += PAGE_SIZE;
-            if (!this->map_page(virt, phys, false, false, false)) {
+            if (!this->map_page(tls, virt, phys, false, false, false)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
@@ -1250,7 +1455,7 @@ namespace mk
             }
 
             phys = pte->phys << bsl::to_umax(PAGE_SHIFT);
-            if (!this->map_page(gdt_virt, phys, false, false, false)) {
+            if (!this->map_page(tls, gdt_virt, phys, false, false, false)) {
                 bsl::print<bsl::V>() << bsl::here();
                 return bsl::errc_failure;
             }
@@ -1263,15 +1468,17 @@ namespace mk
         ///     by this class using read/write permissions.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
         ///   @tparam T defines the type of virtual address being mapped
+        ///   @param tls the current TLS block
         ///   @param page_virt the virtual address to map the physical address
         ///     too
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
-        template<typename T>
+        template<typename TLS_CONCEPT, typename T>
         [[nodiscard]] constexpr auto
-        map_page_rw(T const page_virt) &noexcept -> bsl::errc_type
+        map_page_rw(TLS_CONCEPT &tls, T const page_virt) &noexcept -> bsl::errc_type
         {
             static_assert(bsl::is_pointer<T>::value);
             static_assert(bsl::is_standard_layout<T>::value);
@@ -1309,7 +1516,7 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            return this->map_page(bsl::to_umax(page_virt), page_phys, false, true, false);
+            return this->map_page(tls, bsl::to_umax(page_virt), page_phys, false, true, false);
         }
 
         /// <!-- description -->
@@ -1317,15 +1524,19 @@ namespace mk
         ///     by this class using read/write permissions.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param page_virt the virtual address to map the physical address too
         ///   @param page_phys the physical address to map
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
         map_page_rw(
-            bsl::safe_uintmax const &page_virt, bsl::safe_uintmax const &page_phys) &noexcept
-            -> bsl::errc_type
+            TLS_CONCEPT &tls,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &page_phys) &noexcept -> bsl::errc_type
         {
             if (bsl::unlikely(!m_initialized)) {
                 bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
@@ -1368,7 +1579,7 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            return this->map_page(page_virt, page_phys, false, true, false);
+            return this->map_page(tls, page_virt, page_phys, false, true, false);
         }
 
         /// <!-- description -->
@@ -1376,14 +1587,16 @@ namespace mk
         ///     by this class using read/execute permissions.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
         ///   @tparam T defines the type of virtual address being mapped
+        ///   @param tls the current TLS block
         ///   @param page_virt the virtual address to map the physical address too
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
-        template<typename T>
+        template<typename TLS_CONCEPT, typename T>
         [[nodiscard]] constexpr auto
-        map_page_rx(T const page_virt) &noexcept -> bsl::errc_type
+        map_page_rx(TLS_CONCEPT &tls, T const page_virt) &noexcept -> bsl::errc_type
         {
             static_assert(bsl::is_pointer<T>::value);
             static_assert(bsl::is_standard_layout<T>::value);
@@ -1421,7 +1634,7 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            return this->map_page(bsl::to_umax(page_virt), page_phys, true, true, false);
+            return this->map_page(tls, bsl::to_umax(page_virt), page_phys, true, true, false);
         }
 
         /// <!-- description -->
@@ -1429,15 +1642,19 @@ namespace mk
         ///     by this class using read/execute permissions.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param page_virt the virtual address to map the physical address too
         ///   @param page_phys the physical address to map
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     otherwise
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
         map_page_rx(
-            bsl::safe_uintmax const &page_virt, bsl::safe_uintmax const &page_phys) &noexcept
-            -> bsl::errc_type
+            TLS_CONCEPT &tls,
+            bsl::safe_uintmax const &page_virt,
+            bsl::safe_uintmax const &page_phys) &noexcept -> bsl::errc_type
         {
             if (bsl::unlikely(!m_initialized)) {
                 bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
@@ -1480,7 +1697,7 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            return this->map_page(page_virt, page_phys, true, true, false);
+            return this->map_page(tls, page_virt, page_phys, true, true, false);
         }
 
         /// <!-- description -->
@@ -1492,58 +1709,36 @@ namespace mk
         ///     and put back into the provided page pool.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param page_virt the virtual address to map the page too
         ///   @return Returns a pointer to the allocated page, or a nullptr
         ///     on failure.
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        allocate_rw(bsl::safe_uintmax const &page_virt) &noexcept -> void *
+        allocate_rw(TLS_CONCEPT &tls, bsl::safe_uintmax const &page_virt) &noexcept -> void *
         {
-            if (bsl::unlikely(!m_initialized)) {
-                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
-                return nullptr;
-            }
-
-            if (bsl::unlikely(!page_virt)) {
-                bsl::error() << "virtual address is invalid: "    // --
-                             << bsl::hex(page_virt)               // --
-                             << bsl::endl                         // --
-                             << bsl::here();                      // --
-
-                return nullptr;
-            }
-
-            if (bsl::unlikely(!this->is_page_aligned(page_virt))) {
-                bsl::error() << "virtual address is not page aligned: "    // --
-                             << bsl::hex(page_virt)                        // --
-                             << bsl::endl                                  // --
-                             << bsl::here();                               // --
-
-                return nullptr;
-            }
-
-            auto *const page{m_page_pool->template allocate<void>()};
-            if (bsl::unlikely(nullptr == page)) {
-                bsl::print<bsl::V>() << bsl::here();
-                return nullptr;
-            }
-
-            auto const page_phys{m_page_pool->virt_to_phys(page)};
-            if (bsl::unlikely(!page_phys)) {
-                bsl::error() << "physical address is invalid: "    // --
-                             << bsl::hex(page_phys)                // --
-                             << bsl::endl                          // --
-                             << bsl::here();                       // --
-
-                return nullptr;
-            }
-
-            if (bsl::unlikely(!this->map_page(page_virt, page_phys, false, true, true))) {
-                bsl::print<bsl::V>() << bsl::here();
-                return nullptr;
-            }
+            return this->allocate_page(tls, page_virt, false, true);
+        }
 
-            return page;
+        /// <!-- description -->
+        ///   @brief Same as allocate_rw() with the exception that the
+        ///     resulting page is not zeroed, meaning its contents are
+        ///     undefined. The caller must initialize the entire page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param page_virt the virtual address to map the page too
+        ///   @return Returns a pointer to the allocated page, or a nullptr
+        ///     on failure.
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        allocate_uninit_rw(TLS_CONCEPT &tls, bsl::safe_uintmax const &page_virt) &noexcept -> void *
+        {
+            return this->allocate_page(tls, page_virt, false, false);
         }
 
         /// <!-- description -->
@@ -1555,58 +1750,36 @@ namespace mk
         ///     and put back into the provided page pool.
         ///
         /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
         ///   @param page_virt the virtual address to map the page too
         ///   @return Returns a pointer to the allocated page, or a nullptr
         ///     on failure.
         ///
+        template<typename TLS_CONCEPT>
         [[nodiscard]] constexpr auto
-        allocate_rx(bsl::safe_uintmax const &page_virt) &noexcept -> void *
+        allocate_rx(TLS_CONCEPT &tls, bsl::safe_uintmax const &page_virt) &noexcept -> void *
         {
-            if (bsl::unlikely(!m_initialized)) {
-                bsl::error() << "root_page_table_t not initialized\n" << bsl::here();
-                return nullptr;
-            }
-
-            if (bsl::unlikely(!page_virt)) {
-                bsl::error() << "virtual address is invalid: "    // --
-                             << bsl::hex(page_virt)               // --
-                             << bsl::endl                         // --
-                             << bsl::here();                      // --
-
-                return nullptr;
-            }
-
-            if (bsl::unlikely(!this->is_page_aligned(page_virt))) {
-                bsl::error() << "virtual address is not page aligned: "    // --
-                             << bsl::hex(page_virt)                        // --
-                             << bsl::endl                                  // --
-                             << bsl::here();                               // --
-
-                return nullptr;
-            }
-
-            auto *const page{m_page_pool->template allocate<void>()};
-            if (bsl::unlikely(nullptr == page)) {
-                bsl::print<bsl::V>() << bsl::here();
-                return nullptr;
-            }
-
-            auto const page_phys{m_page_pool->virt_to_phys(page)};
-            if (bsl::unlikely(!page_phys)) {
-                bsl::error() << "physical address is invalid: "    // --
-                             << bsl::hex(page_phys)                // --
-                             << bsl::endl                          // --
-                             << bsl::here();                       // --
-
-                return nullptr;
-            }
-
-            if (bsl::unlikely(!this->map_page(page_virt, page_phys, true, true, true))) {
-                bsl::print<bsl::V>() << bsl::here();
-                return nullptr;
-            }
+            return this->allocate_page(tls, page_virt, true, true);
+        }
 
-            return page;
+        /// <!-- description -->
+        ///   @brief Same as allocate_rx() with the exception that the
+        ///     resulting page is not zeroed, meaning its contents are
+        ///     undefined. The caller must initialize the entire page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param page_virt the virtual address to map the page too
+        ///   @return Returns a pointer to the allocated page, or a nullptr
+        ///     on failure.
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        allocate_uninit_rx(TLS_CONCEPT &tls, bsl::safe_uintmax const &page_virt) &noexcept -> void *
+        {
+            return this->allocate_page(tls, page_virt, true, false);
         }
 
         /// <!-- description -->
@@ -1688,7 +1861,7 @@ namespace mk
             }
 
             auto *const pte{this->get_pt(pdte)->entries.at_if(this->pto(page_virt))};
-            if (bsl::unlikely(pte->p != bsl::ZERO_UMAX)) {
+            if (bsl::unlikely(pte->p == bsl::ZERO_UMAX)) {
                 bsl::error() << "virtual address "     // --
                              << bsl::hex(page_virt)    // --
                              << " was never mapped"    // --
@@ -1701,6 +1874,148 @@ namespace mk
             return bsl::safe_uintmax{pte->phys} << PAGE_SHIFT;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided userspace virtual address
+        ///     is mapped by the root page table being managed by this
+        ///     class. If "writable" is true, the page must also be mapped
+        ///     as writable.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_virt the virtual address of the page to check
+        ///   @param writable true if the page must be writable
+        ///   @return Returns true if the provided userspace virtual address
+        ///     is mapped (and writable if requested), false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_user_page_mapped(bsl::safe_uintmax const &page_virt, bool const writable) &noexcept
+            -> bool
+        {
+            auto const *const pte{this->find_user_pte(page_virt)};
+            if (bsl::unlikely(nullptr == pte)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return false;
+            }
+
+            if (bsl::unlikely(writable && (bsl::ZERO_UMAX == pte->rw))) {
+                bsl::error() << "virtual address "     // --
+                             << bsl::hex(page_virt)    // --
+                             << " is not writable"     // --
+                             << bsl::endl              // --
+                             << bsl::here();           // --
+
+                return false;
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes the mapping for the provided virtual address
+        ///     from the root page table being managed by this class and
+        ///     returns the physical address that was mapped. Note that the
+        ///     page itself is not deallocated (the caller owns the page once
+        ///     it is unmapped), and the page tables used to map the page
+        ///     are not released until the root page table is released.
+        ///     Only userspace addresses can be unmapped. The old translation
+        ///     is only flushed from the current PP's TLB. Any other PP that
+        ///     shares this root page table can keep using it until it next
+        ///     reloads CR3, so the caller must not reuse the physical page
+        ///     (or the virtual address) until every PP has done so (see
+        ///     ext_t::free_page()).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_virt the virtual address to unmap
+        ///   @return Returns the physical address that was unmapped, or an
+        ///     invalid address on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_page(bsl::safe_uintmax const &page_virt) &noexcept -> bsl::safe_uintmax
+        {
+            auto *const pte{this->find_user_pte(page_virt)};
+            if (bsl::unlikely(nullptr == pte)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            auto const page_phys{bsl::safe_uintmax{pte->phys} << PAGE_SHIFT};
+            *pte = {};
+
+            m_intrinsic->invlpg(page_virt);
+            return page_phys;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a page previously allocated using allocate_rw()
+        ///     or allocate_rx() (or any of their variants) and returns the
+        ///     physical address that was mapped. Unlike deallocate_page(),
+        ///     the page is not returned to the page pool. The caller owns
+        ///     the page once it is unmapped, and the same rules about other
+        ///     PPs apply as with unmap_page().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_virt the virtual address of the page to unmap
+        ///   @return Returns the physical address that was unmapped, or an
+        ///     invalid address on failure.
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_allocated_page(bsl::safe_uintmax const &page_virt) &noexcept -> bsl::safe_uintmax
+        {
+            auto const *const pte{this->find_user_pte(page_virt)};
+            if (bsl::unlikely(nullptr == pte)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            if (bsl::unlikely(pte->auto_release == bsl::ZERO_UMAX)) {
+                bsl::error() << "virtual address "                             // --
+                             << bsl::hex(page_virt)                            // --
+                             << " was not allocated by the root page table"    // --
+                             << bsl::endl                                      // --
+                             << bsl::here();                                   // --
+
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            auto const page_phys{this->unmap_page(page_virt)};
+            if (bsl::unlikely(!page_phys)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            return page_phys;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a page previously allocated using allocate_rw()
+        ///     or allocate_rx() (or any of their variants) and returns the
+        ///     page to the page pool. Only userspace addresses can be
+        ///     deallocated. The page is reused right away, so this must not
+        ///     be used while another PP could still have the page in its
+        ///     TLB (see unmap_page()).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_CONCEPT defines the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///   @param page_virt the virtual address of the page to deallocate
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        template<typename TLS_CONCEPT>
+        [[nodiscard]] constexpr auto
+        deallocate_page(TLS_CONCEPT &tls, bsl::safe_uintmax const &page_virt) &noexcept
+            -> bsl::errc_type
+        {
+            auto const page_phys{this->unmap_allocated_page(page_virt)};
+            if (bsl::unlikely(!page_phys)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            auto *const page{m_page_pool->template phys_to_virt<void *>(page_phys)};
+            m_page_pool->deallocate(tls, page, m_owner);
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the provided pml4_t
         ///
@@ -0,0 +1,75 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SPINLOCK_T_HPP
+#define SPINLOCK_T_HPP
+
+#include <bsl/cstdint.hpp>
+
+namespace mk
+{
+    /// @class mk::spinlock_t
+    ///
+    /// <!-- description -->
+    ///   @brief Implements a simple ticket based spinlock. Each PP that
+    ///     wishes to acquire the lock takes a ticket and then waits until
+    ///     the ticket is being served, which ensures the lock is handed out
+    ///     in FIFO order and no PP can be starved while another PP keeps
+    ///     reacquiring the lock. This lock should only be used to protect
+    ///     small critical sections (e.g., batch transfers between a PP's
+    ///     local cache and a global resource) as it never sleeps.
+    ///
+    class spinlock_t final
+    {
+        /// @brief stores the next ticket to hand out
+        bsl::uintmax m_next{};
+        /// @brief stores the ticket that currently owns the lock
+        bsl::uintmax m_serving{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Acquires the lock, spinning until the lock is available
+        ///
+        void
+        lock() &noexcept
+        {
+            auto const ticket{__atomic_fetch_add(&m_next, 1U, __ATOMIC_RELAXED)};
+            while (__atomic_load_n(&m_serving, __ATOMIC_ACQUIRE) != ticket) {
+                __builtin_ia32_pause();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Releases the lock, handing it to the next ticket
+        ///
+        void
+        unlock() &noexcept
+        {
+            auto const next{__atomic_load_n(&m_serving, __ATOMIC_RELAXED) + 1U};
+            __atomic_store_n(&m_serving, next, __ATOMIC_RELEASE);
+        }
+    };
+}
+
+#endif
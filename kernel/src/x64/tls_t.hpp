@@ -25,8 +25,13 @@
 #ifndef TLS_T_HPP
 #define TLS_T_HPP
 
+#include <debug_ring_t.hpp>
 #include <state_save_t.hpp>
+#include <syscall_trace_t.hpp>
+#include <vmexit_log_t.hpp>
+#include <vmexit_stats_t.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/cstdint.hpp>
 #include <bsl/details/carray.hpp>
@@ -45,11 +50,13 @@ namespace mk
         /// @brief defines the size of the reserved2 field in the tls_t
         constexpr bsl::safe_uintmax TLS_T_RESERVED2_SIZE{bsl::to_umax(0x530U)};
         /// @brief defines the size of the reserved3 field in the tls_t
-        constexpr bsl::safe_uintmax TLS_T_RESERVED3_SIZE{bsl::to_umax(0x0A0U)};
+        constexpr bsl::safe_uintmax TLS_T_RESERVED3_SIZE{bsl::to_umax(0x028U)};
         /// @brief defines the size of the reserved4 field in the tls_t
         constexpr bsl::safe_uintmax TLS_T_RESERVED4_SIZE{bsl::to_umax(0x098U)};
         /// @brief defines the size of the reserved5 field in the tls_t
-        constexpr bsl::safe_uintmax TLS_T_RESERVED5_SIZE{bsl::to_umax(0x600U)};
+        constexpr bsl::safe_uintmax TLS_T_RESERVED5_SIZE{bsl::to_umax(0x400U)};
+        /// @brief defines the number of pages a PP's page pool magazine can hold
+        constexpr bsl::safe_uintmax TLS_T_PAGE_POOL_MAGAZINE_SIZE{bsl::to_umax(0x03FU)};
     }
 
     /// @struct mk::tls_t
@@ -260,6 +267,51 @@ namespace mk
         /// @brief stores whether or not the first launch succeeded (0x870).
         bsl::uintmax first_launch_succeeded;
 
+        /// @brief on Intel, stores the missing registers of the VPS whose
+        ///   guest syscall MSRs are still loaded on this PP, or nullptr if
+        ///   the microkernel's syscall MSRs are loaded (0x878).
+        void *loaded_syscall_msrs;
+
+        /// @brief on AMD, stores the microkernel's value of ia32_pat (0x880).
+        bsl::uintmax host_pat;
+
+        /// @brief stores the disposition returned by the VMExit handler (0x888).
+        bsl::uintmax vmexit_disposition;
+
+        /// @brief stores this PP's VMExit log (0x890).
+        loader::vmexit_log_t *vmexit_log;
+        /// @brief stores the VMExit log record that is still open (0x898).
+        loader::vmexit_log_record_t *vmexit_log_rec;
+        /// @brief stores the TSC when the VMExit handler was called (0x8A0).
+        bsl::uintmax vmexit_log_ext_tsc;
+
+        /// @brief stores this PP's VMExit stats (0x8A8).
+        loader::vmexit_stats_t *vmexit_stats;
+        /// @brief stores the TSC of the last VMExit (0x8B0).
+        bsl::uintmax vmexit_stats_exit_tsc;
+        /// @brief stores the TSC when the VMExit handler was called (0x8B8).
+        bsl::uintmax vmexit_stats_ext_tsc;
+        /// @brief stores the TSC of the last resume (0x8C0).
+        bsl::uintmax vmexit_stats_resume_tsc;
+
+        /// @brief stores this PP's syscall trace (0x8C8).
+        loader::syscall_trace_t *syscall_trace;
+        /// @brief stores the syscall trace record that is still open (0x8D0).
+        loader::syscall_trace_record_t *syscall_trace_rec;
+
+        /// @brief stores this PP's debug ring (0x8D8).
+        loader::debug_ring_t *debug_ring;
+
+        /// @brief on Intel, stores the generation of the VPS in
+        ///   loaded_syscall_msrs when it was loaded. If the VPS has been
+        ///   deallocated since, its generation no longer matches (0x8E0).
+        bsl::uintmax loaded_syscall_msrs_gen;
+
+        /// @brief stores the handle of the extension registered for VMExits
+        ///   while its VMExit handler is running, and 0 otherwise. This is
+        ///   checked by bf_callback_op_vmexit_return (0x8E8).
+        bsl::uintmax ext_vmexit_handle;
+
         /// @brief reserve the rest of the TLS block for later use.
         bsl::details::carray<bsl::uint8, details::TLS_T_RESERVED3_SIZE.get()> reserved3;
 
@@ -295,6 +347,15 @@ namespace mk
         /// @brief reserve the rest of the TLS block for later use.
         bsl::details::carray<bsl::uint8, details::TLS_T_RESERVED4_SIZE.get()> reserved4;
 
+        /// --------------------------------------------------------------------
+        /// Page Pool Magazine
+        /// --------------------------------------------------------------------
+
+        /// @brief stores the number of pages in the page pool magazine (0xA00).
+        bsl::uintmax page_pool_magazine_count;
+        /// @brief stores this PP's cache of free pages (0xA08).
+        bsl::array<void *, details::TLS_T_PAGE_POOL_MAGAZINE_SIZE.get()> page_pool_magazine;
+
         /// --------------------------------------------------------------------
         /// Reserved
         /// --------------------------------------------------------------------
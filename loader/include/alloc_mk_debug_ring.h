@@ -32,12 +32,11 @@
 
 /**
  * <!-- description -->
- *   @brief Allocates a chunk of memory for the debug ring that will be
- *     used by the microkernel.
+ *   @brief Allocates the debug rings that will be used by the
+ *     microkernel, one for each online PP.
  *
  * <!-- inputs/outputs -->
- *   @param debug_ring the debug_ring_t to store the newly allocated
- *     debug ring
+ *   @param debug_ring where to store the newly allocated debug rings
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
 int64_t alloc_mk_debug_ring(struct debug_ring_t **const debug_ring);
@@ -27,7 +27,7 @@
 #ifndef ALLOC_MK_PAGE_POOL_H
 #define ALLOC_MK_PAGE_POOL_H
 
-#include <mutable_span_t.h>
+#include <page_pool_node_t.h>
 #include <types.h>
 
 /**
@@ -37,12 +37,30 @@
  *     not in bytes. Finally, if the provided size is 0, this function
  *     will allocate a default number of pages.
  *
+ *   @note The page pool is split evenly between each online NUMA node
+ *     (up to HYPERVISOR_MAX_NUMA_NODES), and each node's portion of the
+ *     page pool is allocated from memory that is local to that node.
+ *     The NUMA node of each online CPU is stored in pp_to_node so that
+ *     the microkernel can prefer pages that are local to the PP that is
+ *     asking for them.
+ *
+ *   @note Each node's portion of the page pool is allocated in chunks of
+ *     LOADER_PAGE_POOL_CHUNK_SIZE bytes. Each chunk is allocated from
+ *     physically contiguous memory whenever possible so that it can be
+ *     mapped using a single 2M page, and only falls back to memory that
+ *     is not physically contiguous when contiguous memory is not
+ *     available.
+ *
  * <!-- inputs/outputs -->
  *   @param size the total number of pages (not bytes) to allocate
- *   @param page_pool the mutable_span_t to store the page pool addr/size.
+ *   @param page_pool the array of page_pool_node_t (one per node) to
+ *     store the page pool in.
+ *   @param pp_to_node the array (one per PP) to store each PP's node in
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
-int64_t
-alloc_mk_page_pool(uint32_t const size, struct mutable_span_t *const page_pool);
+int64_t alloc_mk_page_pool(
+    uint32_t const size,
+    struct page_pool_node_t *const page_pool,
+    uint8_t *const pp_to_node);
 
 #endif
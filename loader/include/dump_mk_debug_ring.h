@@ -31,11 +31,12 @@
 
 /**
  * <!-- description -->
- *   @brief Outputs information about the mk debug ring. Note that this does
- *     not actually output the debug ring itself, but information about it.
+ *   @brief Outputs information about the mk debug rings. Note that this does
+ *     not actually output the debug rings themselves, but information about
+ *     them.
  *
  * <!-- inputs/outputs -->
- *   @param debug_ring the mk debug ring to output information about
+ *   @param debug_ring the mk debug rings to output information about
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
 void dump_mk_debug_ring(struct debug_ring_t *const debug_ring);
@@ -27,7 +27,7 @@
 #ifndef DUMP_MK_PAGE_POOL_H
 #define DUMP_MK_PAGE_POOL_H
 
-#include <mutable_span_t.h>
+#include <page_pool_node_t.h>
 #include <types.h>
 
 /**
@@ -35,9 +35,9 @@
  *   @brief Outputs the contents of a provided mk page pool.
  *
  * <!-- inputs/outputs -->
- *   @param page_pool the mk page pool to output
+ *   @param page_pool the mk page pool (one per node) to output
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
-void dump_mk_page_pool(struct mutable_span_t *const page_pool);
+void dump_mk_page_pool(struct page_pool_node_t *const page_pool);
 
 #endif
@@ -33,8 +33,9 @@
 /**
  * <!-- description -->
  *   @brief This function contains all of the code that is common between
- *     all archiectures and all platforms for dumping the VMM. This function
- *     will call platform and architecture specific functions as needed.
+ *     all archiectures and all platforms for dumping the debug ring of one
+ *     of the VMM's PPs. This function will call platform and architecture
+ *     specific functions as needed.
  *
  * <!-- inputs/outputs -->
  *   @param ioctl_args arguments from the ioctl
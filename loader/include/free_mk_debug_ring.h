@@ -31,11 +31,11 @@
 
 /**
  * <!-- description -->
- *   @brief Releases a previously allocated debug_ring_t that was allocated
- *     using the alloc_mk_debug_ring function.
+ *   @brief Releases the debug rings that were previously allocated using
+ *     the alloc_mk_debug_ring function.
  *
  * <!-- inputs/outputs -->
- *   @param debug_ring the debug_ring_t to free.
+ *   @param debug_ring the debug rings to free.
  */
 void free_mk_debug_ring(struct debug_ring_t **const debug_ring);
 
@@ -27,16 +27,16 @@
 #ifndef FREE_MK_PAGE_POOL_H
 #define FREE_MK_PAGE_POOL_H
 
-#include <mutable_span_t.h>
+#include <page_pool_node_t.h>
 
 /**
  * <!-- description -->
- *   @brief Releases a previously allocated mutable_span_t that was allocated
+ *   @brief Releases a previously allocated page pool that was allocated
  *     using the alloc_mk_page_pool function.
  *
  * <!-- inputs/outputs -->
- *   @param page_pool the mutable_span_t to free.
+ *   @param page_pool the array of page_pool_node_t (one per node) to free.
  */
-void free_mk_page_pool(struct mutable_span_t *const page_pool);
+void free_mk_page_pool(struct page_pool_node_t *const page_pool);
 
 #endif
@@ -29,7 +29,7 @@
 
 #include <debug_ring_t.h>
 
-/** @brief stores the microkernel's debug ring */
+/** @brief stores the microkernel's debug rings (one for each PP) */
 extern struct debug_ring_t *g_mk_debug_ring;
 
 #endif
@@ -27,11 +27,15 @@
 #ifndef G_MK_PAGE_POOL_H
 #define G_MK_PAGE_POOL_H
 
-#include <mutable_span_t.h>
+#include <constants.h>
+#include <page_pool_node_t.h>
 #include <types.h>
 
-/** @brief stores the page pool used by the microkernel */
-extern struct mutable_span_t g_mk_page_pool;
+/** @brief stores the page pool used by the microkernel (one per NUMA node) */
+extern struct page_pool_node_t g_mk_page_pool[HYPERVISOR_MAX_NUMA_NODES];
+
+/** @brief stores the NUMA node (i.e., page pool) that each PP belongs to */
+extern uint8_t g_mk_pp_to_node[HYPERVISOR_MAX_PPS];
 
 /** @brief stores the virtual address of the MK's page pool */
 extern uint64_t g_mk_page_pool_base_virt;
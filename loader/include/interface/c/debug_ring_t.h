@@ -33,11 +33,22 @@
 
 #pragma pack(push, 1)
 
+/** @brief defines the character that starts each record in a debug ring */
+#define LOADER_DEBUG_RING_RECORD ((char)0x1E)
+/** @brief defines the number of hex digits in the TSC stamp of a record */
+#define LOADER_DEBUG_RING_TSC_DIGITS ((uint64_t)16)
+
 /**
  * @struct debug_ring_t
  *
  * <!-- description -->
- *   @brief Defines the structure of the microkernel's debug ring
+ *   @brief Defines the structure of the microkernel's debug ring. The
+ *     loader allocates one of these for each PP, and only that PP ever
+ *     writes to it. Each line that the PP outputs is stored as a record
+ *     that starts with LOADER_DEBUG_RING_RECORD, followed by the TSC when
+ *     the line was started (as LOADER_DEBUG_RING_TSC_DIGITS hex digits),
+ *     followed by the line itself. This is what allows the debug rings of
+ *     all of the PPs to be merged in time order.
  */
 struct debug_ring_t
 {
@@ -41,12 +41,16 @@
  *
  * <!-- description -->
  *   @brief Defines the information that a userspace application needs to
- *     provide to dump the VMM.
+ *     provide to dump the debug ring of one of the VMM's PPs.
  */
 struct dump_vmm_args_t
 {
     /** @brief set to HYPERVISOR_VERSION */
     uint64_t ver;
+    /** @brief set to the ID of the PP whose debug ring should be dumped */
+    uint64_t ppid;
+    /** @brief stores the number of online PPs upon request */
+    uint64_t num_pps;
 
     /** @brief stores the contents of the debug ring upon request */
     struct debug_ring_t debug_ring;
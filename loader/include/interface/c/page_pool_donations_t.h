@@ -0,0 +1,87 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PAGE_POOL_DONATIONS_T_H
+#define PAGE_POOL_DONATIONS_T_H
+
+#include <constants.h>
+#include <static_assert.h>
+#include <stdint.h>
+
+#pragma pack(push, 1)
+
+/** @brief defines the max number of donations the loader can make */
+#define LOADER_MAX_PAGE_POOL_DONATIONS ((uint64_t)0x7F)
+
+/**
+ * @struct page_pool_donation_t
+ *
+ * <!-- description -->
+ *   @brief Defines a single list of pages that the loader has donated to
+ *     a running microkernel's page pool. The pages are already mapped into
+ *     the microkernel's direct map and linked together the same way the
+ *     initial page pool is, so all the microkernel has to do is splice the
+ *     list onto the stack of the node that the pages belong to.
+ */
+struct page_pool_donation_t
+{
+    /** @brief stores the direct map address of the first page */
+    uint8_t *head;
+    /** @brief stores the direct map address of the last page */
+    uint8_t *tail;
+    /** @brief stores the total number of bytes in the donation */
+    uint64_t size;
+    /** @brief stores the NUMA node that the pages belong to */
+    uint64_t node;
+};
+
+/**
+ * @struct page_pool_donations_t
+ *
+ * <!-- description -->
+ *   @brief Defines the page that the loader uses to donate pages to a
+ *     running microkernel's page pool. The loader fills in the next
+ *     donation and only then increments count. The microkernel remembers
+ *     how many donations it has already taken, so no lock is needed.
+ *     Donations are never reused, which is why there is a max number of
+ *     donations per VMM.
+ */
+struct page_pool_donations_t
+{
+    /** @brief stores the total number of donations made by the loader */
+    uint64_t count;
+    /** @brief stores the donations made by the loader */
+    struct page_pool_donation_t donations[LOADER_MAX_PAGE_POOL_DONATIONS];
+};
+
+/** @brief Check to make sure the page_pool_donations_t is the right size. */
+STATIC_ASSERT(
+    sizeof(struct page_pool_donations_t) <= HYPERVISOR_PAGE_SIZE,
+    invalid_size);
+
+#pragma pack(pop)
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PAGE_POOL_RUN_T_H
+#define PAGE_POOL_RUN_T_H
+
+#include <stdint.h>
+
+#pragma pack(push, 1)
+
+/**
+ * @struct page_pool_run_t
+ *
+ * <!-- description -->
+ *   @brief Defines the header that is stored at the start of each run of
+ *     physically contiguous pages in the microkernel's page pool. The
+ *     header is stored in the first page of the run, and the rest of the
+ *     run (as well as the rest of the first page) is zero. Runs are linked
+ *     together using their direct map addresses.
+ */
+struct page_pool_run_t
+{
+    /** @brief stores the direct map address of the next run */
+    uint8_t *next;
+    /** @brief stores the total number of bytes in this run */
+    uint64_t size;
+};
+
+#pragma pack(pop)
+
+#endif
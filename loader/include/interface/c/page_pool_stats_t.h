@@ -0,0 +1,76 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PAGE_POOL_STATS_T_H
+#define PAGE_POOL_STATS_T_H
+
+#include <constants.h>
+#include <static_assert.h>
+#include <stdint.h>
+
+#pragma pack(push, 1)
+
+/** @brief defines the owner index used by the microkernel itself */
+#define LOADER_PAGE_POOL_OWNER_MK ((uint64_t)0)
+/** @brief defines the owner index used by all VMs, VPs and VPSs */
+#define LOADER_PAGE_POOL_OWNER_VPS ((uint64_t)1)
+/** @brief defines the owner index used by the first extension */
+#define LOADER_PAGE_POOL_OWNER_EXT ((uint64_t)2)
+/** @brief defines the total number of page pool owners */
+#define LOADER_PAGE_POOL_MAX_OWNERS                                            \
+    (LOADER_PAGE_POOL_OWNER_EXT + HYPERVISOR_MAX_EXTENSIONS)
+
+/**
+ * @struct page_pool_stats_t
+ *
+ * <!-- description -->
+ *   @brief Defines the page that the microkernel's page pool uses to
+ *     report how it is being used. The microkernel updates this page
+ *     as pages are allocated and freed, and the loader copies it out on
+ *     request. All values are in pages. The page outlives the VMM, so
+ *     the stats of a VMM that has stopped can still be read.
+ */
+struct page_pool_stats_t
+{
+    /** @brief stores the total number of pages in the page pool */
+    uint64_t total;
+    /** @brief stores the number of pages that are currently allocated */
+    uint64_t used;
+    /** @brief stores the highest value that used has ever had */
+    uint64_t high_water;
+    /** @brief stores the number of allocations that have failed */
+    uint64_t failures;
+    /** @brief stores the number of pages allocated by each owner */
+    uint64_t owners[LOADER_PAGE_POOL_MAX_OWNERS];
+};
+
+/** @brief Check to make sure the page_pool_stats_t is the right size. */
+STATIC_ASSERT(
+    sizeof(struct page_pool_stats_t) <= HYPERVISOR_PAGE_SIZE, invalid_size);
+
+#pragma pack(pop)
+
+#endif
@@ -0,0 +1,98 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SYSCALL_TRACE_T_H
+#define SYSCALL_TRACE_T_H
+
+#include <constants.h>
+#include <static_assert.h>
+#include <stdint.h>
+
+#pragma pack(push, 1)
+
+/** @brief defines the number of records in each PP's syscall trace */
+#define LOADER_SYSCALL_TRACE_SIZE ((uint64_t)511)
+/** @brief defines the number of pages in each PP's syscall trace */
+#define LOADER_SYSCALL_TRACE_PAGES ((uint64_t)4)
+
+/**
+ * @struct syscall_trace_record_t
+ *
+ * <!-- description -->
+ *   @brief Defines a single record in a syscall trace. All times are raw
+ *     TSC values taken on the PP that owns the trace.
+ */
+struct syscall_trace_record_t
+{
+    /** @brief stores RAX (i.e., the signature, opcode and index) */
+    uint64_t syscall;
+    /** @brief stores the TSC when the microkernel was entered */
+    uint64_t tsc_begin;
+    /** @brief stores the TSC when the syscall finished, or 0 if unfinished */
+    uint64_t tsc_end;
+    /** @brief stores the ID of the PP that made the syscall */
+    uint16_t ppid;
+    /** @brief stores the ID of the VPS that was active */
+    uint16_t vpsid;
+    /** @brief stores 1 if REG0 held the extension's handle, 0 otherwise */
+    uint8_t handle_valid;
+    /** @brief reserved */
+    uint8_t reserved[3];
+};
+
+/**
+ * @struct syscall_trace_t
+ *
+ * <!-- description -->
+ *   @brief Defines the pages that the microkernel records each syscall
+ *     on a PP into when HYPERVISOR_SYSCALL_TRACE is enabled. The loader
+ *     allocates one of these for each PP. The records form a ring that is
+ *     overwritten once it is full. The microkernel only ever writes
+ *     "total", and the loader only ever writes "drained", so no lock is
+ *     needed to drain the ring while the PP is running.
+ */
+struct syscall_trace_t
+{
+    /** @brief stores the total number of syscalls that have been recorded */
+    uint64_t total;
+    /** @brief stores the value of total when the trace was last drained */
+    uint64_t drained;
+    /** @brief reserved */
+    uint64_t reserved[2];
+
+    /** @brief stores the records in the ring */
+    struct syscall_trace_record_t records[LOADER_SYSCALL_TRACE_SIZE];
+};
+
+/** @brief Check to make sure the syscall_trace_t is the right size. */
+STATIC_ASSERT(
+    sizeof(struct syscall_trace_t) ==
+        (LOADER_SYSCALL_TRACE_PAGES * HYPERVISOR_PAGE_SIZE),
+    invalid_size);
+
+#pragma pack(pop)
+
+#endif
@@ -0,0 +1,93 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef VMEXIT_LOG_T_H
+#define VMEXIT_LOG_T_H
+
+#include <constants.h>
+#include <static_assert.h>
+#include <stdint.h>
+
+#pragma pack(push, 1)
+
+/** @brief defines the number of records in each PP's VMExit log */
+#define LOADER_VMEXIT_LOG_SIZE ((uint64_t)85)
+
+/**
+ * @struct vmexit_log_record_t
+ *
+ * <!-- description -->
+ *   @brief Defines a single record in a VMExit log. All times are raw TSC
+ *     values taken on the PP that owns the log.
+ */
+struct vmexit_log_record_t
+{
+    /** @brief stores the exit reason of the VMExit */
+    uint64_t exit_reason;
+    /** @brief stores the guest RIP at the time of the VMExit */
+    uint64_t rip;
+    /** @brief stores the TSC when the VMExit was handed to the microkernel */
+    uint64_t tsc_exit;
+    /** @brief stores the TSC when the VPS was resumed, or 0 if still running */
+    uint64_t tsc_resume;
+    /** @brief stores the TSC cycles spent in the extension, or 0 if unused */
+    uint64_t ext_cycles;
+    /** @brief stores the ID of the VM that caused the VMExit */
+    uint16_t vmid;
+    /** @brief stores the ID of the VP that caused the VMExit */
+    uint16_t vpid;
+    /** @brief stores the ID of the VPS that caused the VMExit */
+    uint16_t vpsid;
+    /** @brief reserved */
+    uint16_t reserved;
+};
+
+/**
+ * @struct vmexit_log_t
+ *
+ * <!-- description -->
+ *   @brief Defines the page that the microkernel records each VMExit on a
+ *     PP into. The loader allocates one of these for each PP, and the
+ *     records form a ring that is overwritten once it is full.
+ */
+struct vmexit_log_t
+{
+    /** @brief stores the index of the record the next VMExit will use */
+    uint64_t pos;
+    /** @brief stores the total number of VMExits that have been recorded */
+    uint64_t total;
+
+    /** @brief stores the records in the ring */
+    struct vmexit_log_record_t records[LOADER_VMEXIT_LOG_SIZE];
+};
+
+/** @brief Check to make sure the vmexit_log_t is the right size. */
+STATIC_ASSERT(
+    sizeof(struct vmexit_log_t) == HYPERVISOR_PAGE_SIZE, invalid_size);
+
+#pragma pack(pop)
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef VMEXIT_STATS_T_H
+#define VMEXIT_STATS_T_H
+
+#include <constants.h>
+#include <static_assert.h>
+#include <stdint.h>
+
+#pragma pack(push, 1)
+
+/** @brief defines the number of exit reasons that have their own counter */
+#define LOADER_VMEXIT_STATS_REASONS ((uint64_t)256)
+/** @brief defines the first counter used for folded exit reasons */
+#define LOADER_VMEXIT_STATS_FOLD_IDX ((uint64_t)0xF0)
+/** @brief defines the first exit reason that is folded */
+#define LOADER_VMEXIT_STATS_FOLD_REASON ((uint64_t)0x400)
+/** @brief defines the number of exit reasons that are folded */
+#define LOADER_VMEXIT_STATS_FOLD_SIZE ((uint64_t)0x10)
+
+/** @brief defines the number of log2 buckets in each histogram */
+#define LOADER_VMEXIT_STATS_BUCKETS ((uint64_t)64)
+/** @brief defines the histogram of VMExit to VMExit handler entry */
+#define LOADER_VMEXIT_STATS_HIST_EXIT_TO_EXT ((uint64_t)0)
+/** @brief defines the histogram of time spent in the VMExit handler */
+#define LOADER_VMEXIT_STATS_HIST_EXT ((uint64_t)1)
+/** @brief defines the histogram of resume to the next VMExit */
+#define LOADER_VMEXIT_STATS_HIST_GUEST ((uint64_t)2)
+/** @brief defines the number of histograms */
+#define LOADER_VMEXIT_STATS_HISTS ((uint64_t)3)
+
+/** @brief defines the size of the reserved fields in the vmexit_stats_t */
+#define LOADER_VMEXIT_STATS_RESERVED ((uint64_t)56)
+
+/**
+ * @struct vmexit_stats_t
+ *
+ * <!-- description -->
+ *   @brief Defines the page that the microkernel aggregates the VMExits of
+ *     a PP into. The loader allocates one of these for each PP, so no two
+ *     PPs ever write to the same cache line. Times are in TSC cycles, and
+ *     bucket N of a histogram counts the samples in [2^N, 2^(N+1)), with
+ *     bucket 0 also counting samples of 0.
+ *
+ *     Each exit reason below LOADER_VMEXIT_STATS_FOLD_IDX has its own
+ *     counter. Neither Intel nor AMD use the exit reasons between that and
+ *     LOADER_VMEXIT_STATS_REASONS, so AMD's exit codes starting at
+ *     LOADER_VMEXIT_STATS_FOLD_REASON (e.g. NPF) are folded into them.
+ *     Anything else is counted by "other".
+ */
+struct vmexit_stats_t
+{
+    /** @brief stores the total number of VMExits */
+    uint64_t total;
+    /** @brief stores the number of VMExits without their own counter */
+    uint64_t other;
+    /** @brief reserved (pads the counters to a cache line) */
+    uint64_t reserved1[6];
+
+    /** @brief stores the number of VMExits for each exit reason */
+    uint64_t reasons[LOADER_VMEXIT_STATS_REASONS];
+    /** @brief stores the latency histograms */
+    uint64_t hists[LOADER_VMEXIT_STATS_HISTS][LOADER_VMEXIT_STATS_BUCKETS];
+
+    /** @brief reserved (pads the stats to a page) */
+    uint64_t reserved2[LOADER_VMEXIT_STATS_RESERVED];
+};
+
+/** @brief Check to make sure the vmexit_stats_t is the right size. */
+STATIC_ASSERT(
+    sizeof(struct vmexit_stats_t) == HYPERVISOR_PAGE_SIZE, invalid_size);
+
+#pragma pack(pop)
+
+#endif
@@ -29,7 +29,12 @@
 
 #include "../debug_ring_t.h"
 #include "../mutable_span_t.h"
+#include "../page_pool_donations_t.h"
+#include "../page_pool_stats_t.h"
+#include "../syscall_trace_t.h"
 #include "../span_t.h"
+#include "../vmexit_log_t.h"
+#include "../vmexit_stats_t.h"
 #include "state_save_t.h"
 
 #include <constants.h>
@@ -59,7 +64,7 @@ struct mk_args_t
     struct state_save_t *mk_state;
     /** @brief stores the location of the root vp state (0x010) */
     struct state_save_t *root_vp_state;
-    /** @brief stores the location of the debug ring (0x018) */
+    /** @brief stores the location of this PP's debug ring (0x018) */
     struct debug_ring_t *debug_ring;
     /** @brief stores the location of the microkernel's ELF file */
     struct span_t mk_elf_file;
@@ -69,14 +74,26 @@ struct mk_args_t
     void *rpt;
     /** @brief stores the physical address of the MK's RPT for this CPU */
     uint64_t rpt_phys;
-    /** @brief stores the location of the microkernel's page pool */
-    struct mutable_span_t page_pool;
+    /** @brief stores the location of the microkernel's page pool (per node) */
+    struct mutable_span_t page_pool[HYPERVISOR_MAX_NUMA_NODES];
     /** @brief stores the starting location of the page pool's direct map */
     uint64_t page_pool_base_virt;
+    /** @brief stores the pages donated to the page pool by the loader */
+    struct page_pool_donations_t *page_pool_donations;
+    /** @brief stores where the page pool reports how it is being used */
+    struct page_pool_stats_t *page_pool_stats;
     /** @brief stores the location of the microkernel's huge pool */
     struct mutable_span_t huge_pool;
     /** @brief stores the starting location of the huge pool's direct map */
     uint64_t huge_pool_base_virt;
+    /** @brief stores the log this PP records each VMExit into */
+    struct vmexit_log_t *vmexit_log;
+    /** @brief stores the stats this PP aggregates each VMExit into */
+    struct vmexit_stats_t *vmexit_stats;
+    /** @brief stores the trace this PP records each syscall into */
+    struct syscall_trace_t *syscall_trace;
+    /** @brief stores the NUMA node (i.e., page pool) that each PP belongs to */
+    uint8_t pp_to_node[HYPERVISOR_MAX_PPS];
 };
 
 /** @brief Check to make sure the mk_args_t is the right size. */
@@ -58,10 +58,10 @@ struct pdte_t
     uint64_t a : ((uint64_t)1);
     /** @brief defines an ignored field in the page */
     uint64_t ignored1 : ((uint64_t)1);
-    /** @brief defines a field in the page that must be 0 */
-    uint64_t mbz1 : ((uint64_t)1);
-    /** @brief defines an ignored field in the page */
-    uint64_t ignored2 : ((uint64_t)1);
+    /** @brief defines the "page size" field in the page (2M page if set) */
+    uint64_t ps : ((uint64_t)1);
+    /** @brief defines the "global" field in the page (only if ps is set) */
+    uint64_t g : ((uint64_t)1);
     /** @brief defines the "available to software" field in the page */
     uint64_t avl : ((uint64_t)3);
     /** @brief defines the physical address field in the page */
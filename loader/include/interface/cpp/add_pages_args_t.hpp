@@ -0,0 +1,57 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef ADD_PAGES_ARGS_T_HPP
+#define ADD_PAGES_ARGS_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief defines the IOCTL index for adding pages to the page pool
+    constexpr bsl::safe_uint32 ADD_PAGES_CMD{bsl::to_u32(0xBF04)};
+
+    /// @struct loader::add_pages_args_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the information that a userspace application needs to
+    ///     provide to add pages to a running VMM's page pool.
+    ///
+    struct add_pages_args_t final
+    {
+        /// @brief set to loader::version
+        bsl::uint64 ver;
+
+        /// @brief stores the total number of pages (not bytes) to add
+        bsl::uint64 num_pages;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
@@ -35,10 +35,21 @@
 
 namespace loader
 {
+    /// @brief defines the character that starts each record in a debug ring
+    constexpr bsl::char_type DEBUG_RING_RECORD{static_cast<bsl::char_type>(0x1E)};
+    /// @brief defines the number of hex digits in the TSC stamp of a record
+    constexpr bsl::safe_uintmax DEBUG_RING_TSC_DIGITS{bsl::to_umax(16)};
+
     /// @struct loader::debug_ring_t
     ///
     /// <!-- description -->
-    ///   @brief Defines the structure of the microkernel's debug ring
+    ///   @brief Defines the structure of the microkernel's debug ring. The
+    ///     loader allocates one of these for each PP, and only that PP ever
+    ///     writes to it. Each line that the PP outputs is stored as a record
+    ///     that starts with DEBUG_RING_RECORD, followed by the TSC when the
+    ///     line was started (as DEBUG_RING_TSC_DIGITS hex digits), followed
+    ///     by the line itself. This is what allows the debug rings of all of
+    ///     the PPs to be merged in time order.
     ///
     struct debug_ring_t final
     {
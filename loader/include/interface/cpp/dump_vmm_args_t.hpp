@@ -42,12 +42,16 @@ namespace loader
     ///
     /// <!-- description -->
     ///   @brief Defines the information that a userspace application needs to
-    ///     provide to dump the VMM.
+    ///     provide to dump the debug ring of one of the VMM's PPs.
     ///
     struct dump_vmm_args_t final
     {
         /// @brief set to loader::version
         bsl::uint64 ver;
+        /// @brief set to the ID of the PP whose debug ring should be dumped
+        bsl::uint64 ppid;
+        /// @brief stores the number of online PPs upon request
+        bsl::uint64 num_pps;
 
         /// @brief stores the contents of the debug ring upon request
         debug_ring_t debug_ring;
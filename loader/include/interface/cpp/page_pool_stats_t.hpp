@@ -0,0 +1,73 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef PAGE_POOL_STATS_T_HPP
+#define PAGE_POOL_STATS_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief defines the owner index used by the microkernel itself
+    constexpr bsl::safe_uintmax PAGE_POOL_OWNER_MK{bsl::to_umax(0)};
+    /// @brief defines the owner index used by all VMs, VPs and VPSs
+    constexpr bsl::safe_uintmax PAGE_POOL_OWNER_VPS{bsl::to_umax(1)};
+    /// @brief defines the owner index used by the first extension
+    constexpr bsl::safe_uintmax PAGE_POOL_OWNER_EXT{bsl::to_umax(2)};
+    /// @brief defines the total number of page pool owners
+    constexpr bsl::safe_uintmax PAGE_POOL_MAX_OWNERS{
+        PAGE_POOL_OWNER_EXT + bsl::to_umax(HYPERVISOR_MAX_EXTENSIONS)};
+
+    /// @struct loader::page_pool_stats_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the page that the microkernel's page pool uses to
+    ///     report how it is being used. The microkernel updates this page
+    ///     as pages are allocated and freed, and the loader copies it out on
+    ///     request. All values are in pages. The page outlives the VMM, so
+    ///     the stats of a VMM that has stopped can still be read.
+    ///
+    struct page_pool_stats_t final
+    {
+        /// @brief stores the total number of pages in the page pool
+        bsl::uint64 total;
+        /// @brief stores the number of pages that are currently allocated
+        bsl::uint64 used;
+        /// @brief stores the highest value that used has ever had
+        bsl::uint64 high_water;
+        /// @brief stores the number of allocations that have failed
+        bsl::uint64 failures;
+        /// @brief stores the number of pages allocated by each owner
+        bsl::array<bsl::uint64, PAGE_POOL_MAX_OWNERS.get()> owners;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
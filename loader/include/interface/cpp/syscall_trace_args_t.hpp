@@ -0,0 +1,69 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SYSCALL_TRACE_ARGS_T_HPP
+#define SYSCALL_TRACE_ARGS_T_HPP
+
+#include "syscall_trace_t.hpp"
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief defines the IOCTL index for draining a PP's syscall trace
+    constexpr bsl::safe_uint32 SYSCALL_TRACE_CMD{bsl::to_u32(0xBF08)};
+
+    /// @struct loader::syscall_trace_args_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the information that a userspace application needs to
+    ///     provide to drain the syscall trace of a PP. Draining returns every
+    ///     record added since the last drain, from the oldest to the newest.
+    ///
+    struct syscall_trace_args_t final
+    {
+        /// @brief set to loader::version
+        bsl::uint64 ver;
+        /// @brief set to the ID of the PP whose syscall trace should be drained
+        bsl::uint64 ppid;
+        /// @brief stores the number of online PPs upon request
+        bsl::uint64 num_pps;
+        /// @brief stores the number of records that were drained upon request
+        bsl::uint64 num;
+        /// @brief stores the number of records lost to overwrites upon request
+        bsl::uint64 dropped;
+
+        /// @brief stores the drained records upon request
+        bsl::array<syscall_trace_record_t, SYSCALL_TRACE_SIZE.get()> records;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
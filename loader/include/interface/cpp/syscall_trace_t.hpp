@@ -0,0 +1,96 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef SYSCALL_TRACE_T_HPP
+#define SYSCALL_TRACE_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief defines the number of records in each PP's syscall trace
+    constexpr bsl::safe_uintmax SYSCALL_TRACE_SIZE{bsl::to_umax(511)};
+    /// @brief defines the number of pages in each PP's syscall trace
+    constexpr bsl::safe_uintmax SYSCALL_TRACE_PAGES{bsl::to_umax(4)};
+    /// @brief defines the size of the reserved field in a syscall_trace_record_t
+    constexpr bsl::safe_uintmax SYSCALL_TRACE_RECORD_RESERVED{bsl::to_umax(3)};
+    /// @brief defines the size of the reserved field in a syscall_trace_t
+    constexpr bsl::safe_uintmax SYSCALL_TRACE_RESERVED{bsl::to_umax(2)};
+
+    /// @struct loader::syscall_trace_record_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines a single record in a syscall trace. All times are
+    ///     raw TSC values taken on the PP that owns the trace.
+    ///
+    struct syscall_trace_record_t final
+    {
+        /// @brief stores RAX (i.e., the signature, opcode and index)
+        bsl::uint64 syscall;
+        /// @brief stores the TSC when the microkernel was entered
+        bsl::uint64 tsc_begin;
+        /// @brief stores the TSC when the syscall finished, or 0 if unfinished
+        bsl::uint64 tsc_end;
+        /// @brief stores the ID of the PP that made the syscall
+        bsl::uint16 ppid;
+        /// @brief stores the ID of the VPS that was active
+        bsl::uint16 vpsid;
+        /// @brief stores 1 if REG0 held the extension's handle, 0 otherwise
+        bsl::uint8 handle_valid;
+        /// @brief reserved
+        bsl::array<bsl::uint8, SYSCALL_TRACE_RECORD_RESERVED.get()> reserved;
+    };
+
+    /// @struct loader::syscall_trace_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the pages that the microkernel records each syscall
+    ///     on a PP into when HYPERVISOR_SYSCALL_TRACE is enabled. The loader
+    ///     allocates one of these for each PP. The records form a ring that
+    ///     is overwritten once it is full. The microkernel only ever writes
+    ///     "total", and the loader only ever writes "drained", so no lock
+    ///     is needed to drain the ring while the PP is running.
+    ///
+    struct syscall_trace_t final
+    {
+        /// @brief stores the total number of syscalls that have been recorded
+        bsl::uint64 total;
+        /// @brief stores the value of total when the trace was last drained
+        bsl::uint64 drained;
+        /// @brief reserved
+        bsl::array<bsl::uint64, SYSCALL_TRACE_RESERVED.get()> reserved;
+
+        /// @brief stores the records in the ring
+        bsl::array<syscall_trace_record_t, SYSCALL_TRACE_SIZE.get()> records;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
@@ -0,0 +1,89 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMEXIT_LOG_T_HPP
+#define VMEXIT_LOG_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief defines the number of records in each PP's VMExit log
+    constexpr bsl::safe_uintmax VMEXIT_LOG_SIZE{bsl::to_umax(85)};
+
+    /// @struct loader::vmexit_log_record_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines a single record in a VMExit log. All times are raw
+    ///     TSC values taken on the PP that owns the log.
+    ///
+    struct vmexit_log_record_t final
+    {
+        /// @brief stores the exit reason of the VMExit
+        bsl::uint64 exit_reason;
+        /// @brief stores the guest RIP at the time of the VMExit
+        bsl::uint64 rip;
+        /// @brief stores the TSC when the VMExit was handed to the microkernel
+        bsl::uint64 tsc_exit;
+        /// @brief stores the TSC when the VPS was resumed, or 0 if still running
+        bsl::uint64 tsc_resume;
+        /// @brief stores the TSC cycles spent in the extension, or 0 if unused
+        bsl::uint64 ext_cycles;
+        /// @brief stores the ID of the VM that caused the VMExit
+        bsl::uint16 vmid;
+        /// @brief stores the ID of the VP that caused the VMExit
+        bsl::uint16 vpid;
+        /// @brief stores the ID of the VPS that caused the VMExit
+        bsl::uint16 vpsid;
+        /// @brief reserved
+        bsl::uint16 reserved;
+    };
+
+    /// @struct loader::vmexit_log_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the page that the microkernel records each VMExit
+    ///     on a PP into. The loader allocates one of these for each PP, and
+    ///     the records form a ring that is overwritten once it is full.
+    ///
+    struct vmexit_log_t final
+    {
+        /// @brief stores the index of the record the next VMExit will use
+        bsl::uint64 pos;
+        /// @brief stores the total number of VMExits that have been recorded
+        bsl::uint64 total;
+
+        /// @brief stores the records in the ring
+        bsl::array<vmexit_log_record_t, VMEXIT_LOG_SIZE.get()> records;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
@@ -0,0 +1,101 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMEXIT_STATS_T_HPP
+#define VMEXIT_STATS_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// @brief defines the number of exit reasons that have their own counter
+    constexpr bsl::safe_uintmax VMEXIT_STATS_REASONS{bsl::to_umax(256)};
+    /// @brief defines the first counter used for folded exit reasons
+    constexpr bsl::safe_uintmax VMEXIT_STATS_FOLD_IDX{bsl::to_umax(0xF0)};
+    /// @brief defines the first exit reason that is folded
+    constexpr bsl::safe_uintmax VMEXIT_STATS_FOLD_REASON{bsl::to_umax(0x400)};
+    /// @brief defines the number of exit reasons that are folded
+    constexpr bsl::safe_uintmax VMEXIT_STATS_FOLD_SIZE{bsl::to_umax(0x10)};
+
+    /// @brief defines the number of log2 buckets in each histogram
+    constexpr bsl::safe_uintmax VMEXIT_STATS_BUCKETS{bsl::to_umax(64)};
+    /// @brief defines the histogram of VMExit to VMExit handler entry
+    constexpr bsl::safe_uintmax VMEXIT_STATS_HIST_EXIT_TO_EXT{bsl::to_umax(0)};
+    /// @brief defines the histogram of time spent in the VMExit handler
+    constexpr bsl::safe_uintmax VMEXIT_STATS_HIST_EXT{bsl::to_umax(1)};
+    /// @brief defines the histogram of resume to the next VMExit
+    constexpr bsl::safe_uintmax VMEXIT_STATS_HIST_GUEST{bsl::to_umax(2)};
+    /// @brief defines the number of histograms
+    constexpr bsl::safe_uintmax VMEXIT_STATS_HISTS{bsl::to_umax(3)};
+
+    /// @brief defines the size of the reserved fields in the vmexit_stats_t
+    constexpr bsl::safe_uintmax VMEXIT_STATS_RESERVED{bsl::to_umax(56)};
+    /// @brief defines the number of reserved fields before the counters
+    constexpr bsl::safe_uintmax VMEXIT_STATS_RESERVED_HEAD{bsl::to_umax(6)};
+
+    /// @brief defines a single log2 latency histogram
+    using vmexit_stats_hist_t = bsl::array<bsl::uint64, VMEXIT_STATS_BUCKETS.get()>;
+
+    /// @struct loader::vmexit_stats_t
+    ///
+    /// <!-- description -->
+    ///   @brief Defines the page that the microkernel aggregates the
+    ///     VMExits of a PP into. The loader allocates one of these for each
+    ///     PP, so no two PPs ever write to the same cache line. Times are in
+    ///     TSC cycles, and bucket N of a histogram counts the samples in
+    ///     [2^N, 2^(N+1)), with bucket 0 also counting samples of 0.
+    ///
+    ///     Each exit reason below VMEXIT_STATS_FOLD_IDX has its own counter.
+    ///     Neither Intel nor AMD use the exit reasons between that and
+    ///     VMEXIT_STATS_REASONS, so AMD's exit codes starting at
+    ///     VMEXIT_STATS_FOLD_REASON (e.g. NPF) are folded into them.
+    ///     Anything else is counted by "other".
+    ///
+    struct vmexit_stats_t final
+    {
+        /// @brief stores the total number of VMExits
+        bsl::uint64 total;
+        /// @brief stores the number of VMExits without their own counter
+        bsl::uint64 other;
+        /// @brief reserved (pads the counters to a cache line)
+        bsl::array<bsl::uint64, VMEXIT_STATS_RESERVED_HEAD.get()> reserved1;
+
+        /// @brief stores the number of VMExits for each exit reason
+        bsl::array<bsl::uint64, VMEXIT_STATS_REASONS.get()> reasons;
+        /// @brief stores the latency histograms
+        bsl::array<vmexit_stats_hist_t, VMEXIT_STATS_HISTS.get()> hists;
+
+        /// @brief reserved (pads the stats to a page)
+        bsl::array<bsl::uint64, VMEXIT_STATS_RESERVED.get()> reserved2;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
@@ -25,6 +25,11 @@
 #ifndef MK_ARGS_T_HPP
 #define MK_ARGS_T_HPP
 
+#include "../page_pool_donations_t.hpp"
+#include "../page_pool_stats_t.hpp"
+#include "../syscall_trace_t.hpp"
+#include "../vmexit_log_t.hpp"
+#include "../vmexit_stats_t.hpp"
 #include "state_save_t.hpp"
 
 #include <bsl/array.hpp>
@@ -58,7 +63,7 @@ namespace loader
         state_save_t *mk_state;
         /// @brief stores the location of the root vp state (0x010)
         state_save_t *root_vp_state;
-        /// @brief stores the location of the debug ring (0x018)
+        /// @brief stores the location of this PP's debug ring (0x018)
         debug_ring_t *debug_ring;
         /// @brief stores the location of the microkernel's ELF file
         bsl::span<bsl::byte const> mk_elf_file;
@@ -68,14 +73,26 @@ namespace loader
         void *rpt;
         /// @brief stores the physical address of the MK's RPT for this CPU
         bsl::uint64 rpt_phys;
-        /// @brief stores the location of the microkernel's page pool
-        bsl::span<bsl::byte> page_pool;
+        /// @brief stores the location of the microkernel's page pool (per node)
+        bsl::array<bsl::span<bsl::byte>, HYPERVISOR_MAX_NUMA_NODES> page_pool;
         /// @brief stores the starting location of the page pool's direct map
         bsl::uint64 page_pool_base_virt;
+        /// @brief stores the pages donated to the page pool by the loader
+        page_pool_donations_t *page_pool_donations;
+        /// @brief stores where the page pool reports how it is being used
+        page_pool_stats_t *page_pool_stats;
         /// @brief stores the location of the microkernel's huge pool
         bsl::span<bsl::byte> huge_pool;
         /// @brief stores the starting location of the huge pool's direct map
         bsl::uint64 huge_pool_base_virt;
+        /// @brief stores the log this PP records each VMExit into
+        vmexit_log_t *vmexit_log;
+        /// @brief stores the stats this PP aggregates each VMExit into
+        vmexit_stats_t *vmexit_stats;
+        /// @brief stores the trace this PP records each syscall into
+        syscall_trace_t *syscall_trace;
+        /// @brief stores the NUMA node (i.e., page pool) that each PP belongs to
+        bsl::array<bsl::uint8, HYPERVISOR_MAX_PPS> pp_to_node;
     };
 
     namespace details
@@ -54,10 +54,10 @@ namespace loader
         bsl::uint64 a : static_cast<bsl::uint64>(1);
         /// @brief defines an ignored field in the page
         bsl::uint64 ignored1 : static_cast<bsl::uint64>(1);
-        /// @brief defines a field in the page that must be 0
-        bsl::uint64 mbz1 : static_cast<bsl::uint64>(1);
-        /// @brief defines an ignored field in the page
-        bsl::uint64 ignored2 : static_cast<bsl::uint64>(1);
+        /// @brief defines the "page size" field in the page (2M page if set)
+        bsl::uint64 ps : static_cast<bsl::uint64>(1);
+        /// @brief defines the "global" field in the page (only if ps is set)
+        bsl::uint64 g : static_cast<bsl::uint64>(1);
         /// @brief defines the "available to software" field in the page
         bsl::uint64 avl : static_cast<bsl::uint64>(3);
         /// @brief defines the physical address field in the page
@@ -0,0 +1,71 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PAGE_POOL_NODE_T_H
+#define PAGE_POOL_NODE_T_H
+
+#include <types.h>
+
+/** @brief defines the size of each chunk of the page pool (a 2M page) */
+#define LOADER_PAGE_POOL_CHUNK_SIZE ((uint64_t)0x200000)
+
+/**
+ * @struct page_pool_chunk_t
+ *
+ * <!-- description -->
+ *   @brief Defines a single allocation that makes up part of the
+ *     microkernel's page pool.
+ */
+struct page_pool_chunk_t
+{
+    /** @brief stores the address of the chunk */
+    uint8_t *addr;
+    /** @brief stores the number of bytes in the chunk */
+    uint64_t size;
+    /** @brief stores 1 if the chunk is physically contiguous, 0 otherwise */
+    uint64_t contiguous;
+};
+
+/**
+ * @struct page_pool_node_t
+ *
+ * <!-- description -->
+ *   @brief Defines a single NUMA node's portion of the microkernel's page
+ *     pool. Whenever possible, each chunk is physically contiguous so
+ *     that it can be mapped into the microkernel's direct map using a
+ *     single 2M page.
+ */
+struct page_pool_node_t
+{
+    /** @brief stores the chunks that make up the node's page pool */
+    struct page_pool_chunk_t *chunks;
+    /** @brief stores the total number of chunks */
+    uint64_t num_chunks;
+    /** @brief stores the total number of bytes in all of the chunks */
+    uint64_t size;
+};
+
+#endif
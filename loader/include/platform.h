@@ -51,6 +51,24 @@
  */
 void *platform_alloc(uint64_t const size);
 
+/**
+ * <!-- description -->
+ *   @brief This function allocates read/write virtual memory from the
+ *     kernel, backed by physical memory that is local to the provided
+ *     NUMA node whenever possible. This memory is not physically
+ *     contiguous. The resulting pointer is at least 4k aligned. Use
+ *     platform_free() to release this memory.
+ *
+ *   @note This function must zero the allocated memory
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the number of bytes to allocate
+ *   @param node the NUMA node to allocate the memory from
+ *   @return Returns a pointer to the newly allocated memory on success.
+ *     Returns a nullptr on failure.
+ */
+void *platform_alloc_node(uint64_t const size, uint32_t const node);
+
 /**
  * <!-- description -->
  *   @brief This function allocates read/write virtual memory from the
@@ -68,6 +86,29 @@ void *platform_alloc(uint64_t const size);
  */
 void *platform_alloc_contiguous(uint64_t const size);
 
+/**
+ * <!-- description -->
+ *   @brief This function allocates read/write virtual memory from the
+ *     kernel, backed by physical memory that is local to the provided
+ *     NUMA node whenever possible. This memory is physically contiguous.
+ *     If size is a power of 2, the resulting memory is also physically
+ *     aligned to size, otherwise the resulting pointer is at least 4k
+ *     aligned. Unlike the other allocation functions, failure is not
+ *     reported as an error as callers are expected to fall back to
+ *     platform_alloc_node(). Use platform_free_contiguous() to release
+ *     this memory.
+ *
+ *   @note This function must zero the allocated memory
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the number of bytes to allocate
+ *   @param node the NUMA node to allocate the memory from
+ *   @return Returns a pointer to the newly allocated memory on success.
+ *     Returns a nullptr on failure.
+ */
+void *platform_alloc_contiguous_node(
+    uint64_t const size, uint32_t const node);
+
 /**
  * <!-- description -->
  *   @brief This function frees memory previously allocated using the
@@ -138,6 +179,18 @@ int64_t platform_memset(void *const ptr, uint8_t const val, uint64_t const num);
 int64_t
 platform_memcpy(void *const dst, void const *const src, uint64_t const num);
 
+/**
+ * <!-- description -->
+ *   @brief Stores "val" to "ptr" with release semantics. Any memory that
+ *     was written before this call is visible to any other CPU (including
+ *     the microkernel) that sees "val" with an acquire load.
+ *
+ * <!-- inputs/outputs -->
+ *   @param ptr a pointer to the memory to store to
+ *   @param val the value to store
+ */
+void platform_store_release(uint64_t *const ptr, uint64_t const val);
+
 /**
  * <!-- description -->
  *   @brief Copies "num" bytes from "src" to "dst". If "src" or "dst" are
@@ -179,6 +232,26 @@ int64_t platform_copy_to_user(
  */
 uint32_t platform_num_online_cpus(void);
 
+/**
+ * <!-- description -->
+ *   @brief Returns the total number of online NUMA nodes. Nodes are
+ *     numbered from 0 to platform_num_online_nodes() - 1.
+ *
+ * <!-- inputs/outputs -->
+ *   @return Returns the total number of online NUMA nodes
+ */
+uint32_t platform_num_online_nodes(void);
+
+/**
+ * <!-- description -->
+ *   @brief Returns the NUMA node that the provided CPU belongs to.
+ *
+ * <!-- inputs/outputs -->
+ *   @param cpu the CPU to query
+ *   @return Returns the NUMA node that the provided CPU belongs to.
+ */
+uint32_t platform_cpu_to_node(uint32_t const cpu);
+
 /**
  * @brief The callback signature for platform_on_each_cpu
  */
@@ -202,4 +275,25 @@ typedef int64_t (*platform_per_cpu_func)(uint32_t const);
 int64_t
 platform_on_each_cpu(platform_per_cpu_func const func, uint32_t const reverse);
 
+/**
+ * <!-- description -->
+ *   @brief Initializes the loader's mutex. This must be called before
+ *     the loader can receive an IOCTL.
+ */
+void platform_mutex_init(void);
+
+/**
+ * <!-- description -->
+ *   @brief Acquires the loader's mutex. The IOCTLs that change the state
+ *     of the VMM (i.e., start, stop and add pages) hold this mutex so that
+ *     they cannot run at the same time. This function might sleep.
+ */
+void platform_mutex_lock(void);
+
+/**
+ * <!-- description -->
+ *   @brief Releases the loader's mutex.
+ */
+void platform_mutex_unlock(void);
+
 #endif
@@ -27,7 +27,7 @@
 #ifndef GET_MK_PAGE_POOL_HEAD_H
 #define GET_MK_PAGE_POOL_HEAD_H
 
-#include <mutable_span_t.h>
+#include <page_pool_node_t.h>
 #include <types.h>
 
 /**
@@ -35,14 +35,15 @@
  *   @brief This function gets the addr of the microkernel's page pool=
  *
  * <!-- inputs/outputs -->
- *   @param page_pool a pointer to a mutable_span_t that stores the page pool
+ *   @param page_pool a pointer to a page_pool_node_t that stores the
+ *     node's page pool
  *   @param base_virt provide the base virtual address that the page pool
  *     was mapped to.
  *   @param addr where to store the resulting addr of the page pool
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
 int64_t get_mk_page_pool_addr(
-    struct mutable_span_t const *const page_pool,
+    struct page_pool_node_t const *const page_pool,
     uint64_t const base_virt,
     uint8_t **const addr);
 
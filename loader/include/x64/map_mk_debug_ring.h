@@ -32,13 +32,12 @@
 
 /**
  * <!-- description -->
- *   @brief This function maps the microkernel's debug_ring into the
+ *   @brief This function maps the debug ring of each PP into the
  *     microkernel's root page tables.
  *
  * <!-- inputs/outputs -->
- *   @param debug_ring a pointer to a debug_ring_t that stores the debug_ring
- *     being mapped
- *   @param pml4t the root page table to map the debug_ring into
+ *   @param debug_ring a pointer to the debug_ring_t array being mapped
+ *   @param pml4t the root page table to map the debug rings into
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
 int64_t map_mk_debug_ring(
@@ -0,0 +1,65 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MAP_MK_DONATED_PAGES_H
+#define MAP_MK_DONATED_PAGES_H
+
+#include <mutable_span_t.h>
+#include <page_pool_donations_t.h>
+#include <pml4t_t.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief This function maps memory that is being donated to the
+ *     microkernel's page pool while the microkernel is running into the
+ *     microkernel's direct map, and fills in the provided donation with
+ *     the resulting linked list of pages. See map_mk_page_pool for more
+ *     details on how this linked list is created.
+ *
+ *   @note The microkernel aliases the PML4 entries of the root page table
+ *     that the loader gives it when it starts. As a result, new mappings
+ *     added while the microkernel is running are only seen by the
+ *     microkernel if they land in a PML4 entry that already existed when
+ *     the microkernel was started. If this is not the case, this function
+ *     will fail.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pages a pointer to a mutable_span_t that stores the memory that
+ *     is being donated
+ *   @param base_virt provide the base virtual address that the page pool
+ *     is mapped to.
+ *   @param pml4t the root page table to map the donated memory into
+ *   @param donation the donation to fill in
+ *   @return 0 on success, LOADER_FAILURE on failure.
+ */
+int64_t map_mk_donated_pages(
+    struct mutable_span_t const *const pages,
+    uint64_t const base_virt,
+    struct pml4t_t *const pml4t,
+    struct page_pool_donation_t *const donation);
+
+#endif
@@ -27,7 +27,7 @@
 #ifndef MAP_MK_PAGE_POOL_H
 #define MAP_MK_PAGE_POOL_H
 
-#include <mutable_span_t.h>
+#include <page_pool_node_t.h>
 #include <pml4t_t.h>
 #include <types.h>
 
@@ -42,22 +42,29 @@
  *     is mapped to the direct map base address (virt), with the
  *     physical address added (i.e., to get the physical address of a
  *     page from the page pool, just take it's virtual address and
- *     subtract virt). Then, the first 64 bits of the page store the
- *     address of the next page in the page pool (using the direct map
- *     address). This way, all we need to do is pass virt to the
- *     microkernel, and it will have the HEAD of a linked list of pages
- *     that can be used as a page pool.
+ *     subtract virt). Chunks that are physically contiguous and 2M
+ *     aligned are mapped using a single 2M page, everything else is
+ *     mapped using 4k pages. Then, the page pool is broken up into runs
+ *     of physically contiguous pages, and the first page of each run
+ *     stores a page_pool_run_t which holds the size of the run as well
+ *     as the address of the next run (using the direct map address).
+ *     This way, all we need to do is pass virt to the microkernel, and
+ *     it will have the HEAD of a linked list of runs that it can carve
+ *     pages out of as they are needed, without the loader having to
+ *     touch every page. Each NUMA node's portion of the page pool gets
+ *     its own linked list so that the microkernel can tell which node
+ *     a free page belongs to.
  *
  * <!-- inputs/outputs -->
- *   @param page_pool a pointer to a mutable_span_t that stores the page pool
- *     being mapped
+ *   @param page_pool the array of page_pool_node_t (one per node) that
+ *     stores the page pool being mapped
  *   @param base_virt provide the base virtual address that the page pool
  *     should be mapped to.
  *   @param pml4t the root page table to map the page pool into
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
 int64_t map_mk_page_pool(
-    struct mutable_span_t const *const page_pool,
+    struct page_pool_node_t const *const page_pool,
     uint64_t const base_virt,
     struct pml4t_t *const pml4t);
 
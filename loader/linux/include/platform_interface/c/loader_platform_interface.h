@@ -29,10 +29,15 @@
 #ifndef LOADER_PLATFORM_INTERFACE_H
 #define LOADER_PLATFORM_INTERFACE_H
 
+#include <add_pages_args_t.h>
 #include <dump_vmm_args_t.h>
 #include <linux/ioctl.h>
+#include <mem_stats_args_t.h>
 #include <start_vmm_args_t.h>
+#include <stats_args_t.h>
 #include <stop_vmm_args_t.h>
+#include <syscall_trace_args_t.h>
+#include <vmexit_log_args_t.h>
 
 /** @brief defines the name of the loader */
 #define LOADER_NAME "bareflank_loader"
@@ -49,4 +54,23 @@
 /** @brief defines IOCTL for dumping a VMs debug ring */
 #define LOADER_DUMP_VMM _IOWR(0U, LOADER_DUMP_VMM_CMD, struct dump_vmm_args_t *)
 
+/** @brief defines IOCTL for adding pages to a VMs page pool */
+#define LOADER_ADD_PAGES                                                       \
+    _IOW(0U, LOADER_ADD_PAGES_CMD, struct add_pages_args_t *)
+
+/** @brief defines IOCTL for reading a VMs memory stats */
+#define LOADER_MEM_STATS                                                       \
+    _IOWR(0U, LOADER_MEM_STATS_CMD, struct mem_stats_args_t *)
+
+/** @brief defines IOCTL for reading a PP's VMExit log */
+#define LOADER_VMEXIT_LOG                                                      \
+    _IOWR(0U, LOADER_VMEXIT_LOG_CMD, struct vmexit_log_args_t *)
+
+/** @brief defines IOCTL for reading a PP's VMExit stats */
+#define LOADER_STATS _IOWR(0U, LOADER_STATS_CMD, struct stats_args_t *)
+
+/** @brief defines IOCTL for draining a PP's syscall trace */
+#define LOADER_SYSCALL_TRACE                                                   \
+    _IOWR(0U, LOADER_SYSCALL_TRACE_CMD, struct syscall_trace_args_t *)
+
 #endif
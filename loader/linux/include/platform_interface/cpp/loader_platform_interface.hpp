@@ -29,10 +29,15 @@
 #ifndef LOADER_PLATFORM_INTERFACE_H
 #define LOADER_PLATFORM_INTERFACE_H
 
+#include <add_pages_args_t.hpp>
 #include <dump_vmm_args_t.hpp>
 #include <linux/ioctl.h>
+#include <mem_stats_args_t.hpp>
 #include <start_vmm_args_t.hpp>
+#include <stats_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
+#include <syscall_trace_args_t.hpp>
+#include <vmexit_log_args_t.hpp>
 
 #include <bsl/safe_integral.hpp>
 #include <bsl/string_view.hpp>
@@ -53,6 +58,21 @@ namespace loader
     /// @brief defines IOCTL for dumping a VMs debug ring
     constexpr bsl::safe_uintmax DUMP_VMM{static_cast<bsl::uintmax>(
         _IOWR(0U, DUMP_VMM_CMD.get(), dump_vmm_args_t *))};
+    /// @brief defines IOCTL for adding pages to a VMs page pool
+    constexpr bsl::safe_uintmax ADD_PAGES{static_cast<bsl::uintmax>(
+        _IOW(0U, ADD_PAGES_CMD.get(), add_pages_args_t *))};
+    /// @brief defines IOCTL for reading a VMs memory stats
+    constexpr bsl::safe_uintmax MEM_STATS{static_cast<bsl::uintmax>(
+        _IOWR(0U, MEM_STATS_CMD.get(), mem_stats_args_t *))};
+    /// @brief defines IOCTL for reading a PP's VMExit log
+    constexpr bsl::safe_uintmax VMEXIT_LOG{static_cast<bsl::uintmax>(
+        _IOWR(0U, VMEXIT_LOG_CMD.get(), vmexit_log_args_t *))};
+    /// @brief defines IOCTL for reading a PP's VMExit stats
+    constexpr bsl::safe_uintmax STATS{
+        static_cast<bsl::uintmax>(_IOWR(0U, STATS_CMD.get(), stats_args_t *))};
+    /// @brief defines IOCTL for draining a PP's syscall trace
+    constexpr bsl::safe_uintmax SYSCALL_TRACE{static_cast<bsl::uintmax>(
+        _IOWR(0U, SYSCALL_TRACE_CMD.get(), syscall_trace_args_t *))};
 }
 
 #endif
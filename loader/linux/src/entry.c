@@ -26,7 +26,10 @@
  * SOFTWARE.
  */
 
+#include <add_pages.h>
+#include <add_pages_args_t.h>
 #include <debug.h>
+#include <drain_syscall_trace.h>
 #include <dump_vmm.h>
 #include <dump_vmm_args_t.h>
 #include <linux/kernel.h>
@@ -38,11 +41,18 @@
 #include <loader_fini.h>
 #include <loader_init.h>
 #include <loader_platform_interface.h>
+#include <mem_stats.h>
+#include <mem_stats_args_t.h>
+#include <read_vmexit_log.h>
+#include <read_vmexit_stats.h>
 #include <start_vmm.h>
 #include <start_vmm_args_t.h>
+#include <stats_args_t.h>
 #include <stop_vmm.h>
 #include <stop_vmm_args_t.h>
+#include <syscall_trace_args_t.h>
 #include <types.h>
+#include <vmexit_log_args_t.h>
 
 static int
 dev_open(struct inode *inode, struct file *file)
@@ -81,6 +91,41 @@ dev_unlocked_ioctl(struct file *file, unsigned int cmd, unsigned long arg)
             }
             break;
         }
+        case LOADER_ADD_PAGES: {
+            if (add_pages((struct add_pages_args_t const *)arg)) {
+                BFERROR("add_pages failed\n");
+                return ((long)-EPERM);
+            }
+            break;
+        }
+        case LOADER_MEM_STATS: {
+            if (mem_stats((struct mem_stats_args_t *)arg)) {
+                BFERROR("mem_stats failed\n");
+                return ((long)-EPERM);
+            }
+            break;
+        }
+        case LOADER_VMEXIT_LOG: {
+            if (read_vmexit_log((struct vmexit_log_args_t *)arg)) {
+                BFERROR("read_vmexit_log failed\n");
+                return ((long)-EPERM);
+            }
+            break;
+        }
+        case LOADER_STATS: {
+            if (read_vmexit_stats((struct stats_args_t *)arg)) {
+                BFERROR("read_vmexit_stats failed\n");
+                return ((long)-EPERM);
+            }
+            break;
+        }
+        case LOADER_SYSCALL_TRACE: {
+            if (drain_syscall_trace((struct syscall_trace_args_t *)arg)) {
+                BFERROR("drain_syscall_trace failed\n");
+                return ((long)-EPERM);
+            }
+            break;
+        }
         default: {
             BFERROR("invalid ioctl cmd: 0x%x\n", cmd);
             return ((long)-EINVAL);
@@ -26,16 +26,23 @@
  * SOFTWARE.
  */
 
+#include <asm/barrier.h>
 #include <asm/io.h>
 #include <debug.h>
 #include <linux/cpu.h>
 #include <linux/mm.h>
+#include <linux/mutex.h>
+#include <linux/nodemask.h>
 #include <linux/slab.h>
 #include <linux/smp.h>
+#include <linux/topology.h>
 #include <linux/vmalloc.h>
 #include <platform.h>
 #include <types.h>
 
+/** @brief stores the loader's mutex (see platform_mutex_lock) */
+static struct mutex g_platform_mutex;
+
 /**
  * <!-- description -->
  *   @brief This function allocates read/write virtual memory from the
@@ -70,6 +77,41 @@ platform_alloc(uint64_t const size)
     return memset(ret, 0, size);
 }
 
+/**
+ * <!-- description -->
+ *   @brief This function allocates read/write virtual memory from the
+ *     kernel, backed by physical memory that is local to the provided
+ *     NUMA node whenever possible. This memory is not physically
+ *     contiguous. The resulting pointer is at least 4k aligned. Use
+ *     platform_free() to release this memory.
+ *
+ *   @note This function must zero the allocated memory
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the number of bytes to allocate
+ *   @param node the NUMA node to allocate the memory from
+ *   @return Returns a pointer to the newly allocated memory on success.
+ *     Returns a nullptr on failure.
+ */
+void *
+platform_alloc_node(uint64_t const size, uint32_t const node)
+{
+    void *ret;
+
+    if (0 == size) {
+        BFERROR("invalid number of bytes (i.e., size)\n");
+        return ((void *)0);
+    }
+
+    ret = vmalloc_node(size, (int)node);
+    if (((void *)0) == ret) {
+        BFERROR("vmalloc_node failed\n");
+        return ((void *)0);
+    }
+
+    return memset(ret, 0, size);
+}
+
 /**
  * <!-- description -->
  *   @brief This function allocates read/write virtual memory from the
@@ -104,6 +146,44 @@ platform_alloc_contiguous(uint64_t const size)
     return memset(ret, 0, size);
 }
 
+/**
+ * <!-- description -->
+ *   @brief This function allocates read/write virtual memory from the
+ *     kernel, backed by physical memory that is local to the provided
+ *     NUMA node whenever possible. This memory is physically contiguous.
+ *     If size is a power of 2, the resulting memory is also physically
+ *     aligned to size, otherwise the resulting pointer is at least 4k
+ *     aligned. Unlike the other allocation functions, failure is not
+ *     reported as an error as callers are expected to fall back to
+ *     platform_alloc_node(). Use platform_free_contiguous() to release
+ *     this memory.
+ *
+ *   @note This function must zero the allocated memory
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the number of bytes to allocate
+ *   @param node the NUMA node to allocate the memory from
+ *   @return Returns a pointer to the newly allocated memory on success.
+ *     Returns a nullptr on failure.
+ */
+void *
+platform_alloc_contiguous_node(uint64_t const size, uint32_t const node)
+{
+    void *ret;
+
+    if (0 == size) {
+        BFERROR("invalid number of bytes (i.e., size)\n");
+        return ((void *)0);
+    }
+
+    ret = kmalloc_node(size, GFP_KERNEL | __GFP_NOWARN, (int)node);
+    if (((void *)0) == ret) {
+        return ((void *)0);
+    }
+
+    return memset(ret, 0, size);
+}
+
 /**
  * <!-- description -->
  *   @brief This function frees memory previously allocated using the
@@ -227,6 +307,22 @@ platform_memcpy(void *const dst, void const *const src, uint64_t const num)
     return 0;
 }
 
+/**
+ * <!-- description -->
+ *   @brief Stores "val" to "ptr" with release semantics. Any memory that
+ *     was written before this call is visible to any other CPU (including
+ *     the microkernel) that sees "val" with an acquire load.
+ *
+ * <!-- inputs/outputs -->
+ *   @param ptr a pointer to the memory to store to
+ *   @param val the value to store
+ */
+void
+platform_store_release(uint64_t *const ptr, uint64_t const val)
+{
+    smp_store_release(ptr, val);
+}
+
 /**
  * <!-- description -->
  *   @brief Copies "num" bytes from "src" to "dst". If "src" or "dst" are
@@ -302,6 +398,34 @@ platform_num_online_cpus(void)
     return num_online_cpus();
 }
 
+/**
+ * <!-- description -->
+ *   @brief Returns the total number of online NUMA nodes. Nodes are
+ *     numbered from 0 to platform_num_online_nodes() - 1.
+ *
+ * <!-- inputs/outputs -->
+ *   @return Returns the total number of online NUMA nodes
+ */
+uint32_t
+platform_num_online_nodes(void)
+{
+    return num_online_nodes();
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns the NUMA node that the provided CPU belongs to.
+ *
+ * <!-- inputs/outputs -->
+ *   @param cpu the CPU to query
+ *   @return Returns the NUMA node that the provided CPU belongs to.
+ */
+uint32_t
+platform_cpu_to_node(uint32_t const cpu)
+{
+    return (uint32_t)cpu_to_node((int)cpu);
+}
+
 /**
  * <!-- description -->
  *   @brief This function is called when the user calls platform_on_each_cpu.
@@ -416,3 +540,36 @@ platform_on_each_cpu(platform_per_cpu_func const func, uint32_t const order)
 
     return ret;
 }
+
+/**
+ * <!-- description -->
+ *   @brief Initializes the loader's mutex. This must be called before
+ *     the loader can receive an IOCTL.
+ */
+void
+platform_mutex_init(void)
+{
+    mutex_init(&g_platform_mutex);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Acquires the loader's mutex. The IOCTLs that change the state
+ *     of the VMM (i.e., start, stop and add pages) hold this mutex so that
+ *     they cannot run at the same time. This function might sleep.
+ */
+void
+platform_mutex_lock(void)
+{
+    mutex_lock(&g_platform_mutex);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Releases the loader's mutex.
+ */
+void
+platform_mutex_unlock(void)
+{
+    mutex_unlock(&g_platform_mutex);
+}
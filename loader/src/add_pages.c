@@ -0,0 +1,249 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <add_pages_args_t.h>
+#include <constants.h>
+#include <debug.h>
+#include <g_mk_page_pool.h>
+#include <g_mk_page_pool_donations.h>
+#include <g_mk_root_page_table.h>
+#include <map_mk_donated_pages.h>
+#include <mutable_span_t.h>
+#include <page_pool_donations_t.h>
+#include <platform.h>
+#include <types.h>
+#include <vmm_status.h>
+
+/**
+ * <!-- description -->
+ *   @brief Verifies that the arguments from the IOCTL are valid.
+ *
+ * <!-- inputs/outputs -->
+ *   @param args the arguments to verify
+ *   @return 0 on success, LOADER_FAILURE on failure.
+ */
+static int64_t
+verify_add_pages_args(struct add_pages_args_t const *const args)
+{
+    if (((uint64_t)1) != args->ver) {
+        BFERROR("IOCTL ABI version not supported\n");
+        return LOADER_FAILURE;
+    }
+
+    if (((uint64_t)0) == args->num_pages) {
+        BFERROR("num_pages is invalid\n");
+        return LOADER_FAILURE;
+    }
+
+    /** NOTE: alloc_mk_page_pool also limits the page pool to 32bits */
+    if (((uint64_t)0xFFFFFFFF) < args->num_pages) {
+        BFERROR("num_pages is invalid\n");
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Allocates, maps and donates a single node's portion of the
+ *     pages that are being added to the microkernel's page pool. The
+ *     donation is filled in before the donation count is incremented
+ *     which is what publishes the donation to the microkernel. The
+ *     caller must hold the loader's mutex.
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the total number of bytes to add to the node
+ *   @param node the NUMA node to allocate the pages from
+ *   @return 0 on success, LOADER_FAILURE on failure.
+ */
+static int64_t
+add_pages_to_node(uint64_t const size, uint64_t const node)
+{
+    struct page_pool_donation_t donation;
+    uint64_t const idx = g_mk_page_pool_donations->count;
+    struct mutable_span_t *pages;
+
+    if (LOADER_MAX_PAGE_POOL_DONATIONS <= idx) {
+        BFERROR("the maximum number of page pool donations was reached\n");
+        return LOADER_FAILURE;
+    }
+
+    pages = &g_mk_donated_pages[idx];
+
+    pages->size = size;
+    pages->addr = platform_alloc_node(size, (uint32_t)node);
+    if (((void *)0) == pages->addr) {
+        BFERROR("platform_alloc_node failed\n");
+        goto platform_alloc_node_failed;
+    }
+
+    if (map_mk_donated_pages(
+            pages, g_mk_page_pool_base_virt, g_mk_root_page_table, &donation)) {
+        BFERROR("map_mk_donated_pages failed\n");
+        goto map_mk_donated_pages_failed;
+    }
+
+    donation.node = node;
+
+    /**
+     * NOTE: The microkernel reads the donation once it sees the count
+     * change (using an acquire load), so the count is published with a
+     * release store, which ensures the donation is written first.
+     */
+
+    if (platform_memcpy(
+            &g_mk_page_pool_donations->donations[idx],
+            &donation,
+            sizeof(struct page_pool_donation_t))) {
+        BFERROR("platform_memcpy failed\n");
+        goto platform_memcpy_failed;
+    }
+
+    platform_store_release(
+        &g_mk_page_pool_donations->count, idx + ((uint64_t)1));
+    return LOADER_SUCCESS;
+
+platform_memcpy_failed:
+map_mk_donated_pages_failed:
+
+    /**
+     * NOTE: Any pages that were mapped are left mapped. The microkernel
+     * never sees them as they were not donated, and they are removed with
+     * the rest of the root page table when the VMM is stopped.
+     */
+
+    platform_free(pages->addr, pages->size);
+
+platform_alloc_node_failed:
+
+    platform_memset(pages, 0, sizeof(struct mutable_span_t));
+    return LOADER_FAILURE;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Adds pages to the microkernel's page pool. The pages are split
+ *     evenly between each online NUMA node, the same way that
+ *     alloc_mk_page_pool splits the original page pool.
+ *
+ * <!-- inputs/outputs -->
+ *   @param num_pages the total number of pages (not bytes) to add
+ *   @return 0 on success, LOADER_FAILURE on failure.
+ */
+static int64_t
+add_pages_to_the_vmm(uint64_t const num_pages)
+{
+    uint64_t node;
+    uint64_t num_nodes;
+    uint64_t node_size;
+
+    if (VMM_STATUS_RUNNING != g_vmm_status) {
+        BFERROR("Unable to add pages, the VMM is not running\n");
+        return LOADER_FAILURE;
+    }
+
+    num_nodes = (uint64_t)platform_num_online_nodes();
+    if (((uint64_t)0) == num_nodes) {
+        num_nodes = ((uint64_t)1);
+    }
+
+    if (num_nodes > HYPERVISOR_MAX_NUMA_NODES) {
+        num_nodes = HYPERVISOR_MAX_NUMA_NODES;
+    }
+
+    if (num_nodes > num_pages) {
+        num_nodes = num_pages;
+    }
+
+    if (g_mk_page_pool_donations->count + num_nodes >
+        LOADER_MAX_PAGE_POOL_DONATIONS) {
+        BFERROR("the maximum number of page pool donations was reached\n");
+        return LOADER_FAILURE;
+    }
+
+    node_size = (num_pages / num_nodes) * HYPERVISOR_PAGE_SIZE;
+    for (node = ((uint64_t)0); node < num_nodes; ++node) {
+        if (add_pages_to_node(node_size, node)) {
+            BFERROR("add_pages_to_node failed\n");
+            return LOADER_FAILURE;
+        }
+    }
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief This function contains all of the code that is common between
+ *     all archiectures and all platforms for adding pages to the
+ *     microkernel's page pool while the VMM is running. This function
+ *     will call platform and architecture specific functions as needed.
+ *
+ * <!-- inputs/outputs -->
+ *   @param ioctl_args arguments from the ioctl
+ *   @return 0 on success, LOADER_FAILURE on failure.
+ */
+int64_t
+add_pages(struct add_pages_args_t const *const ioctl_args)
+{
+    int64_t ret;
+    struct add_pages_args_t args;
+
+    if (((void *)0) == ioctl_args) {
+        BFERROR("ioctl_args was ((void *)0)\n");
+        return LOADER_FAILURE;
+    }
+
+    ret = platform_copy_from_user(
+        &args, ioctl_args, sizeof(struct add_pages_args_t));
+    if (ret) {
+        BFERROR("platform_copy_from_user failed\n");
+        return LOADER_FAILURE;
+    }
+
+    if (verify_add_pages_args(&args)) {
+        BFERROR("verify_add_pages_args failed\n");
+        return LOADER_FAILURE;
+    }
+
+    /**
+     * NOTE: The mutex keeps two calls from claiming the same donation
+     * slot, and keeps the VMM from being stopped (which frees the
+     * donations) while pages are being added.
+     */
+
+    platform_mutex_lock();
+    ret = add_pages_to_the_vmm(args.num_pages);
+    platform_mutex_unlock();
+
+    if (ret) {
+        BFERROR("add_pages_to_the_vmm failed\n");
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
@@ -24,6 +24,7 @@
  * SOFTWARE.
  */
 
+#include <constants.h>
 #include <debug.h>
 #include <debug_ring_t.h>
 #include <platform.h>
@@ -31,19 +32,20 @@
 
 /**
  * <!-- description -->
- *   @brief Allocates a chunk of memory for the debug ring that will be
- *     used by the microkernel.
+ *   @brief Allocates the debug rings that will be used by the
+ *     microkernel, one for each online PP.
  *
  * <!-- inputs/outputs -->
- *   @param debug_ring the debug_ring_t to store the newly allocated
- *     debug ring
+ *   @param debug_ring where to store the newly allocated debug rings
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
 int64_t
 alloc_mk_debug_ring(struct debug_ring_t **const debug_ring)
 {
-    *debug_ring =
-        (struct debug_ring_t *)platform_alloc(HYPERVISOR_DEBUG_RING_SIZE);
+    uint64_t const size =
+        ((uint64_t)platform_num_online_cpus()) * sizeof(struct debug_ring_t);
+
+    *debug_ring = (struct debug_ring_t *)platform_alloc(size);
     if (((void *)0) == *debug_ring) {
         BFERROR("platform_alloc failed\n");
         return LOADER_FAILURE;
@@ -26,10 +26,72 @@
 
 #include <constants.h>
 #include <debug.h>
-#include <mutable_span_t.h>
+#include <free_mk_page_pool.h>
+#include <page_pool_node_t.h>
 #include <platform.h>
 #include <types.h>
 
+/**
+ * <!-- description -->
+ *   @brief Allocates a single NUMA node's portion of the page pool used
+ *     by the microkernel. See alloc_mk_page_pool for more details.
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the total number of bytes to allocate
+ *   @param node the NUMA node to allocate the memory from
+ *   @param page_pool the page_pool_node_t to store the node's page pool in
+ *   @return 0 on success, LOADER_FAILURE on failure.
+ */
+static int64_t
+alloc_mk_page_pool_node(
+    uint64_t const size,
+    uint32_t const node,
+    struct page_pool_node_t *const page_pool)
+{
+    uint64_t idx;
+    uint64_t remaining = size;
+    uint64_t const num_chunks =
+        (size + (LOADER_PAGE_POOL_CHUNK_SIZE - ((uint64_t)1))) /
+        LOADER_PAGE_POOL_CHUNK_SIZE;
+
+    page_pool->chunks = (struct page_pool_chunk_t *)platform_alloc(
+        num_chunks * sizeof(struct page_pool_chunk_t));
+    if (((void *)0) == page_pool->chunks) {
+        BFERROR("platform_alloc failed\n");
+        return LOADER_FAILURE;
+    }
+
+    page_pool->num_chunks = num_chunks;
+    page_pool->size = size;
+
+    for (idx = ((uint64_t)0); idx < num_chunks; ++idx) {
+        struct page_pool_chunk_t *const chunk = &page_pool->chunks[idx];
+
+        chunk->size = LOADER_PAGE_POOL_CHUNK_SIZE;
+        if (remaining < LOADER_PAGE_POOL_CHUNK_SIZE) {
+            chunk->size = remaining;
+        }
+
+        remaining -= chunk->size;
+
+        if (LOADER_PAGE_POOL_CHUNK_SIZE == chunk->size) {
+            chunk->addr = platform_alloc_contiguous_node(chunk->size, node);
+            if (((void *)0) != chunk->addr) {
+                chunk->contiguous = ((uint64_t)1);
+                continue;
+            }
+        }
+
+        chunk->addr = platform_alloc_node(chunk->size, node);
+        if (((void *)0) == chunk->addr) {
+            BFERROR("platform_alloc_node failed\n");
+            return LOADER_FAILURE;
+        }
+    }
+
+    return LOADER_SUCCESS;
+}
+
 /**
  * <!-- description -->
  *   @brief Allocates a chunk of memory for the page pool used by the
@@ -37,31 +99,92 @@
  *     not in bytes. Finally, if the provided size is 0, this function
  *     will allocate a default number of pages.
  *
+ *   @note The page pool is split evenly between each online NUMA node
+ *     (up to HYPERVISOR_MAX_NUMA_NODES), and each node's portion of the
+ *     page pool is allocated from memory that is local to that node.
+ *     The NUMA node of each online CPU is stored in pp_to_node so that
+ *     the microkernel can prefer pages that are local to the PP that is
+ *     asking for them.
+ *
+ *   @note Each node's portion of the page pool is allocated in chunks of
+ *     LOADER_PAGE_POOL_CHUNK_SIZE bytes. Each chunk is allocated from
+ *     physically contiguous memory whenever possible so that it can be
+ *     mapped using a single 2M page, and only falls back to memory that
+ *     is not physically contiguous when contiguous memory is not
+ *     available.
+ *
  * <!-- inputs/outputs -->
  *   @param size the total number of pages (not bytes) to allocate
- *   @param page_pool the mutable_span_t to store the page pool addr/size.
+ *   @param page_pool the array of page_pool_node_t (one per node) to
+ *     store the page pool in.
+ *   @param pp_to_node the array (one per PP) to store each PP's node in
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
 int64_t
-alloc_mk_page_pool(uint32_t const size, struct mutable_span_t *const page_pool)
+alloc_mk_page_pool(
+    uint32_t const size,
+    struct page_pool_node_t *const page_pool,
+    uint8_t *const pp_to_node)
 {
+    uint64_t total_size;
+    uint64_t node_size;
+    uint64_t num_nodes;
+    uint64_t node;
+    uint64_t cpu;
+    uint64_t num_cpus;
+
     if (0U == size) {
-        page_pool->size = HYPERVISOR_PAGE_POOL_SIZE;
+        total_size = HYPERVISOR_PAGE_POOL_SIZE;
     }
     else {
-        page_pool->size = HYPERVISOR_PAGE_SIZE * (uint64_t)size;
+        total_size = HYPERVISOR_PAGE_SIZE * (uint64_t)size;
     }
 
-    page_pool->addr = platform_alloc(page_pool->size);
-    if (((void *)0) == page_pool->addr) {
-        BFERROR("platform_alloc failed\n");
-        goto platform_alloc_failed;
+    num_nodes = (uint64_t)platform_num_online_nodes();
+    if (((uint64_t)0) == num_nodes) {
+        num_nodes = ((uint64_t)1);
+    }
+
+    if (num_nodes > HYPERVISOR_MAX_NUMA_NODES) {
+        BFALERT(
+            "too many NUMA nodes, only using %u\n",
+            (uint32_t)HYPERVISOR_MAX_NUMA_NODES);
+        num_nodes = HYPERVISOR_MAX_NUMA_NODES;
+    }
+
+    node_size = total_size / num_nodes;
+    node_size -= node_size % HYPERVISOR_PAGE_SIZE;
+    if (((uint64_t)0) == node_size) {
+        node_size = HYPERVISOR_PAGE_SIZE;
+    }
+
+    for (node = ((uint64_t)0); node < num_nodes; ++node) {
+        if (alloc_mk_page_pool_node(
+                node_size, (uint32_t)node, &page_pool[node])) {
+            BFERROR("alloc_mk_page_pool_node failed\n");
+            goto alloc_mk_page_pool_node_failed;
+        }
+    }
+
+    num_cpus = (uint64_t)platform_num_online_cpus();
+    if (num_cpus > HYPERVISOR_MAX_PPS) {
+        num_cpus = HYPERVISOR_MAX_PPS;
+    }
+
+    for (cpu = ((uint64_t)0); cpu < num_cpus; ++cpu) {
+        node = (uint64_t)platform_cpu_to_node((uint32_t)cpu);
+        if (node >= num_nodes) {
+            node = ((uint64_t)0);
+        }
+
+        pp_to_node[cpu] = (uint8_t)node;
     }
 
     return LOADER_SUCCESS;
 
-platform_alloc_failed:
+alloc_mk_page_pool_node_failed:
 
-    platform_memset(page_pool, 0, sizeof(struct mutable_span_t));
+    free_mk_page_pool(page_pool);
+    platform_memset(pp_to_node, 0, HYPERVISOR_MAX_PPS);
     return LOADER_FAILURE;
 }
@@ -0,0 +1,52 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <constants.h>
+#include <debug.h>
+#include <page_pool_stats_t.h>
+#include <platform.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Allocates the page that the microkernel's page pool uses to
+ *     report how it is being used.
+ *
+ * <!-- inputs/outputs -->
+ *   @param stats where to store the newly allocated stats page
+ *   @return 0 on success, LOADER_FAILURE on failure.
+ */
+int64_t
+alloc_mk_page_pool_stats(struct page_pool_stats_t **const stats)
+{
+    *stats = (struct page_pool_stats_t *)platform_alloc(HYPERVISOR_PAGE_SIZE);
+    if (((void *)0) == *stats) {
+        BFERROR("platform_alloc failed\n");
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
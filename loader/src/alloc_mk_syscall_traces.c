@@ -0,0 +1,55 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <constants.h>
+#include <debug.h>
+#include <platform.h>
+#include <types.h>
+#include <syscall_trace_t.h>
+
+/**
+ * <!-- description -->
+ *   @brief Allocates the syscall traces that the microkernel records the
+ *     syscalls of each PP into, one for each online PP.
+ *
+ * <!-- inputs/outputs -->
+ *   @param traces where to store the newly allocated syscall traces
+ *   @return 0 on success, LOADER_FAILURE on failure.
+ */
+int64_t
+alloc_mk_syscall_traces(struct syscall_trace_t **const traces)
+{
+    uint64_t const size =
+        ((uint64_t)platform_num_online_cpus()) * sizeof(struct syscall_trace_t);
+
+    *traces = (struct syscall_trace_t *)platform_alloc(size);
+    if (((void *)0) == *traces) {
+        BFERROR("platform_alloc failed\n");
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
@@ -63,8 +63,22 @@ dump_mk_args(struct mk_args_t *const args, uint32_t const cpu)
 
     BFINFO(" - rpt: 0x%016" PRIx64 "\n", (uint64_t)args->rpt);
     BFINFO(" - rpt_phys: 0x%016" PRIx64 "\n", args->rpt_phys);
-    BFINFO(" - page_pool.addr: 0x%016" PRIx64 "\n", (uint64_t)args->page_pool.addr);
-    BFINFO(" - page_pool.size: 0x%016" PRIx64 "\n", args->page_pool.size);
+
+    for (idx = ((uint64_t)0); idx < HYPERVISOR_MAX_NUMA_NODES; ++idx) {
+        if (((void *)0) != args->page_pool[idx].addr) {
+            BFINFO(" - page_pool[%" PRIu64 "].addr: 0x%016" PRIx64 "\n",
+                idx, (uint64_t)args->page_pool[idx].addr);
+            BFINFO(" - page_pool[%" PRIu64 "].size: 0x%016" PRIx64 "\n",
+                idx, args->page_pool[idx].size);
+        }
+    }
+
+    BFINFO(" - page_pool_donations: 0x%016" PRIx64 "\n", (uint64_t)args->page_pool_donations);
+    BFINFO(" - page_pool_stats: 0x%016" PRIx64 "\n", (uint64_t)args->page_pool_stats);
+    BFINFO(" - vmexit_log: 0x%016" PRIx64 "\n", (uint64_t)args->vmexit_log);
+    BFINFO(" - vmexit_stats: 0x%016" PRIx64 "\n", (uint64_t)args->vmexit_stats);
+    BFINFO(" - syscall_trace: 0x%016" PRIx64 "\n", (uint64_t)args->syscall_trace);
+    BFINFO(" - pp_to_node[%u]: %u\n", cpu, (uint32_t)args->pp_to_node[cpu]);
     BFINFO(" - huge_pool.addr: 0x%016" PRIx64 "\n", (uint64_t)args->huge_pool.addr);
     BFINFO(" - huge_pool.size: 0x%016" PRIx64 "\n", args->huge_pool.size);
 }
@@ -24,25 +24,29 @@
  * SOFTWARE.
  */
 
+#include <constants.h>
 #include <debug.h>
 #include <debug_ring_t.h>
+#include <platform.h>
 #include <types.h>
 
 /**
  * <!-- description -->
- *   @brief Outputs information about the mk debug ring. Note that this does
- *     not actually output the debug ring itself, but information about it.
+ *   @brief Outputs information about the mk debug rings. Note that this does
+ *     not actually output the debug rings themselves, but information about
+ *     them.
  *
  * <!-- inputs/outputs -->
- *   @param debug_ring the mk debug ring to output information about
+ *   @param debug_ring the mk debug rings to output information about
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
 void
 dump_mk_debug_ring(struct debug_ring_t *const debug_ring)
 {
-    BFINFO("mk debug ring:\n");
+    uint64_t const num = ((uint64_t)platform_num_online_cpus());
+
+    BFINFO("mk debug rings:\n");
     BFINFO(" - addr: 0x%016" PRIx64 "\n", (uint64_t)debug_ring);
     BFINFO(" - size: 0x%016" PRIx64 "\n", HYPERVISOR_DEBUG_RING_SIZE);
-    BFINFO(" - epos: 0x%016" PRIx64 "\n", debug_ring->epos);
-    BFINFO(" - spos: 0x%016" PRIx64 "\n", debug_ring->spos);
+    BFINFO(" - num:  0x%016" PRIx64 "\n", num);
 }
@@ -24,8 +24,9 @@
  * SOFTWARE.
  */
 
+#include <constants.h>
 #include <debug.h>
-#include <mutable_span_t.h>
+#include <page_pool_node_t.h>
 #include <types.h>
 
 /**
@@ -33,13 +34,30 @@
  *   @brief Outputs the contents of a provided mk page pool.
  *
  * <!-- inputs/outputs -->
- *   @param page_pool the mk page pool to output
+ *   @param page_pool the mk page pool (one per node) to output
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
 void
-dump_mk_page_pool(struct mutable_span_t *const page_pool)
+dump_mk_page_pool(struct page_pool_node_t *const page_pool)
 {
-    BFINFO("mk page pool:\n");
-    BFINFO(" - addr: 0x%016" PRIx64 "\n", (uint64_t)page_pool->addr);
-    BFINFO(" - size: 0x%016" PRIx64 "\n", page_pool->size);
+    uint64_t idx;
+    uint64_t jdx;
+
+    for (idx = ((uint64_t)0); idx < HYPERVISOR_MAX_NUMA_NODES; ++idx) {
+        struct page_pool_node_t const *const node = &page_pool[idx];
+        uint64_t contiguous = ((uint64_t)0);
+
+        if (((uint64_t)0) == node->num_chunks) {
+            continue;
+        }
+
+        for (jdx = ((uint64_t)0); jdx < node->num_chunks; ++jdx) {
+            contiguous += node->chunks[jdx].contiguous;
+        }
+
+        BFINFO("mk page pool (node #%u):\n", (uint32_t)idx);
+        BFINFO(" - size: 0x%016" PRIx64 "\n", node->size);
+        BFINFO(" - chunks: %" PRIu64 "\n", node->num_chunks);
+        BFINFO(" - contiguous chunks: %" PRIu64 "\n", contiguous);
+    }
 }
@@ -47,14 +47,20 @@ verify_dump_vmm_args(struct dump_vmm_args_t const *const args)
         return LOADER_FAILURE;
     }
 
+    if (args->ppid >= ((uint64_t)platform_num_online_cpus())) {
+        BFERROR("invalid ppid: 0x%" PRIx64 "\n", args->ppid);
+        return LOADER_FAILURE;
+    }
+
     return LOADER_SUCCESS;
 }
 
 /**
  * <!-- description -->
  *   @brief This function contains all of the code that is common between
- *     all archiectures and all platforms for dumping the VMM. This function
- *     will call platform and architecture specific functions as needed.
+ *     all archiectures and all platforms for dumping the debug ring of one
+ *     of the VMM's PPs. This function will call platform and architecture
+ *     specific functions as needed.
  *
  * <!-- inputs/outputs -->
  *   @param ioctl_args arguments from the ioctl
@@ -89,13 +95,24 @@ dump_vmm(struct dump_vmm_args_t *const ioctl_args)
         goto verify_dump_vmm_args_failed;
     }
 
+    /**
+     * NOTE: The PP keeps writing to its debug ring while it is copied, so
+     * the record that it is in the middle of writing can come out torn.
+     * Only the owning PP writes to a debug ring, so there is nothing to
+     * lock, and vmmctl skips over anything it cannot parse.
+     */
+
     ret = platform_memcpy(
-        &args->debug_ring, g_mk_debug_ring, sizeof(struct debug_ring_t));
+        &args->debug_ring,
+        &g_mk_debug_ring[args->ppid],
+        sizeof(struct debug_ring_t));
     if (ret) {
         BFERROR("platform_memcpy failed\n");
         goto platform_memcpy_failed;
     }
 
+    args->num_pps = ((uint64_t)platform_num_online_cpus());
+
     if (platform_copy_to_user(ioctl_args, args, sizeof(args_t))) {
         BFERROR("platform_copy_to_user failed\n");
         goto platform_copy_to_user_failed;
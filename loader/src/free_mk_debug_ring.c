@@ -24,20 +24,24 @@
  * SOFTWARE.
  */
 
+#include <constants.h>
 #include <debug_ring_t.h>
 #include <platform.h>
 
 /**
  * <!-- description -->
- *   @brief Releases a previously allocated debug_ring_t that was allocated
- *     using the alloc_mk_debug_ring function.
+ *   @brief Releases the debug rings that were previously allocated using
+ *     the alloc_mk_debug_ring function.
  *
  * <!-- inputs/outputs -->
- *   @param debug_ring the debug_ring_t to free.
+ *   @param debug_ring the debug rings to free.
  */
 void
 free_mk_debug_ring(struct debug_ring_t **const debug_ring)
 {
-    platform_free(*debug_ring, HYPERVISOR_DEBUG_RING_SIZE);
+    uint64_t const size =
+        ((uint64_t)platform_num_online_cpus()) * sizeof(struct debug_ring_t);
+
+    platform_free(*debug_ring, size);
     *debug_ring = ((void *)0);
 }
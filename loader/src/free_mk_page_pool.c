@@ -24,21 +24,40 @@
  * SOFTWARE.
  */
 
-#include <mutable_span_t.h>
+#include <constants.h>
+#include <page_pool_node_t.h>
 #include <platform.h>
 #include <types.h>
 
 /**
  * <!-- description -->
- *   @brief Releases a previously allocated mutable_span_t that was allocated
+ *   @brief Releases a previously allocated page pool that was allocated
  *     using the alloc_mk_page_pool function.
  *
  * <!-- inputs/outputs -->
- *   @param page_pool the mutable_span_t to free.
+ *   @param page_pool the array of page_pool_node_t (one per node) to free.
  */
 void
-free_mk_page_pool(struct mutable_span_t *const page_pool)
+free_mk_page_pool(struct page_pool_node_t *const page_pool)
 {
-    platform_free(page_pool->addr, page_pool->size);
-    platform_memset(page_pool, 0, sizeof(struct mutable_span_t));
+    uint64_t idx;
+    uint64_t jdx;
+
+    for (idx = ((uint64_t)0); idx < HYPERVISOR_MAX_NUMA_NODES; ++idx) {
+        struct page_pool_node_t *const node = &page_pool[idx];
+
+        for (jdx = ((uint64_t)0); jdx < node->num_chunks; ++jdx) {
+            struct page_pool_chunk_t *const chunk = &node->chunks[jdx];
+            if (((uint64_t)0) != chunk->contiguous) {
+                platform_free_contiguous(chunk->addr, chunk->size);
+            }
+            else {
+                platform_free(chunk->addr, chunk->size);
+            }
+        }
+
+        platform_free(
+            node->chunks, node->num_chunks * sizeof(struct page_pool_chunk_t));
+        platform_memset(node, 0, sizeof(struct page_pool_node_t));
+    }
 }
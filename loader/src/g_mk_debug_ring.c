@@ -26,5 +26,5 @@
 
 #include <debug_ring_t.h>
 
-/** @brief stores the microkernel's debug ring */
+/** @brief stores the microkernel's debug rings (one for each PP) */
 struct debug_ring_t *g_mk_debug_ring = ((void *)0);
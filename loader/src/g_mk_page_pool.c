@@ -25,11 +25,14 @@
  */
 
 #include <constants.h>
-#include <mutable_span_t.h>
+#include <page_pool_node_t.h>
 #include <types.h>
 
-/** @brief stores the page pool used by the microkernel */
-struct mutable_span_t g_mk_page_pool = {0};
+/** @brief stores the page pool used by the microkernel (one per NUMA node) */
+struct page_pool_node_t g_mk_page_pool[HYPERVISOR_MAX_NUMA_NODES] = {0};
+
+/** @brief stores the NUMA node (i.e., page pool) that each PP belongs to */
+uint8_t g_mk_pp_to_node[HYPERVISOR_MAX_PPS] = {0};
 
 /** @brief stores the virtual address of the MK's page pool */
 uint64_t g_mk_page_pool_base_virt = HYPERVISOR_DIRECT_MAP_ADDR;
@@ -27,8 +27,16 @@
 #include <debug.h>
 #include <free_mk_code_aliases.h>
 #include <free_mk_debug_ring.h>
+#include <free_mk_page_pool_stats.h>
+#include <free_mk_syscall_traces.h>
+#include <free_mk_vmexit_logs.h>
+#include <free_mk_vmexit_stats.h>
 #include <g_mk_code_aliases.h>
 #include <g_mk_debug_ring.h>
+#include <g_mk_page_pool_stats.h>
+#include <g_mk_syscall_traces.h>
+#include <g_mk_vmexit_logs.h>
+#include <g_mk_vmexit_stats.h>
 #include <platform.h>
 #include <types.h>
 #include <vmm_status.h>
@@ -52,6 +60,10 @@ loader_fini(void)
     }
 
     free_mk_code_aliases(&g_mk_code_aliases);
+    free_mk_syscall_traces(&g_mk_syscall_traces);
+    free_mk_vmexit_stats(&g_mk_vmexit_stats);
+    free_mk_vmexit_logs(&g_mk_vmexit_logs);
+    free_mk_page_pool_stats(&g_mk_page_pool_stats);
     free_mk_debug_ring(&g_mk_debug_ring);
 
     return LOADER_SUCCESS;
@@ -28,14 +28,26 @@
 
 #include <alloc_and_copy_mk_code_aliases.h>
 #include <alloc_mk_debug_ring.h>
+#include <alloc_mk_page_pool_stats.h>
+#include <alloc_mk_syscall_traces.h>
+#include <alloc_mk_vmexit_logs.h>
+#include <alloc_mk_vmexit_stats.h>
 #include <check_for_hve_support.h>
 #include <debug.h>
 #include <dump_mk_code_aliases.h>
 #include <dump_mk_debug_ring.h>
 #include <free_mk_code_aliases.h>
 #include <free_mk_debug_ring.h>
+#include <free_mk_page_pool_stats.h>
+#include <free_mk_syscall_traces.h>
+#include <free_mk_vmexit_logs.h>
+#include <free_mk_vmexit_stats.h>
 #include <g_mk_code_aliases.h>
 #include <g_mk_debug_ring.h>
+#include <g_mk_page_pool_stats.h>
+#include <g_mk_syscall_traces.h>
+#include <g_mk_vmexit_logs.h>
+#include <g_mk_vmexit_stats.h>
 #include <platform.h>
 #include <serial_init.h>
 #include <types.h>
@@ -59,6 +71,7 @@ loader_init(void)
         return LOADER_FAILURE;
     }
 
+    platform_mutex_init();
     serial_init();
 
     if (check_for_hve_support()) {
@@ -71,6 +84,26 @@ loader_init(void)
         goto alloc_mk_debug_ring_failed;
     }
 
+    if (alloc_mk_page_pool_stats(&g_mk_page_pool_stats)) {
+        BFERROR("alloc_mk_page_pool_stats failed\n");
+        goto alloc_mk_page_pool_stats_failed;
+    }
+
+    if (alloc_mk_vmexit_logs(&g_mk_vmexit_logs)) {
+        BFERROR("alloc_mk_vmexit_logs failed\n");
+        goto alloc_mk_vmexit_logs_failed;
+    }
+
+    if (alloc_mk_vmexit_stats(&g_mk_vmexit_stats)) {
+        BFERROR("alloc_mk_vmexit_stats failed\n");
+        goto alloc_mk_vmexit_stats_failed;
+    }
+
+    if (alloc_mk_syscall_traces(&g_mk_syscall_traces)) {
+        BFERROR("alloc_mk_syscall_traces failed\n");
+        goto alloc_mk_syscall_traces_failed;
+    }
+
     if (alloc_and_copy_mk_code_aliases(&g_mk_code_aliases)) {
         BFERROR("alloc_and_copy_mk_code_aliases failed\n");
         goto alloc_and_copy_mk_code_aliases_failed;
@@ -84,6 +117,14 @@ loader_init(void)
     return LOADER_SUCCESS;
 
 alloc_and_copy_mk_code_aliases_failed:
+    free_mk_syscall_traces(&g_mk_syscall_traces);
+alloc_mk_syscall_traces_failed:
+    free_mk_vmexit_stats(&g_mk_vmexit_stats);
+alloc_mk_vmexit_stats_failed:
+    free_mk_vmexit_logs(&g_mk_vmexit_logs);
+alloc_mk_vmexit_logs_failed:
+    free_mk_page_pool_stats(&g_mk_page_pool_stats);
+alloc_mk_page_pool_stats_failed:
     free_mk_debug_ring(&g_mk_debug_ring);
 alloc_mk_debug_ring_failed:
 
@@ -31,6 +31,7 @@
 #include <alloc_and_copy_mk_elf_segments.h>
 #include <alloc_mk_huge_pool.h>
 #include <alloc_mk_page_pool.h>
+#include <alloc_mk_page_pool_donations.h>
 #include <alloc_mk_root_page_table.h>
 #include <constants.h>
 #include <debug.h>
@@ -45,6 +46,7 @@
 #include <free_mk_elf_segments.h>
 #include <free_mk_huge_pool.h>
 #include <free_mk_page_pool.h>
+#include <free_mk_page_pool_donations.h>
 #include <free_mk_root_page_table.h>
 #include <g_ext_elf_files.h>
 #include <g_mk_code_aliases.h>
@@ -53,7 +55,12 @@
 #include <g_mk_elf_segments.h>
 #include <g_mk_huge_pool.h>
 #include <g_mk_page_pool.h>
+#include <g_mk_page_pool_donations.h>
+#include <g_mk_page_pool_stats.h>
 #include <g_mk_root_page_table.h>
+#include <g_mk_syscall_traces.h>
+#include <g_mk_vmexit_logs.h>
+#include <g_mk_vmexit_stats.h>
 #include <map_ext_elf_files.h>
 #include <map_mk_code_aliases.h>
 #include <map_mk_debug_ring.h>
@@ -61,6 +68,11 @@
 #include <map_mk_elf_segments.h>
 #include <map_mk_huge_pool.h>
 #include <map_mk_page_pool.h>
+#include <map_mk_page_pool_donations.h>
+#include <map_mk_page_pool_stats.h>
+#include <map_mk_syscall_traces.h>
+#include <map_mk_vmexit_logs.h>
+#include <map_mk_vmexit_stats.h>
 #include <platform.h>
 #include <start_vmm_args_t.h>
 #include <start_vmm_per_cpu.h>
@@ -81,8 +93,26 @@ alloc_and_start_the_vmm(struct start_vmm_args_t const *const args)
         return LOADER_FAILURE;
     }
 
-    g_mk_debug_ring->epos = ((uint64_t)0);
-    g_mk_debug_ring->spos = ((uint64_t)0);
+    platform_memset(
+        g_mk_debug_ring,
+        0,
+        ((uint64_t)platform_num_online_cpus()) * sizeof(struct debug_ring_t));
+
+    platform_memset(g_mk_page_pool_stats, 0, sizeof(struct page_pool_stats_t));
+    platform_memset(
+        g_mk_vmexit_logs,
+        0,
+        ((uint64_t)platform_num_online_cpus()) * sizeof(struct vmexit_log_t));
+    platform_memset(
+        g_mk_vmexit_stats,
+        0,
+        ((uint64_t)platform_num_online_cpus()) *
+            sizeof(struct vmexit_stats_t));
+    platform_memset(
+        g_mk_syscall_traces,
+        0,
+        ((uint64_t)platform_num_online_cpus()) *
+            sizeof(struct syscall_trace_t));
 
     if (alloc_mk_root_page_table(&g_mk_root_page_table)) {
         BFERROR("alloc_and_copy_mk_root_page_table failed\n");
@@ -106,11 +136,17 @@ alloc_and_start_the_vmm(struct start_vmm_args_t const *const args)
         goto alloc_and_copy_mk_elf_segments_failed;
     }
 
-    if (alloc_mk_page_pool(args->page_pool_size, &g_mk_page_pool)) {
+    if (alloc_mk_page_pool(
+            args->page_pool_size, g_mk_page_pool, g_mk_pp_to_node)) {
         BFERROR("alloc_mk_page_pool failed\n");
         goto alloc_mk_page_pool_failed;
     }
 
+    if (alloc_mk_page_pool_donations(&g_mk_page_pool_donations)) {
+        BFERROR("alloc_mk_page_pool_donations failed\n");
+        goto alloc_mk_page_pool_donations_failed;
+    }
+
     if (alloc_mk_huge_pool(0U, &g_mk_huge_pool)) {
         BFERROR("alloc_mk_huge_pool failed\n");
         goto alloc_mk_huge_pool_failed;
@@ -142,11 +178,37 @@ alloc_and_start_the_vmm(struct start_vmm_args_t const *const args)
     }
 
     if (map_mk_page_pool(
-            &g_mk_page_pool, g_mk_page_pool_base_virt, g_mk_root_page_table)) {
+            g_mk_page_pool, g_mk_page_pool_base_virt, g_mk_root_page_table)) {
         BFERROR("map_mk_page_pool failed\n");
         goto map_mk_page_pool_failed;
     }
 
+    if (map_mk_page_pool_donations(
+            g_mk_page_pool_donations, g_mk_root_page_table)) {
+        BFERROR("map_mk_page_pool_donations failed\n");
+        goto map_mk_page_pool_donations_failed;
+    }
+
+    if (map_mk_page_pool_stats(g_mk_page_pool_stats, g_mk_root_page_table)) {
+        BFERROR("map_mk_page_pool_stats failed\n");
+        goto map_mk_page_pool_stats_failed;
+    }
+
+    if (map_mk_vmexit_logs(g_mk_vmexit_logs, g_mk_root_page_table)) {
+        BFERROR("map_mk_vmexit_logs failed\n");
+        goto map_mk_vmexit_logs_failed;
+    }
+
+    if (map_mk_vmexit_stats(g_mk_vmexit_stats, g_mk_root_page_table)) {
+        BFERROR("map_mk_vmexit_stats failed\n");
+        goto map_mk_vmexit_stats_failed;
+    }
+
+    if (map_mk_syscall_traces(g_mk_syscall_traces, g_mk_root_page_table)) {
+        BFERROR("map_mk_syscall_traces failed\n");
+        goto map_mk_syscall_traces_failed;
+    }
+
     if (map_mk_huge_pool(
             &g_mk_huge_pool, g_mk_huge_pool_base_virt, g_mk_root_page_table)) {
         BFERROR("map_mk_huge_pool failed\n");
@@ -158,7 +220,7 @@ alloc_and_start_the_vmm(struct start_vmm_args_t const *const args)
     dump_mk_elf_file(&g_mk_elf_file);
     dump_ext_elf_files(g_ext_elf_files);
     dump_mk_elf_segments(g_mk_elf_segments);
-    dump_mk_page_pool(&g_mk_page_pool);
+    dump_mk_page_pool(g_mk_page_pool);
     dump_mk_huge_pool(&g_mk_huge_pool);
 #endif
 
@@ -177,6 +239,11 @@ start_vmm_per_cpu_failed:
     }
 
 map_mk_huge_pool_failed:
+map_mk_syscall_traces_failed:
+map_mk_vmexit_stats_failed:
+map_mk_vmexit_logs_failed:
+map_mk_page_pool_stats_failed:
+map_mk_page_pool_donations_failed:
 map_mk_page_pool_failed:
 map_mk_elf_segments_failed:
 map_ext_elf_files_failed:
@@ -186,7 +253,10 @@ map_mk_debug_ring_failed:
 
     free_mk_huge_pool(&g_mk_huge_pool);
 alloc_mk_huge_pool_failed:
-    free_mk_page_pool(&g_mk_page_pool);
+    free_mk_page_pool_donations(
+        &g_mk_page_pool_donations, g_mk_donated_pages);
+alloc_mk_page_pool_donations_failed:
+    free_mk_page_pool(g_mk_page_pool);
 alloc_mk_page_pool_failed:
     free_mk_elf_segments(g_mk_elf_segments);
 alloc_and_copy_mk_elf_segments_failed:
@@ -295,7 +365,11 @@ start_vmm(struct start_vmm_args_t const *const ioctl_args)
         return LOADER_FAILURE;
     }
 
-    if (alloc_and_start_the_vmm(&args)) {
+    platform_mutex_lock();
+    ret = alloc_and_start_the_vmm(&args);
+    platform_mutex_unlock();
+
+    if (ret) {
         BFERROR("alloc_and_start_the_vmm failed\n");
         return LOADER_FAILURE;
     }
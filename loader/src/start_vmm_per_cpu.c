@@ -47,9 +47,14 @@
 #include <g_mk_elf_file.h>
 #include <g_mk_huge_pool.h>
 #include <g_mk_page_pool.h>
+#include <g_mk_page_pool_donations.h>
+#include <g_mk_page_pool_stats.h>
 #include <g_mk_root_page_table.h>
 #include <g_mk_stack.h>
 #include <g_mk_state.h>
+#include <g_mk_syscall_traces.h>
+#include <g_mk_vmexit_logs.h>
+#include <g_mk_vmexit_stats.h>
 #include <g_root_vp_state.h>
 #include <get_mk_huge_pool_addr.h>
 #include <get_mk_page_pool_addr.h>
@@ -140,7 +145,7 @@ start_vmm_per_cpu(uint32_t const cpu)
     g_mk_args[cpu]->online_pps = ((uint16_t)platform_num_online_cpus());
     g_mk_args[cpu]->mk_state = g_mk_state[cpu];
     g_mk_args[cpu]->root_vp_state = g_root_vp_state[cpu];
-    g_mk_args[cpu]->debug_ring = g_mk_debug_ring;
+    g_mk_args[cpu]->debug_ring = &g_mk_debug_ring[cpu];
 
     g_mk_args[cpu]->mk_elf_file = g_mk_elf_file;
     for (idx = ((uint64_t)0); idx < HYPERVISOR_MAX_EXTENSIONS; ++idx) {
@@ -150,16 +155,28 @@ start_vmm_per_cpu(uint32_t const cpu)
     g_mk_args[cpu]->rpt = g_mk_root_page_table;
     g_mk_args[cpu]->rpt_phys = platform_virt_to_phys(g_mk_root_page_table);
 
-    ret =
-        get_mk_page_pool_addr(&g_mk_page_pool, g_mk_page_pool_base_virt, &addr);
-    if (ret) {
-        BFERROR("get_mk_page_pool_addr failed\n");
-        goto get_mk_page_pool_addr_failed;
+    for (idx = ((uint64_t)0); idx < HYPERVISOR_MAX_NUMA_NODES; ++idx) {
+        if (((uint64_t)0) == g_mk_page_pool[idx].num_chunks) {
+            continue;
+        }
+
+        ret = get_mk_page_pool_addr(
+            &g_mk_page_pool[idx], g_mk_page_pool_base_virt, &addr);
+        if (ret) {
+            BFERROR("get_mk_page_pool_addr failed\n");
+            goto get_mk_page_pool_addr_failed;
+        }
+
+        g_mk_args[cpu]->page_pool[idx].addr = addr;
+        g_mk_args[cpu]->page_pool[idx].size = g_mk_page_pool[idx].size;
     }
 
-    g_mk_args[cpu]->page_pool.addr = addr;
-    g_mk_args[cpu]->page_pool.size = g_mk_page_pool.size;
     g_mk_args[cpu]->page_pool_base_virt = g_mk_page_pool_base_virt;
+    g_mk_args[cpu]->page_pool_donations = g_mk_page_pool_donations;
+    g_mk_args[cpu]->page_pool_stats = g_mk_page_pool_stats;
+    g_mk_args[cpu]->vmexit_log = &g_mk_vmexit_logs[cpu];
+    g_mk_args[cpu]->vmexit_stats = &g_mk_vmexit_stats[cpu];
+    g_mk_args[cpu]->syscall_trace = &g_mk_syscall_traces[cpu];
 
     ret =
         get_mk_huge_pool_addr(&g_mk_huge_pool, g_mk_huge_pool_base_virt, &addr);
@@ -172,6 +189,10 @@ start_vmm_per_cpu(uint32_t const cpu)
     g_mk_args[cpu]->huge_pool.size = g_mk_huge_pool.size;
     g_mk_args[cpu]->huge_pool_base_virt = g_mk_huge_pool_base_virt;
 
+    for (idx = ((uint64_t)0); idx < HYPERVISOR_MAX_PPS; ++idx) {
+        g_mk_args[cpu]->pp_to_node[idx] = g_mk_pp_to_node[idx];
+    }
+
 #ifdef DEBUG_LOADER
     dump_mk_stack(&g_mk_stack[cpu], cpu);
     dump_mk_state(g_mk_state[cpu], cpu);
@@ -30,12 +30,14 @@
 #include <free_mk_elf_segments.h>
 #include <free_mk_huge_pool.h>
 #include <free_mk_page_pool.h>
+#include <free_mk_page_pool_donations.h>
 #include <free_mk_root_page_table.h>
 #include <g_ext_elf_files.h>
 #include <g_mk_elf_file.h>
 #include <g_mk_elf_segments.h>
 #include <g_mk_huge_pool.h>
 #include <g_mk_page_pool.h>
+#include <g_mk_page_pool_donations.h>
 #include <g_mk_root_page_table.h>
 #include <platform.h>
 #include <stop_vmm_per_cpu.h>
@@ -68,7 +70,9 @@ stop_and_free_the_vmm(void)
     }
 
     free_mk_huge_pool(&g_mk_huge_pool);
-    free_mk_page_pool(&g_mk_page_pool);
+    free_mk_page_pool_donations(
+        &g_mk_page_pool_donations, g_mk_donated_pages);
+    free_mk_page_pool(g_mk_page_pool);
     free_mk_elf_segments(g_mk_elf_segments);
     free_ext_elf_files(g_ext_elf_files);
     free_mk_elf_file(&g_mk_elf_file);
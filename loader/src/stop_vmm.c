@@ -83,6 +83,9 @@ stop_vmm(struct stop_vmm_args_t const *const ioctl_args)
         return LOADER_FAILURE;
     }
 
+    platform_mutex_lock();
     stop_and_free_the_vmm();
+    platform_mutex_unlock();
+
     return LOADER_SUCCESS;
 }
@@ -25,7 +25,7 @@
  */
 
 #include <debug.h>
-#include <mutable_span_t.h>
+#include <page_pool_node_t.h>
 #include <platform.h>
 
 /**
@@ -33,7 +33,8 @@
  *   @brief This function gets the addr of the microkernel's page pool
  *
  * <!-- inputs/outputs -->
- *   @param page_pool a pointer to a mutable_span_t that stores the page pool
+ *   @param page_pool a pointer to a page_pool_node_t that stores the
+ *     node's page pool
  *   @param base_virt provide the base virtual address that the page pool
  *     was mapped to.
  *   @param addr where to store the resulting addr of the page pool
@@ -41,11 +42,12 @@
  */
 int64_t
 get_mk_page_pool_addr(
-    struct mutable_span_t const *const page_pool,
+    struct page_pool_node_t const *const page_pool,
     uint64_t const base_virt,
     uint8_t **const addr)
 {
-    uint64_t phys = platform_virt_to_phys(page_pool->addr);
+    uint64_t const phys =
+        platform_virt_to_phys(page_pool->chunks[((uint64_t)0)].addr);
     if (((uint64_t)0) == phys) {
         BFERROR("platform_virt_to_phys failed\n");
         return LOADER_FAILURE;
@@ -33,13 +33,12 @@
 
 /**
  * <!-- description -->
- *   @brief This function maps the microkernel's debug_ring into the
+ *   @brief This function maps the debug ring of each PP into the
  *     microkernel's root page tables.
  *
  * <!-- inputs/outputs -->
- *   @param debug_ring a pointer to a debug_ring_t that stores the debug_ring
- *     being mapped
- *   @param pml4t the root page table to map the debug_ring into
+ *   @param debug_ring a pointer to the debug_ring_t array being mapped
+ *   @param pml4t the root page table to map the debug rings into
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
 int64_t
@@ -47,8 +46,10 @@ map_mk_debug_ring(
     struct debug_ring_t const *const debug_ring, struct pml4t_t *const pml4t)
 {
     uint64_t off = ((uint64_t)0);
+    uint64_t const size =
+        ((uint64_t)platform_num_online_cpus()) * sizeof(struct debug_ring_t);
 
-    for (; off < HYPERVISOR_DEBUG_RING_SIZE; off += HYPERVISOR_PAGE_SIZE) {
+    for (; off < size; off += HYPERVISOR_PAGE_SIZE) {
         if (map_4k_page_rw(
                 ((uint8_t *)debug_ring) + off, ((uint64_t)0), pml4t)) {
             BFERROR("map_4k_page_rw failed\n");
@@ -26,49 +26,104 @@
 
 #include <constants.h>
 #include <debug.h>
+#include <map_2m_page_rw.h>
 #include <map_4k_page_rw.h>
-#include <mutable_span_t.h>
+#include <page_pool_node_t.h>
+#include <page_pool_run_t.h>
 #include <platform.h>
 #include <pml4t_t.h>
 
 /**
  * <!-- description -->
- *   @brief This function maps the microkernel's page pool into the
- *     microkernel's root page tables.
+ *   @brief Adds a physically contiguous set of pages to the current run
+ *     of the page pool being mapped. If the pages do not directly follow
+ *     the current run, a new run is started, and the current run is
+ *     linked to the new run.
  *
- *   @note Unlike other map functions, this function needs to set up the
- *     direct map. This is because the only part of the direct map the
- *     microkernel needs is the page pool. What this means is each page
- *     is mapped to the direct map base address (virt), with the
- *     physical address added (i.e., to get the physical address of a
- *     page from the page pool, just take it's virtual address and
- *     subtract virt). Then, the first 64 bits of the page store the
- *     address of the next page in the page pool (using the direct map
- *     address). This way, all we need to do is pass virt to the
- *     microkernel, and it will have the HEAD of a linked list of pages
- *     that can be used as a page pool.
+ * <!-- inputs/outputs -->
+ *   @param pages the address (not the direct map address) of the pages
+ *   @param phys the physical address of the pages
+ *   @param size the total number of bytes in the pages
+ *   @param base_virt provide the base virtual address that the page pool
+ *     should be mapped to.
+ *   @param run the current run (updated if a new run is started)
+ *   @param run_end the physical address of the end of the current run
+ */
+static void
+add_to_mk_page_pool_run(
+    uint8_t *const pages,
+    uint64_t const phys,
+    uint64_t const size,
+    uint64_t const base_virt,
+    struct page_pool_run_t **const run,
+    uint64_t *const run_end)
+{
+    if ((((void *)0) != *run) && (phys == *run_end)) {
+        (*run)->size += size;
+    }
+    else {
+        if (((void *)0) != *run) {
+            (*run)->next = (uint8_t *)(base_virt + phys);
+        }
+
+        *run = (struct page_pool_run_t *)pages;
+        (*run)->size = size;
+    }
+
+    *run_end = phys + size;
+}
+
+/**
+ * <!-- description -->
+ *   @brief This function maps a single chunk of the microkernel's page
+ *     pool into the microkernel's root page tables and adds the chunk's
+ *     pages to the node's runs. See map_mk_page_pool for more details.
  *
  * <!-- inputs/outputs -->
- *   @param page_pool a pointer to a mutable_span_t that stores the page pool
- *     being mapped
+ *   @param chunk a pointer to the page_pool_chunk_t being mapped
  *   @param base_virt provide the base virtual address that the page pool
  *     should be mapped to.
  *   @param pml4t the root page table to map the page pool into
+ *   @param run the current run (updated if a new run is started)
+ *   @param run_end the physical address of the end of the current run
  *   @return 0 on success, LOADER_FAILURE on failure.
  */
-int64_t
-map_mk_page_pool(
-    struct mutable_span_t const *const page_pool,
+static int64_t
+map_mk_page_pool_chunk(
+    struct page_pool_chunk_t const *const chunk,
     uint64_t const base_virt,
-    struct pml4t_t *const pml4t)
+    struct pml4t_t *const pml4t,
+    struct page_pool_run_t **const run,
+    uint64_t *const run_end)
 {
     uint64_t off;
-    uint64_t *prev = ((void *)0);
+    uint64_t phys;
+    uint64_t const mask = LOADER_2M_PAGE_SIZE - ((uint64_t)1);
 
-    for (off = ((uint64_t)0); off < page_pool->size;
-         off += HYPERVISOR_PAGE_SIZE) {
+    if (((uint64_t)0) != chunk->contiguous) {
+        phys = platform_virt_to_phys(chunk->addr);
+        if (((uint64_t)0) == phys) {
+            BFERROR("platform_virt_to_phys failed\n");
+            return LOADER_FAILURE;
+        }
 
-        uint64_t phys = platform_virt_to_phys(page_pool->addr + off);
+        if ((LOADER_2M_PAGE_SIZE == chunk->size) &&
+            (((uint64_t)0) == ((base_virt | phys) & mask))) {
+
+            if (map_2m_page_rw(base_virt + phys, phys, pml4t)) {
+                BFERROR("map_2m_page_rw failed\n");
+                return LOADER_FAILURE;
+            }
+
+            add_to_mk_page_pool_run(
+                chunk->addr, phys, chunk->size, base_virt, run, run_end);
+
+            return LOADER_SUCCESS;
+        }
+    }
+
+    for (off = ((uint64_t)0); off < chunk->size; off += HYPERVISOR_PAGE_SIZE) {
+        phys = platform_virt_to_phys(chunk->addr + off);
         if (((uint64_t)0) == phys) {
             BFERROR("platform_virt_to_phys failed\n");
             return LOADER_FAILURE;
@@ -79,11 +134,71 @@ map_mk_page_pool(
             return LOADER_FAILURE;
         }
 
-        if (((void *)0) != prev) {
-            prev[0] = base_virt + phys;
-        }
+        add_to_mk_page_pool_run(
+            chunk->addr + off,
+            phys,
+            HYPERVISOR_PAGE_SIZE,
+            base_virt,
+            run,
+            run_end);
+    }
 
-        prev = ((uint64_t *)(page_pool->addr + off));
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief This function maps the microkernel's page pool into the
+ *     microkernel's root page tables.
+ *
+ *   @note Unlike other map functions, this function needs to set up the
+ *     direct map. This is because the only part of the direct map the
+ *     microkernel needs is the page pool. What this means is each page
+ *     is mapped to the direct map base address (virt), with the
+ *     physical address added (i.e., to get the physical address of a
+ *     page from the page pool, just take it's virtual address and
+ *     subtract virt). Chunks that are physically contiguous and 2M
+ *     aligned are mapped using a single 2M page, everything else is
+ *     mapped using 4k pages. Then, the page pool is broken up into runs
+ *     of physically contiguous pages, and the first page of each run
+ *     stores a page_pool_run_t which holds the size of the run as well
+ *     as the address of the next run (using the direct map address).
+ *     This way, all we need to do is pass virt to the microkernel, and
+ *     it will have the HEAD of a linked list of runs that it can carve
+ *     pages out of as they are needed, without the loader having to
+ *     touch every page. Each NUMA node's portion of the page pool gets
+ *     its own linked list so that the microkernel can tell which node
+ *     a free page belongs to.
+ *
+ * <!-- inputs/outputs -->
+ *   @param page_pool the array of page_pool_node_t (one per node) that
+ *     stores the page pool being mapped
+ *   @param base_virt provide the base virtual address that the page pool
+ *     should be mapped to.
+ *   @param pml4t the root page table to map the page pool into
+ *   @return 0 on success, LOADER_FAILURE on failure.
+ */
+int64_t
+map_mk_page_pool(
+    struct page_pool_node_t const *const page_pool,
+    uint64_t const base_virt,
+    struct pml4t_t *const pml4t)
+{
+    uint64_t idx;
+    uint64_t jdx;
+
+    for (idx = ((uint64_t)0); idx < HYPERVISOR_MAX_NUMA_NODES; ++idx) {
+        struct page_pool_node_t const *const node = &page_pool[idx];
+        struct page_pool_run_t *run = ((void *)0);
+        uint64_t run_end = ((uint64_t)0);
+
+        for (jdx = ((uint64_t)0); jdx < node->num_chunks; ++jdx) {
+            if (map_mk_page_pool_chunk(
+                    &node->chunks[jdx], base_virt, pml4t, &run, &run_end)) {
+                BFERROR("map_mk_page_pool_chunk failed\n");
+                return LOADER_FAILURE;
+            }
+        }
     }
 
     return LOADER_SUCCESS;
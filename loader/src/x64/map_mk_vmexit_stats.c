@@ -0,0 +1,57 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <debug.h>
+#include <map_4k_page_rw.h>
+#include <platform.h>
+#include <pml4t_t.h>
+#include <vmexit_stats_t.h>
+
+/**
+ * <!-- description -->
+ *   @brief This function maps the VMExit stats of each PP into the
+ *     microkernel's root page tables.
+ *
+ * <!-- inputs/outputs -->
+ *   @param stats a pointer to the vmexit_stats_t array being mapped
+ *   @param pml4t the root page table to map the VMExit stats into
+ *   @return 0 on success, LOADER_FAILURE on failure.
+ */
+int64_t
+map_mk_vmexit_stats(
+    struct vmexit_stats_t const *const stats, struct pml4t_t *const pml4t)
+{
+    uint32_t cpu;
+
+    for (cpu = 0U; cpu < platform_num_online_cpus(); ++cpu) {
+        if (map_4k_page_rw(&stats[cpu], ((uint64_t)0), pml4t)) {
+            BFERROR("map_4k_page_rw failed\n");
+            return LOADER_FAILURE;
+        }
+    }
+
+    return LOADER_SUCCESS;
+}
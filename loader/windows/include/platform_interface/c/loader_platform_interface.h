@@ -41,9 +41,14 @@
 
 /* clang-format on */
 
+#include <add_pages_args_t.h>
 #include <dump_vmm_args_t.h>
+#include <mem_stats_args_t.h>
 #include <start_vmm_args_t.h>
+#include <stats_args_t.h>
 #include <stop_vmm_args_t.h>
+#include <syscall_trace_args_t.h>
+#include <vmexit_log_args_t.h>
 
 /** @brief defines the GUID name of the loader */
 DEFINE_GUID(
@@ -84,4 +89,44 @@ DEFINE_GUID(
         METHOD_BUFFERED,                                                       \
         FILE_READ_DATA | FILE_WRITE_DATA)
 
+/** @brief defines IOCTL for adding pages to a VMs page pool */
+#define LOADER_ADD_PAGES                                                       \
+    CTL_CODE(                                                                  \
+        FILE_DEVICE_UNKNOWN,                                                   \
+        LOADER_ADD_PAGES_CMD,                                                  \
+        METHOD_BUFFERED,                                                       \
+        FILE_READ_DATA)
+
+/** @brief defines IOCTL for reading a VMs memory stats */
+#define LOADER_MEM_STATS                                                       \
+    CTL_CODE(                                                                  \
+        FILE_DEVICE_UNKNOWN,                                                   \
+        LOADER_MEM_STATS_CMD,                                                  \
+        METHOD_BUFFERED,                                                       \
+        FILE_READ_DATA | FILE_WRITE_DATA)
+
+/** @brief defines IOCTL for reading a PP's VMExit log */
+#define LOADER_VMEXIT_LOG                                                      \
+    CTL_CODE(                                                                  \
+        FILE_DEVICE_UNKNOWN,                                                   \
+        LOADER_VMEXIT_LOG_CMD,                                                 \
+        METHOD_BUFFERED,                                                       \
+        FILE_READ_DATA | FILE_WRITE_DATA)
+
+/** @brief defines IOCTL for reading a PP's VMExit stats */
+#define LOADER_STATS                                                           \
+    CTL_CODE(                                                                  \
+        FILE_DEVICE_UNKNOWN,                                                   \
+        LOADER_STATS_CMD,                                                      \
+        METHOD_BUFFERED,                                                       \
+        FILE_READ_DATA | FILE_WRITE_DATA)
+
+/** @brief defines IOCTL for draining a PP's syscall trace */
+#define LOADER_SYSCALL_TRACE                                                   \
+    CTL_CODE(                                                                  \
+        FILE_DEVICE_UNKNOWN,                                                   \
+        LOADER_SYSCALL_TRACE_CMD,                                              \
+        METHOD_BUFFERED,                                                       \
+        FILE_READ_DATA | FILE_WRITE_DATA)
+
 #endif
@@ -45,9 +45,14 @@
 
 // clang-format on
 
+#include <add_pages_args_t.hpp>
 #include <dump_vmm_args_t.hpp>
+#include <mem_stats_args_t.hpp>
 #include <start_vmm_args_t.hpp>
+#include <stats_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
+#include <syscall_trace_args_t.hpp>
+#include <vmexit_log_args_t.hpp>
 
 #include <bsl/safe_integral.hpp>
 #include <bsl/string_view.hpp>
@@ -82,6 +87,26 @@ namespace loader
     /// @brief defines IOCTL for dumping a VMs debug ring
     constexpr bsl::safe_uintmax DUMP_VMM{static_cast<bsl::uintmax>(
         CTL_CODE(FILE_DEVICE_UNKNOWN, DUMP_VMM_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA))};
+
+    /// @brief defines IOCTL for adding pages to a VMs page pool
+    constexpr bsl::safe_uintmax ADD_PAGES{static_cast<bsl::uintmax>(
+        CTL_CODE(FILE_DEVICE_UNKNOWN, ADD_PAGES_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA))};
+
+    /// @brief defines IOCTL for reading a VMs memory stats
+    constexpr bsl::safe_uintmax MEM_STATS{static_cast<bsl::uintmax>(
+        CTL_CODE(FILE_DEVICE_UNKNOWN, MEM_STATS_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA))};
+
+    /// @brief defines IOCTL for reading a PP's VMExit log
+    constexpr bsl::safe_uintmax VMEXIT_LOG{static_cast<bsl::uintmax>(
+        CTL_CODE(FILE_DEVICE_UNKNOWN, VMEXIT_LOG_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA))};
+
+    /// @brief defines IOCTL for reading a PP's VMExit stats
+    constexpr bsl::safe_uintmax STATS{static_cast<bsl::uintmax>(
+        CTL_CODE(FILE_DEVICE_UNKNOWN, STATS_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA))};
+
+    /// @brief defines IOCTL for draining a PP's syscall trace
+    constexpr bsl::safe_uintmax SYSCALL_TRACE{static_cast<bsl::uintmax>(
+        CTL_CODE(FILE_DEVICE_UNKNOWN, SYSCALL_TRACE_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA))};
 }
 
 #endif
@@ -24,13 +24,23 @@ Environment:
 #include "../include/driver.h"
 #include "queue.tmh"
 
+#include <add_pages.h>
+#include <add_pages_args_t.h>
 #include <debug.h>
+#include <drain_syscall_trace.h>
 #include <dump_vmm.h>
 #include <dump_vmm_args_t.h>
+#include <mem_stats.h>
+#include <mem_stats_args_t.h>
+#include <read_vmexit_log.h>
+#include <read_vmexit_stats.h>
 #include <start_vmm.h>
 #include <start_vmm_args_t.h>
+#include <stats_args_t.h>
 #include <stop_vmm.h>
 #include <stop_vmm_args_t.h>
+#include <syscall_trace_args_t.h>
+#include <vmexit_log_args_t.h>
 #include <loader_platform_interface.h>
 
 // clang-format on
@@ -191,6 +201,46 @@ Return Value:
             }
             break;
         }
+        case LOADER_ADD_PAGES: {
+            if (add_pages((struct add_pages_args_t const *)in)) {
+                BFERROR("add_pages failed\n");
+                WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
+                return;
+            }
+            break;
+        }
+        case LOADER_MEM_STATS: {
+            if (mem_stats((struct mem_stats_args_t *)out)) {
+                BFERROR("mem_stats failed\n");
+                WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
+                return;
+            }
+            break;
+        }
+        case LOADER_VMEXIT_LOG: {
+            if (read_vmexit_log((struct vmexit_log_args_t *)out)) {
+                BFERROR("read_vmexit_log failed\n");
+                WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
+                return;
+            }
+            break;
+        }
+        case LOADER_STATS: {
+            if (read_vmexit_stats((struct stats_args_t *)out)) {
+                BFERROR("read_vmexit_stats failed\n");
+                WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
+                return;
+            }
+            break;
+        }
+        case LOADER_SYSCALL_TRACE: {
+            if (drain_syscall_trace((struct syscall_trace_args_t *)out)) {
+                BFERROR("drain_syscall_trace failed\n");
+                WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
+                return;
+            }
+            break;
+        }
         default: {
             BFERROR("invalid ioctl cmd: 0x%x\n", IoControlCode);
             WdfRequestComplete(Request, STATUS_ACCESS_DENIED);
@@ -43,6 +43,9 @@
 
 #define BF_TAG 'BFLK'
 
+/** @brief stores the loader's mutex (see platform_mutex_lock) */
+static FAST_MUTEX g_platform_mutex;
+
 /**
  * <!-- description -->
  *   @brief This function allocates read/write virtual memory from the
@@ -78,6 +81,35 @@ platform_alloc(uint64_t const size)
     return ret;
 }
 
+/**
+ * <!-- description -->
+ *   @brief This function allocates read/write virtual memory from the
+ *     kernel, backed by physical memory that is local to the provided
+ *     NUMA node whenever possible. This memory is not physically
+ *     contiguous. The resulting pointer is at least 4k aligned. Use
+ *     platform_free() to release this memory.
+ *
+ *   @note This function must zero the allocated memory
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the number of bytes to allocate
+ *   @param node the NUMA node to allocate the memory from
+ *   @return Returns a pointer to the newly allocated memory on success.
+ *     Returns a nullptr on failure.
+ */
+void *
+platform_alloc_node(uint64_t const size, uint32_t const node)
+{
+    /**
+     * TODO:
+     * - Windows only reports a single node for now (see
+     *   platform_num_online_nodes), so there is nothing to be local to.
+     */
+
+    (void)node;
+    return platform_alloc(size);
+}
+
 /**
  * <!-- description -->
  *   @brief This function allocates read/write virtual memory from the
@@ -116,6 +148,60 @@ platform_alloc_contiguous(uint64_t const size)
     return ret;
 }
 
+/**
+ * <!-- description -->
+ *   @brief This function allocates read/write virtual memory from the
+ *     kernel, backed by physical memory that is local to the provided
+ *     NUMA node whenever possible. This memory is physically contiguous.
+ *     If size is a power of 2, the resulting memory is also physically
+ *     aligned to size, otherwise the resulting pointer is at least 4k
+ *     aligned. Unlike the other allocation functions, failure is not
+ *     reported as an error as callers are expected to fall back to
+ *     platform_alloc_node(). Use platform_free_contiguous() to release
+ *     this memory.
+ *
+ *   @note This function must zero the allocated memory
+ *
+ * <!-- inputs/outputs -->
+ *   @param size the number of bytes to allocate
+ *   @param node the NUMA node to allocate the memory from
+ *   @return Returns a pointer to the newly allocated memory on success.
+ *     Returns a nullptr on failure.
+ */
+void *
+platform_alloc_contiguous_node(uint64_t const size, uint32_t const node)
+{
+    void *ret;
+
+    /**
+     * TODO:
+     * - Windows only reports a single node for now (see
+     *   platform_num_online_nodes), so there is nothing to be local to.
+     * - MmAllocateContiguousMemory does not promise that the resulting
+     *   memory is aligned to size, so the page pool will likely fall
+     *   back to 4k pages. MmAllocateContiguousMemorySpecifyCache with a
+     *   BoundaryAddressMultiple would fix this.
+     */
+
+    (void)node;
+
+    if (0 == size) {
+        BFERROR("invalid number of bytes (i.e., size)\n");
+        return ((void *)0);
+    }
+
+    PHYSICAL_ADDRESS addr;
+    addr.QuadPart = MAXULONG64;
+
+    ret = MmAllocateContiguousMemory(size, addr);
+    if (((void *)0) == ret) {
+        return ((void *)0);
+    }
+
+    RtlFillMemory(ret, size, 0);
+    return ret;
+}
+
 /**
  * <!-- description -->
  *   @brief This function frees memory previously allocated using the
@@ -231,6 +317,22 @@ platform_memcpy(void *const dst, void const *const src, uint64_t const num)
     return 0;
 }
 
+/**
+ * <!-- description -->
+ *   @brief Stores "val" to "ptr" with release semantics. Any memory that
+ *     was written before this call is visible to any other CPU (including
+ *     the microkernel) that sees "val" with an acquire load.
+ *
+ * <!-- inputs/outputs -->
+ *   @param ptr a pointer to the memory to store to
+ *   @param val the value to store
+ */
+void
+platform_store_release(uint64_t *const ptr, uint64_t const val)
+{
+    InterlockedExchange64((LONG64 volatile *)ptr, (LONG64)val);
+}
+
 /**
  * <!-- description -->
  *   @brief Copies "num" bytes from "src" to "dst". If "src" or "dst" are
@@ -307,6 +409,42 @@ platform_num_online_cpus(void)
     return KeQueryActiveProcessorCount(&k_affin);
 }
 
+/**
+ * <!-- description -->
+ *   @brief Returns the total number of online NUMA nodes. Nodes are
+ *     numbered from 0 to platform_num_online_nodes() - 1.
+ *
+ * <!-- inputs/outputs -->
+ *   @return Returns the total number of online NUMA nodes
+ */
+uint32_t
+platform_num_online_nodes(void)
+{
+    /**
+     * TODO:
+     * - Add support for KeQueryHighestNodeNumber and
+     *   KeQueryNodeActiveAffinity. Until then, the page pool is
+     *   treated as a single node.
+     */
+
+    return 1U;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Returns the NUMA node that the provided CPU belongs to.
+ *
+ * <!-- inputs/outputs -->
+ *   @param cpu the CPU to query
+ *   @return Returns the NUMA node that the provided CPU belongs to.
+ */
+uint32_t
+platform_cpu_to_node(uint32_t const cpu)
+{
+    (void)cpu;
+    return 0U;
+}
+
 /**
  * <!-- description -->
  *   @brief Calls the user provided callback on each CPU in forward order.
@@ -404,3 +542,36 @@ platform_on_each_cpu(platform_per_cpu_func const func, uint32_t const order)
 
     return ret;
 }
+
+/**
+ * <!-- description -->
+ *   @brief Initializes the loader's mutex. This must be called before
+ *     the loader can receive an IOCTL.
+ */
+void
+platform_mutex_init(void)
+{
+    ExInitializeFastMutex(&g_platform_mutex);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Acquires the loader's mutex. The IOCTLs that change the state
+ *     of the VMM (i.e., start, stop and add pages) hold this mutex so that
+ *     they cannot run at the same time. This function might sleep.
+ */
+void
+platform_mutex_lock(void)
+{
+    ExAcquireFastMutex(&g_platform_mutex);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Releases the loader's mutex.
+ */
+void
+platform_mutex_unlock(void)
+{
+    ExReleaseFastMutex(&g_platform_mutex);
+}
@@ -25,12 +25,14 @@
 #ifndef MK_INTERFACE_H
 #define MK_INTERFACE_H
 
+#include <bsl/array.hpp>
 #include <bsl/char_type.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/cstdint.hpp>
 #include <bsl/cstr_type.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/span.hpp>
 
 namespace syscall
 {
@@ -237,6 +239,124 @@ namespace syscall
         bf_reg_t_ia32_debugctl = static_cast<bsl::uint64>(72),
     };
 
+    // -------------------------------------------------------------------------
+    // VPS Field Type
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the width of an 8bit field in a bf_vps_field_t
+    constexpr bsl::safe_uint64 BF_VPS_FIELD_WIDTH_8{bsl::to_u64(8U)};
+    /// @brief Defines the width of a 16bit field in a bf_vps_field_t
+    constexpr bsl::safe_uint64 BF_VPS_FIELD_WIDTH_16{bsl::to_u64(16U)};
+    /// @brief Defines the width of a 32bit field in a bf_vps_field_t
+    constexpr bsl::safe_uint64 BF_VPS_FIELD_WIDTH_32{bsl::to_u64(32U)};
+    /// @brief Defines the width of a 64bit field in a bf_vps_field_t
+    constexpr bsl::safe_uint64 BF_VPS_FIELD_WIDTH_64{bsl::to_u64(64U)};
+
+    /// @brief Defines the max number of bf_vps_field_t in a batch (i.e., 4080 bytes)
+    constexpr bsl::safe_uintmax BF_VPS_BATCH_MAX_FIELDS{bsl::to_umax(170U)};
+
+    /// @class syscall::bf_vps_field_t
+    ///
+    /// <!-- description -->
+    ///   @brief Describes a single VPS field that is read or written by
+    ///     bf_vps_op_read_batch and bf_vps_op_write_batch. The index is
+    ///     the same architecture specific index given to bf_vps_op_read64
+    ///     and friends, and the width is one of the BF_VPS_FIELD_WIDTH
+    ///     values.
+    ///
+    // IWYU is more important here, and this rule would make this interface
+    // needlessly overcomplicated.
+    // NOLINTNEXTLINE(bsl-user-defined-type-names-match-header-name)
+    struct bf_vps_field_t final
+    {
+        /// @brief The HVE specific index defining which field to access
+        bf_uint64_t index;
+        /// @brief The width of the field in bits
+        bf_uint64_t width;
+        /// @brief The value that was read, or the value to write
+        bf_uint64_t value;
+    };
+
+    // -------------------------------------------------------------------------
+    // Fast Path Table
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the max number of CPUID leaves in a bf_fast_path_t
+    constexpr bsl::safe_uintmax BF_FAST_PATH_MAX_CPUID{bsl::to_umax(32U)};
+    /// @brief Defines the max number of MSRs in each MSR list of a bf_fast_path_t
+    constexpr bsl::safe_uintmax BF_FAST_PATH_MAX_MSRS{bsl::to_umax(32U)};
+    /// @brief Defines a bf_fast_path_cpuid_t subleaf that matches any subleaf
+    constexpr bsl::safe_uint64 BF_FAST_PATH_ANY_SUBLEAF{bsl::to_u64(0xFFFFFFFFFFFFFFFFU)};
+    /// @brief Tells the microkernel to handle NMI window exits (Intel only)
+    constexpr bsl::safe_uint64 BF_FAST_PATH_FLAG_NMI_WINDOW{bsl::to_u64(0x0000000000000001U)};
+
+    /// @class syscall::bf_fast_path_cpuid_t
+    ///
+    /// <!-- description -->
+    ///   @brief Describes a CPUID leaf that the microkernel emulates on
+    ///     behalf of the extension. The microkernel executes CPUID, and
+    ///     then for each register, clears the bits in "clear" and sets the
+    ///     bits in "set" before returning the result to the VPS.
+    ///
+    // IWYU is more important here, and this rule would make this interface
+    // needlessly overcomplicated.
+    // NOLINTNEXTLINE(bsl-user-defined-type-names-match-header-name)
+    struct bf_fast_path_cpuid_t final
+    {
+        /// @brief The CPUID leaf (i.e., EAX) to handle
+        bf_uint64_t leaf;
+        /// @brief The CPUID subleaf (i.e., ECX) or BF_FAST_PATH_ANY_SUBLEAF
+        bf_uint64_t subleaf;
+        /// @brief The bits to clear in EAX
+        bf_uint64_t eax_clear;
+        /// @brief The bits to set in EAX
+        bf_uint64_t eax_set;
+        /// @brief The bits to clear in EBX
+        bf_uint64_t ebx_clear;
+        /// @brief The bits to set in EBX
+        bf_uint64_t ebx_set;
+        /// @brief The bits to clear in ECX
+        bf_uint64_t ecx_clear;
+        /// @brief The bits to set in ECX
+        bf_uint64_t ecx_set;
+        /// @brief The bits to clear in EDX
+        bf_uint64_t edx_clear;
+        /// @brief The bits to set in EDX
+        bf_uint64_t edx_set;
+    };
+
+    /// @class syscall::bf_fast_path_t
+    ///
+    /// <!-- description -->
+    ///   @brief Describes the VMExits that the microkernel handles on behalf
+    ///     of the extension without calling the extension's VMExit handler.
+    ///     Any VMExit that is not described by this table is still given to
+    ///     the extension.
+    ///
+    // IWYU is more important here, and this rule would make this interface
+    // needlessly overcomplicated.
+    // NOLINTNEXTLINE(bsl-user-defined-type-names-match-header-name)
+    struct bf_fast_path_t final
+    {
+        /// @brief Stores the BF_FAST_PATH_FLAG_XXX flags
+        bf_uint64_t flags;
+
+        /// @brief Stores the number of valid entries in cpuid
+        bf_uint64_t num_cpuid;
+        /// @brief Stores the CPUID leaves to emulate
+        bsl::array<bf_fast_path_cpuid_t, BF_FAST_PATH_MAX_CPUID.get()> cpuid;
+
+        /// @brief Stores the number of valid entries in rdmsr
+        bf_uint64_t num_rdmsr;
+        /// @brief Stores the MSRs whose reads are passed through
+        bsl::array<bf_uint64_t, BF_FAST_PATH_MAX_MSRS.get()> rdmsr;
+
+        /// @brief Stores the number of valid entries in wrmsr
+        bf_uint64_t num_wrmsr;
+        /// @brief Stores the MSRs whose writes are passed through
+        bsl::array<bf_uint64_t, BF_FAST_PATH_MAX_MSRS.get()> wrmsr;
+    };
+
     // -------------------------------------------------------------------------
     // TLS Page Offsets
     // -------------------------------------------------------------------------
@@ -271,6 +391,20 @@ namespace syscall
     constexpr bsl::safe_uintmax TLS_OFFSET_R14{bsl::to_umax(0x868U)};
     /// @brief stores the offset in the TLS block for r15
     constexpr bsl::safe_uintmax TLS_OFFSET_R15{bsl::to_umax(0x870U)};
+    /// @brief stores the offset in the TLS block for the VMExit reason
+    constexpr bsl::safe_uintmax TLS_OFFSET_EXIT_REASON{bsl::to_umax(0x880U)};
+    /// @brief stores the offset in the TLS block for the VMExit info1
+    constexpr bsl::safe_uintmax TLS_OFFSET_EXIT_INFO1{bsl::to_umax(0x888U)};
+    /// @brief stores the offset in the TLS block for the VMExit info2
+    constexpr bsl::safe_uintmax TLS_OFFSET_EXIT_INFO2{bsl::to_umax(0x890U)};
+    /// @brief stores the offset in the TLS block for the VMExit guest physical address
+    constexpr bsl::safe_uintmax TLS_OFFSET_EXIT_GPA{bsl::to_umax(0x898U)};
+    /// @brief stores the offset in the TLS block for the VMExit interruption info
+    constexpr bsl::safe_uintmax TLS_OFFSET_EXIT_INTR_INFO{bsl::to_umax(0x8A0U)};
+    /// @brief stores the offset in the TLS block for the VMExit rip
+    constexpr bsl::safe_uintmax TLS_OFFSET_EXIT_RIP{bsl::to_umax(0x8A8U)};
+    /// @brief stores the offset in the TLS block for the VMExit instruction length
+    constexpr bsl::safe_uintmax TLS_OFFSET_EXIT_INSTR_LEN{bsl::to_umax(0x8B0U)};
     /// @brief stores the offset in the TLS block for the thread id
     constexpr bsl::safe_uintmax TLS_OFFSET_THREAD_ID{bsl::to_umax(0xFF8U)};
 
@@ -303,10 +437,59 @@ namespace syscall
     // VMExit Callback Handler Type
     // -------------------------------------------------------------------------
 
-    /// @brief Defines the signature of the VM exit callback handler
+    /// @brief Defines the signature of the VM exit callback handler. The
+    ///   handler returns a BF_VMEXIT_DISPOSITION_XXX value that tells the
+    ///   microkernel what to do next.
     // Entry points cannot use safe integral types
     // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
-    using bf_callback_handler_vmexit_t = void (*)(bsl::uint16, bsl::uint64);
+    using bf_callback_handler_vmexit_t = bsl::uint64 (*)(bsl::uint16, bsl::uint64);
+
+    // -------------------------------------------------------------------------
+    // VMExit Disposition
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the mask of the disposition code in a disposition
+    constexpr bsl::safe_uint64 BF_VMEXIT_DISPOSITION_MASK{bsl::to_u64(0x00000000000000FFU)};
+    /// @brief Tells the microkernel to run the current VPS
+    constexpr bsl::safe_uint64 BF_VMEXIT_DISPOSITION_RESUME{bsl::to_u64(0x0U)};
+    /// @brief Tells the microkernel to advance the IP of the current VPS and run it
+    constexpr bsl::safe_uint64 BF_VMEXIT_DISPOSITION_ADVANCE_IP_AND_RESUME{bsl::to_u64(0x1U)};
+    /// @brief Tells the microkernel to run the VPS/VP/VM encoded in the disposition
+    constexpr bsl::safe_uint64 BF_VMEXIT_DISPOSITION_RUN{bsl::to_u64(0x2U)};
+
+    /// @brief Defines the location of the VPSID in a BF_VMEXIT_DISPOSITION_RUN
+    constexpr bsl::safe_uint64 BF_VMEXIT_DISPOSITION_VPSID_SHIFT{bsl::to_u64(16U)};
+    /// @brief Defines the location of the VPID in a BF_VMEXIT_DISPOSITION_RUN
+    constexpr bsl::safe_uint64 BF_VMEXIT_DISPOSITION_VPID_SHIFT{bsl::to_u64(32U)};
+    /// @brief Defines the location of the VMID in a BF_VMEXIT_DISPOSITION_RUN
+    constexpr bsl::safe_uint64 BF_VMEXIT_DISPOSITION_VMID_SHIFT{bsl::to_u64(48U)};
+
+    /// <!-- description -->
+    ///   @brief Returns a BF_VMEXIT_DISPOSITION_RUN disposition that tells
+    ///     the microkernel to run the provided VPS, VP and VM once the
+    ///     VMExit handler returns. This is the same as calling
+    ///     bf_vps_op_run, without the need for an additional syscall.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param vpsid The VPSID of the VPS to run
+    ///   @param vpid The VPID of the VP to run
+    ///   @param vmid The VMID of the VM to run
+    ///   @return Returns the resulting disposition
+    ///
+    [[nodiscard]] constexpr auto
+    bf_vmexit_disposition_run(
+        bsl::safe_uint16 const &vpsid,
+        bsl::safe_uint16 const &vpid,
+        bsl::safe_uint16 const &vmid) noexcept -> bsl::safe_uint64
+    {
+        bsl::safe_uint64 ret{BF_VMEXIT_DISPOSITION_RUN};
+
+        ret |= (bsl::to_u64(vpsid) << BF_VMEXIT_DISPOSITION_VPSID_SHIFT);
+        ret |= (bsl::to_u64(vpid) << BF_VMEXIT_DISPOSITION_VPID_SHIFT);
+        ret |= (bsl::to_u64(vmid) << BF_VMEXIT_DISPOSITION_VMID_SHIFT);
+
+        return ret;
+    }
 
     // -------------------------------------------------------------------------
     // Fast Fail Callback Handler Type
@@ -412,6 +595,11 @@ namespace syscall
     extern "C" void bf_debug_op_write_str_impl(    // --
         bsl::char_type const *const reg0_in) noexcept;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_page_pool.
+    ///
+    extern "C" void bf_debug_op_dump_page_pool_impl() noexcept;
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_callback_op_wait.
     ///
@@ -453,6 +641,26 @@ namespace syscall
         bf_uint64_t const reg0_in,                                      // --
         bf_callback_handler_fail_t const reg1_in) noexcept -> bf_status_t::value_type;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_callback_op_vmexit_return. This is
+    ///     used as the return address of the VMExit handler, and passes the
+    ///     handler's return value (in RAX) to the microkernel, along with
+    ///     the handle given to bf_callback_op_register_vmexit_impl.
+    ///
+    extern "C" void bf_callback_op_vmexit_return_impl() noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_callback_op_register_fast_path.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_callback_op_register_fast_path_impl(    // --
+        bf_uint64_t const reg0_in,                                           // --
+        bf_ptr_t const reg1_in) noexcept -> bf_status_t::value_type;
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_vm_op_create_vm.
     ///
@@ -753,6 +961,50 @@ namespace syscall
         bf_uint64_t const reg0_in,             // --
         bf_uint16_t const reg1_in) noexcept;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vps_op_read_batch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vps_op_read_batch_impl(    // --
+        bf_uint64_t const reg0_in,                              // --
+        bf_uint16_t const reg1_in,                              // --
+        bf_ptr_t const reg2_in,                                 // --
+        bf_uint64_t const reg3_in) noexcept -> bf_status_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vps_op_write_batch.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vps_op_write_batch_impl(    // --
+        bf_uint64_t const reg0_in,                               // --
+        bf_uint16_t const reg1_in,                               // --
+        bf_ptr_t const reg2_in,                                  // --
+        bf_uint64_t const reg3_in) noexcept -> bf_status_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vps_op_flush_tlb.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vps_op_flush_tlb_impl(    // --
+        bf_uint64_t const reg0_in,                             // --
+        bf_uint16_t const reg1_in) noexcept -> bf_status_t::value_type;
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_intrinsic_op_read_msr.
     ///
@@ -795,6 +1047,60 @@ namespace syscall
         bf_ptr_t *const reg0_out,
         bf_uint64_t *const reg1_out) noexcept -> bf_status_t::value_type;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_page.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_mem_op_free_page_impl(    // --
+        bf_uint64_t const reg0_in,                             // --
+        bf_ptr_t const reg1_in) noexcept -> bf_status_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_alloc_huge.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg0_out n/a
+    ///   @param reg1_out n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_mem_op_alloc_huge_impl(    // --
+        bf_uint64_t const reg0_in,                              // --
+        bf_uint64_t const reg1_in,                              // --
+        bf_ptr_t *const reg0_out,                               // --
+        bf_uint64_t *const reg1_out) noexcept -> bf_status_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_huge.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_mem_op_free_huge_impl(    // --
+        bf_uint64_t const reg0_in,                             // --
+        bf_ptr_t const reg1_in) noexcept -> bf_status_t::value_type;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_alloc_heap.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg0_out n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_mem_op_alloc_heap_impl(    // --
+        bf_uint64_t const reg0_in,                              // --
+        bf_uint64_t const reg1_in,                              // --
+        bf_ptr_t *const reg0_out) noexcept -> bf_status_t::value_type;
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_mem_op_virt_to_phys.
     ///
@@ -1057,6 +1363,62 @@ namespace syscall
     ///
     extern "C" [[nodiscard]] auto bf_tls_thread_id_impl() noexcept -> bf_uint64_t;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_reason.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_reason_impl() noexcept -> bf_uint64_t;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_info1.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_info1_impl() noexcept -> bf_uint64_t;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_info2.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_info2_impl() noexcept -> bf_uint64_t;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_gpa.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_gpa_impl() noexcept -> bf_uint64_t;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_intr_info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_intr_info_impl() noexcept -> bf_uint64_t;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_rip.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_rip_impl() noexcept -> bf_uint64_t;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_instr_len.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_instr_len_impl() noexcept -> bf_uint64_t;
+
     // -------------------------------------------------------------------------
     // TLS
     // -------------------------------------------------------------------------
@@ -1493,6 +1855,111 @@ namespace syscall
         return {bf_tls_thread_id_impl()};
     }
 
+    /// <!-- description -->
+    ///   @brief Returns the value of tls.exit_reason. This value is
+    ///     filled in by the microkernel before the VMExit handler is called.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle reserved for uint testing
+    ///   @return Returns the value of tls.exit_reason
+    ///
+    [[nodiscard]] inline auto
+    bf_tls_exit_reason(bf_handle_t const &handle) noexcept -> bsl::safe_uintmax
+    {
+        bsl::discard(handle);
+        return {bf_tls_exit_reason_impl()};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the value of tls.exit_info1. This value is
+    ///     filled in by the microkernel before the VMExit handler is called.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle reserved for uint testing
+    ///   @return Returns the value of tls.exit_info1
+    ///
+    [[nodiscard]] inline auto
+    bf_tls_exit_info1(bf_handle_t const &handle) noexcept -> bsl::safe_uintmax
+    {
+        bsl::discard(handle);
+        return {bf_tls_exit_info1_impl()};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the value of tls.exit_info2. This value is
+    ///     filled in by the microkernel before the VMExit handler is called.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle reserved for uint testing
+    ///   @return Returns the value of tls.exit_info2
+    ///
+    [[nodiscard]] inline auto
+    bf_tls_exit_info2(bf_handle_t const &handle) noexcept -> bsl::safe_uintmax
+    {
+        bsl::discard(handle);
+        return {bf_tls_exit_info2_impl()};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the value of tls.exit_gpa. This value is
+    ///     filled in by the microkernel before the VMExit handler is called.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle reserved for uint testing
+    ///   @return Returns the value of tls.exit_gpa
+    ///
+    [[nodiscard]] inline auto
+    bf_tls_exit_gpa(bf_handle_t const &handle) noexcept -> bsl::safe_uintmax
+    {
+        bsl::discard(handle);
+        return {bf_tls_exit_gpa_impl()};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the value of tls.exit_intr_info. This value is
+    ///     filled in by the microkernel before the VMExit handler is called.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle reserved for uint testing
+    ///   @return Returns the value of tls.exit_intr_info
+    ///
+    [[nodiscard]] inline auto
+    bf_tls_exit_intr_info(bf_handle_t const &handle) noexcept -> bsl::safe_uintmax
+    {
+        bsl::discard(handle);
+        return {bf_tls_exit_intr_info_impl()};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the value of tls.exit_rip. This value is
+    ///     filled in by the microkernel before the VMExit handler is called.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle reserved for uint testing
+    ///   @return Returns the value of tls.exit_rip
+    ///
+    [[nodiscard]] inline auto
+    bf_tls_exit_rip(bf_handle_t const &handle) noexcept -> bsl::safe_uintmax
+    {
+        bsl::discard(handle);
+        return {bf_tls_exit_rip_impl()};
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the value of tls.exit_instr_len. This value is
+    ///     filled in by the microkernel before the VMExit handler is called.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle reserved for uint testing
+    ///   @return Returns the value of tls.exit_instr_len
+    ///
+    [[nodiscard]] inline auto
+    bf_tls_exit_instr_len(bf_handle_t const &handle) noexcept -> bsl::safe_uintmax
+    {
+        bsl::discard(handle);
+        return {bf_tls_exit_instr_len_impl()};
+    }
+
     // -------------------------------------------------------------------------
     // Syscall Status Codes
     // -------------------------------------------------------------------------
@@ -1584,6 +2051,11 @@ namespace syscall
     constexpr bsl::safe_uint64 BF_HYPERCALL_OPCODE_NOSIG_MASK{bsl::to_u64(0x00000000FFFF0000U)};
     /// @brief Defines a mask for BF_SYSCALL_IDX
     constexpr bsl::safe_uint64 BF_HYPERCALL_INDEX_MASK{bsl::to_u64(0x000000000000FFFFU)};
+    /// @brief Defines a mask for BF_SYSCALL_SIG, BF_SYSCALL_OP and BF_SYSCALL_IDX
+    constexpr bsl::safe_uint64 BF_HYPERCALL_NOFLAGS_MASK{bsl::to_u64(0xFFFF0000FFFFFFFFU)};
+
+    /// @brief Defines the BF_SYSCALL_FLAGS bit that selects the leaf syscall path
+    constexpr bsl::safe_uint64 BF_SYSCALL_FLAG_LEAF{bsl::to_u64(0x0000000100000000U)};
 
     /// <!-- description -->
     ///   @brief n/a
@@ -1650,6 +2122,19 @@ namespace syscall
         return rax & BF_HYPERCALL_INDEX_MASK;
     }
 
+    /// <!-- description -->
+    ///   @brief n/a
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param rax n/a
+    ///   @return n/a
+    ///
+    [[nodiscard]] constexpr auto
+    bf_syscall_noflags(bsl::safe_uint64 const &rax) noexcept -> bsl::safe_uint64
+    {
+        return rax & BF_HYPERCALL_NOFLAGS_MASK;
+    }
+
     // -------------------------------------------------------------------------
     // Specification IDs
     // -------------------------------------------------------------------------
@@ -1958,9 +2443,13 @@ namespace syscall
     ///     purposes, but sometimes, software is aware of odd condition, or is
     ///     even aware that something bad has happened, and this syscall
     ///     provides software with an opportunity to dump this log on demand.
+    ///     Each PP has its own log, and only the log of the PP that makes
+    ///     this syscall is output. The log of any PP can also be read from
+    ///     outside of the VMM using "vmmctl vmexit-log".
     ///
     /// <!-- inputs/outputs -->
-    ///   @param vpid The VPID of the VP to dump the log from
+    ///   @param vpid The VPID of the VP to dump the log from, or 0xFFFF to
+    ///     dump the log of every VP
     ///
     inline void
     bf_debug_op_dump_vmexit_log(    // --
@@ -2011,6 +2500,29 @@ namespace syscall
         bf_debug_op_write_str_impl(str);
     }
 
+    // -------------------------------------------------------------------------
+    // bf_debug_op_dump_page_pool
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the syscall index for bf_debug_op_dump_page_pool
+    constexpr bsl::safe_uint64 BF_DEBUG_OP_DUMP_PAGE_POOL_IDX_VAL{
+        bsl::to_u64(0x0000000000000007U)};
+
+    /// <!-- description -->
+    ///   @brief This syscall tells the microkernel to output the stats of
+    ///     the page pool to the console device the microkernel is currently
+    ///     using for debugging. This includes the total number of pages in
+    ///     the page pool, the number of pages in use, the high-water mark,
+    ///     the number of failed allocations and the number of pages owned
+    ///     by the microkernel, the VPSs and each extension. The same stats
+    ///     can be read from outside of the VMM using "vmmctl mem".
+    ///
+    inline void
+    bf_debug_op_dump_page_pool() noexcept
+    {
+        bf_debug_op_dump_page_pool_impl();
+    }
+
     // -------------------------------------------------------------------------
     // bf_callback_op_wait
     // -------------------------------------------------------------------------
@@ -2066,7 +2578,10 @@ namespace syscall
 
     /// <!-- description -->
     ///   @brief This syscall tells the microkernel that the extension would
-    ///     like to receive callbacks for VM exits
+    ///     like to receive callbacks for VM exits. When the handler returns,
+    ///     the microkernel acts on the returned BF_VMEXIT_DISPOSITION_XXX
+    ///     value directly. The handler may also call one of the "run"
+    ///     syscalls (e.g., bf_vps_op_run_current), which do not return.
     ///
     /// <!-- inputs/outputs -->
     ///   @param handle Set to the result of bf_handle_op_open_handle
@@ -2110,6 +2625,48 @@ namespace syscall
         return {bf_callback_op_register_fail_impl(handle.hndl, handler)};
     }
 
+    // -------------------------------------------------------------------------
+    // bf_callback_op_vmexit_return
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the syscall index for bf_callback_op_vmexit_return.
+    ///   This syscall is never called directly. bf_callback_op_register_vmexit
+    ///   registers bf_callback_op_vmexit_return_impl as the return address of
+    ///   the VMExit handler, which hands the handler's disposition back to
+    ///   the microkernel.
+    constexpr bsl::safe_uint64 BF_CALLBACK_OP_VMEXIT_RETURN_IDX_VAL{
+        bsl::to_u64(0x0000000000000005U)};
+
+    // -------------------------------------------------------------------------
+    // bf_callback_op_register_fast_path
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the syscall index for bf_callback_op_register_fast_path
+    constexpr bsl::safe_uint64 BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL{
+        bsl::to_u64(0x0000000000000006U)};
+
+    /// <!-- description -->
+    ///   @brief This syscall tells the microkernel which VMExits it can
+    ///     handle on behalf of the extension (e.g., CPUID leaves, MSR
+    ///     passthrough, NMI windows) without calling the extension's VMExit
+    ///     handler. The table is copied by the microkernel and is shared by
+    ///     all PPs, so this syscall must be made before the extension's
+    ///     bootstrap callback has completed on PP 0 (e.g., from main).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle Set to the result of bf_handle_op_open_handle
+    ///   @param table the fast path table to install
+    ///   @return Returns the bf_status_t result of the syscall. See the
+    ///     specification for more information about error codes.
+    ///
+    [[nodiscard]] inline auto
+    bf_callback_op_register_fast_path(    // --
+        bf_handle_t const &handle,        // --
+        bf_fast_path_t const &table) noexcept -> bf_status_t
+    {
+        return {bf_callback_op_register_fast_path_impl(handle.hndl, &table)};
+    }
+
     // -------------------------------------------------------------------------
     // bf_vm_op_create_vm
     // -------------------------------------------------------------------------
@@ -2719,6 +3276,103 @@ namespace syscall
         bf_vps_op_promote_impl(handle.hndl, vpsid.get());
     }
 
+    // -------------------------------------------------------------------------
+    // bf_vps_op_read_batch
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the syscall index for bf_vps_op_read_batch
+    constexpr bsl::safe_uint64 BF_VPS_OP_READ_BATCH_IDX_VAL{bsl::to_u64(0x0000000000000012U)};
+
+    /// <!-- description -->
+    ///   @brief Reads a batch of fields from the VPS in a single syscall.
+    ///     For each bf_vps_field_t, the index and width must be set, and
+    ///     on success, the value is set to the value of the field. The
+    ///     fields are read in order, and the syscall stops at the first
+    ///     field that cannot be read. At most BF_VPS_BATCH_MAX_FIELDS
+    ///     fields can be read at once. The fields may cross a page
+    ///     boundary, but every page they cover must be mapped and
+    ///     writable. The fields read before a failure are still returned.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle Set to the result of bf_handle_op_open_handle
+    ///   @param vpsid The VPSID of the VPS to read from
+    ///   @param fields The fields to read from the VPS
+    ///   @return Returns the bf_status_t result of the syscall. See the
+    ///     specification for more information about error codes.
+    ///
+    [[nodiscard]] inline auto
+    bf_vps_op_read_batch(                 // --
+        bf_handle_t const &handle,        // --
+        bsl::safe_uint16 const &vpsid,    // --
+        bsl::span<bf_vps_field_t> const &fields) noexcept -> bf_status_t
+    {
+        return {bf_vps_op_read_batch_impl(
+            handle.hndl, vpsid.get(), fields.data(), fields.size().get())};
+    }
+
+    // -------------------------------------------------------------------------
+    // bf_vps_op_write_batch
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the syscall index for bf_vps_op_write_batch
+    constexpr bsl::safe_uint64 BF_VPS_OP_WRITE_BATCH_IDX_VAL{bsl::to_u64(0x0000000000000013U)};
+
+    /// <!-- description -->
+    ///   @brief Writes a batch of fields to the VPS in a single syscall.
+    ///     For each bf_vps_field_t, the index, width and value must be
+    ///     set. The fields are written in order, and the syscall stops at
+    ///     the first field that cannot be written. At most
+    ///     BF_VPS_BATCH_MAX_FIELDS fields can be written at once. The
+    ///     fields may cross a page boundary, but every page they cover
+    ///     must be mapped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle Set to the result of bf_handle_op_open_handle
+    ///   @param vpsid The VPSID of the VPS to write to
+    ///   @param fields The fields to write to the VPS
+    ///   @return Returns the bf_status_t result of the syscall. See the
+    ///     specification for more information about error codes.
+    ///
+    [[nodiscard]] inline auto
+    bf_vps_op_write_batch(                // --
+        bf_handle_t const &handle,        // --
+        bsl::safe_uint16 const &vpsid,    // --
+        bsl::span<bf_vps_field_t const> const &fields) noexcept -> bf_status_t
+    {
+        return {bf_vps_op_write_batch_impl(
+            handle.hndl, vpsid.get(), fields.data(), fields.size().get())};
+    }
+
+    // -------------------------------------------------------------------------
+    // bf_vps_op_flush_tlb
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the syscall index for bf_vps_op_flush_tlb
+    constexpr bsl::safe_uint64 BF_VPS_OP_FLUSH_TLB_IDX_VAL{bsl::to_u64(0x0000000000000014U)};
+
+    /// <!-- description -->
+    ///   @brief Flushes all of the TLB entries that belong to the requested
+    ///     VPS on the physical processor that this syscall is executed on.
+    ///     Every VPS is given its own VPID/ASID by the microkernel when it
+    ///     is created, so this only flushes the requested VPS and leaves
+    ///     the TLB entries of every other VPS (and the host) alone (i.e.,
+    ///     this is an INVVPID single-context flush on Intel and a
+    ///     TLB_CONTROL flush of the VPS's ASID on AMD).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle Set to the result of bf_handle_op_open_handle
+    ///   @param vpsid The VPSID of the VPS whose TLB entries are flushed
+    ///   @return Returns the bf_status_t result of the syscall. See the
+    ///     specification for more information about error codes.
+    ///
+    [[nodiscard]] inline auto
+    bf_vps_op_flush_tlb(              // --
+        bf_handle_t const &handle,    // --
+        bsl::safe_uint16 const &vpsid) noexcept -> bf_status_t
+    {
+        return {bf_vps_op_flush_tlb_impl(handle.hndl, vpsid.get())};
+    }
+
     // -------------------------------------------------------------------------
     // bf_intrinsic_op_read_msr
     // -------------------------------------------------------------------------
@@ -2812,6 +3466,126 @@ namespace syscall
         return {bf_mem_op_alloc_page_impl(handle.hndl, &virt, phys.data())};
     }
 
+    // -------------------------------------------------------------------------
+    // bf_mem_op_free_page
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the syscall index for bf_mem_op_free_page
+    constexpr bsl::safe_uint64 BF_MEM_OP_FREE_PAGE_IDX_VAL{bsl::to_u64(0x0000000000000001U)};
+
+    /// <!-- description -->
+    ///   @brief Frees a page previously allocated using
+    ///     bf_mem_op_alloc_page. The page is unmapped from the extension's
+    ///     direct map and returned to the microkernel. The virtual address
+    ///     of the page may be returned by a future call to
+    ///     bf_mem_op_alloc_page.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle Set to the result of bf_handle_op_open_handle
+    ///   @param virt The virtual address returned by bf_mem_op_alloc_page
+    ///   @return Returns the bf_status_t result of the syscall. See the
+    ///     specification for more information about error codes.
+    ///
+    [[nodiscard]] inline auto
+    bf_mem_op_free_page(              // --
+        bf_handle_t const &handle,    // --
+        bf_ptr_t const virt) noexcept -> bf_status_t
+    {
+        return {bf_mem_op_free_page_impl(handle.hndl, virt)};
+    }
+
+    // -------------------------------------------------------------------------
+    // bf_mem_op_alloc_huge
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the syscall index for bf_mem_op_alloc_huge
+    constexpr bsl::safe_uint64 BF_MEM_OP_ALLOC_HUGE_IDX_VAL{bsl::to_u64(0x0000000000000002U)};
+
+    /// <!-- description -->
+    ///   @brief Allocates a physically contiguous block of memory that is
+    ///     at least "size" bytes in size. The resulting block is a power of
+    ///     two pages in size (up to 2M) and is aligned to its size, both
+    ///     virtually and physically. The block is zeroed and mapped into
+    ///     the extension's direct map, meaning the extension is free to
+    ///     hand the physical address of the block to hardware that needs
+    ///     physically contiguous memory.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle Set to the result of bf_handle_op_open_handle
+    ///   @param size The number of bytes to allocate
+    ///   @param virt The virtual address of the resulting memory
+    ///   @param phys The physical address of the resulting memory
+    ///   @return Returns the bf_status_t result of the syscall. See the
+    ///     specification for more information about error codes.
+    ///
+    [[nodiscard]] inline auto
+    bf_mem_op_alloc_huge(                // --
+        bf_handle_t const &handle,       // --
+        bsl::safe_uint64 const &size,    // --
+        bf_ptr_t &virt,                  // --
+        bsl::safe_uint64 &phys) noexcept -> bf_status_t
+    {
+        return {bf_mem_op_alloc_huge_impl(handle.hndl, size.get(), &virt, phys.data())};
+    }
+
+    // -------------------------------------------------------------------------
+    // bf_mem_op_free_huge
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the syscall index for bf_mem_op_free_huge
+    constexpr bsl::safe_uint64 BF_MEM_OP_FREE_HUGE_IDX_VAL{bsl::to_u64(0x0000000000000003U)};
+
+    /// <!-- description -->
+    ///   @brief Frees memory previously allocated using
+    ///     bf_mem_op_alloc_huge. The memory is unmapped from the extension's
+    ///     direct map and returned to the microkernel's huge pool.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle Set to the result of bf_handle_op_open_handle
+    ///   @param virt The virtual address returned by bf_mem_op_alloc_huge
+    ///   @return Returns the bf_status_t result of the syscall. See the
+    ///     specification for more information about error codes.
+    ///
+    [[nodiscard]] inline auto
+    bf_mem_op_free_huge(              // --
+        bf_handle_t const &handle,    // --
+        bf_ptr_t const virt) noexcept -> bf_status_t
+    {
+        return {bf_mem_op_free_huge_impl(handle.hndl, virt)};
+    }
+
+    // -------------------------------------------------------------------------
+    // bf_mem_op_alloc_heap
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the syscall index for bf_mem_op_alloc_heap
+    constexpr bsl::safe_uint64 BF_MEM_OP_ALLOC_HEAP_IDX_VAL{bsl::to_u64(0x0000000000000004U)};
+
+    /// <!-- description -->
+    ///   @brief Grows the extension's heap by "size" bytes (rounded up to
+    ///     the nearest page) and returns the virtual address of the start
+    ///     of the newly added memory (i.e., the previous end of the heap),
+    ///     similar to sbrk(). The heap is always virtually contiguous, so
+    ///     an extension can use the heap to back its own allocator. Since
+    ///     every call is a syscall, extensions should grow the heap in
+    ///     large increments (e.g., 2M at a time).
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param handle Set to the result of bf_handle_op_open_handle
+    ///   @param size The number of bytes to grow the heap by
+    ///   @param virt The virtual address of the newly added memory
+    ///   @return Returns the bf_status_t result of the syscall. See the
+    ///     specification for more information about error codes.
+    ///
+    [[nodiscard]] inline auto
+    bf_mem_op_alloc_heap(                // --
+        bf_handle_t const &handle,       // --
+        bsl::safe_uint64 const &size,    // --
+        bf_ptr_t &virt) noexcept -> bf_status_t
+    {
+        return {bf_mem_op_alloc_heap_impl(handle.hndl, size.get(), &virt)};
+    }
+
     // -------------------------------------------------------------------------
     // bf_mem_op_virt_to_phys
     // -------------------------------------------------------------------------
@@ -24,6 +24,7 @@
 
 #include "vmmctl_main.hpp"
 
+#include <delay.hpp>
 #include <ifmap.hpp>
 #include <ioctl.hpp>
 
@@ -37,7 +38,7 @@
 namespace vmmctl
 {
     /// @brief stores the main app for the VMCTL
-    constinit vmmctl_main<ioctl, ifmap> g_app{};
+    constinit vmmctl_main<ioctl, ifmap, delay> g_app{};
 }
 
 /// <!-- description -->
@@ -25,14 +25,22 @@
 #ifndef VMMCTL_MAIN_HPP
 #define VMMCTL_MAIN_HPP
 
+#include <add_pages_args_t.hpp>
+#include <debug_ring_t.hpp>
 #include <dump_vmm_args_t.hpp>
 #include <loader_platform_interface.hpp>
+#include <mem_stats_args_t.hpp>
 #include <start_vmm_args_t.hpp>
+#include <stats_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
+#include <syscall_trace_args_t.hpp>
+#include <vmexit_log_args_t.hpp>
+#include <vmexit_stats_t.hpp>
 
 #include <bsl/arguments.hpp>
 #include <bsl/array.hpp>
 #include <bsl/byte.hpp>
+#include <bsl/char_type.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
@@ -43,9 +51,25 @@
 #include <bsl/result.hpp>
 #include <bsl/string_view.hpp>
 #include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
 
 namespace vmmctl
 {
+    /// @brief tells "vmmctl stats" to add the stats of all PPs together
+    constexpr bsl::safe_uintmax STATS_ALL_PPS{bsl::to_umax(0xFFFFFFFFFFFFFFFFU)};
+
+    /// @brief stores the names of the syscall opcodes (see bf_syscall_opcode)
+    constexpr bsl::array<bsl::string_view, 9> TRACE_OPCODE_NAMES{
+        "bf_control_op",
+        "bf_handle_op",
+        "bf_debug_op",
+        "bf_callback_op",
+        "bf_vm_op",
+        "bf_vp_op",
+        "bf_vps_op",
+        "bf_intrinsic_op",
+        "bf_mem_op"};
+
     /// @class vmmctl::vmmctl_main
     ///
     /// <!-- description -->
@@ -59,8 +83,10 @@ namespace vmmctl
     ///     bsl::ioctl, but during testing this might be a mock.
     ///   @tparam IFMAP the ifmap implementation to use. Normally this is just
     ///     bsl::ifmap, but during testing this might be a mock.
+    ///   @tparam DELAY the delay implementation to use. Normally this is just
+    ///     vmmctl::delay, but during testing this might be a mock.
     ///
-    template<typename IOCTL, typename IFMAP>
+    template<typename IOCTL, typename IFMAP, typename DELAY>
     class vmmctl_main final
     {
         /// @brief stores the mapped ELF file for the microkernel
@@ -70,7 +96,28 @@ namespace vmmctl
         /// @brief stores the arguments for stopping the VMM.
         loader::stop_vmm_args_t m_stop_vmm_ctl_args{bsl::ONE_UMAX.get()};
         /// @brief stores the arguments for dumping the VMM.
-        loader::dump_vmm_args_t m_dump_vmm_ctl_args{bsl::ONE_UMAX.get(), {}};
+        loader::dump_vmm_args_t m_dump_vmm_ctl_args{bsl::ONE_UMAX.get(), {}, {}, {}};
+        /// @brief stores the debug ring of each PP, as read by "vmmctl dump".
+        bsl::array<loader::debug_ring_t, HYPERVISOR_MAX_PPS> m_debug_rings{};
+        /// @brief stores the position of the next record in each debug ring.
+        bsl::array<bsl::uintmax, HYPERVISOR_MAX_PPS> m_debug_ring_pos{};
+        /// @brief stores the number of debug rings in m_debug_rings.
+        bsl::safe_uintmax m_num_debug_rings{};
+        /// @brief stores the arguments for reading the VMM's memory stats.
+        loader::mem_stats_args_t m_mem_stats_ctl_args{bsl::ONE_UMAX.get(), {}};
+        /// @brief stores the arguments for reading a PP's VMExit log.
+        loader::vmexit_log_args_t m_vmexit_log_ctl_args{bsl::ONE_UMAX.get(), {}, {}};
+        /// @brief stores the arguments for reading a PP's VMExit stats.
+        loader::stats_args_t m_stats_ctl_args{bsl::ONE_UMAX.get(), {}, {}, {}};
+        /// @brief stores the VMExit stats that were read last.
+        loader::vmexit_stats_t m_stats_curr{};
+        /// @brief stores the VMExit stats that were read before m_stats_curr.
+        loader::vmexit_stats_t m_stats_prev{};
+        /// @brief stores the difference between m_stats_curr and m_stats_prev.
+        loader::vmexit_stats_t m_stats_delta{};
+        /// @brief stores the arguments for draining a PP's syscall trace.
+        loader::syscall_trace_args_t m_syscall_trace_ctl_args{
+            bsl::ONE_UMAX.get(), {}, {}, {}, {}, {}};
 
         /// <!-- description -->
         ///   @brief Displays the help menu for vmmctl
@@ -81,6 +128,11 @@ namespace vmmctl
             bsl::print() << "Usage: vmmctl start microkernel ext1 <ext2> ..." << bsl::endl;
             bsl::print() << "  or:  vmmctl stop" << bsl::endl;
             bsl::print() << "  or:  vmmctl dump" << bsl::endl;
+            bsl::print() << "  or:  vmmctl grow-pool <MiB>" << bsl::endl;
+            bsl::print() << "  or:  vmmctl mem" << bsl::endl;
+            bsl::print() << "  or:  vmmctl vmexit-log <pp>" << bsl::endl;
+            bsl::print() << "  or:  vmmctl stats [--watch=<seconds>] [--cpu=<pp>]" << bsl::endl;
+            bsl::print() << "  or:  vmmctl trace [--tsc-mhz=<MHz>] > trace.json" << bsl::endl;
             bsl::print() << bsl::endl;
             bsl::print() << "A utility for managing the Bareflank Hypervisor's VMM";
             bsl::print() << bsl::endl;
@@ -179,9 +231,245 @@ namespace vmmctl
             return bsl::exit_failure;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the position that follows the provided position
+        ///     in a debug ring.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ring the debug ring that the position belongs to
+        ///   @param pos the position to get the next position of
+        ///   @return Returns the position that follows the provided position
+        ///     in a debug ring.
+        ///
+        [[nodiscard]] static constexpr auto
+        debug_ring_next(loader::debug_ring_t const &ring, bsl::safe_uintmax const &pos) noexcept
+            -> bsl::safe_uintmax
+        {
+            auto const next{pos + bsl::ONE_UMAX};
+            if (ring.buf.size() > next) {
+                return next;
+            }
+
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the character at the provided position in a
+        ///     debug ring, or '\0' if the position is out of range.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ring the debug ring to get the character from
+        ///   @param pos the position of the character to get
+        ///   @return Returns the character at the provided position in a
+        ///     debug ring, or '\0' if the position is out of range.
+        ///
+        [[nodiscard]] static constexpr auto
+        debug_ring_char(loader::debug_ring_t const &ring, bsl::safe_uintmax const &pos) noexcept
+            -> bsl::char_type
+        {
+            auto const *const c{ring.buf.at_if(pos)};
+            if (nullptr == c) {
+                return '\0';
+            }
+
+            return *c;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the end position of a debug ring.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ring the debug ring to get the end position of
+        ///   @return Returns the end position of a debug ring.
+        ///
+        [[nodiscard]] static constexpr auto
+        debug_ring_epos(loader::debug_ring_t const &ring) noexcept -> bsl::safe_uintmax
+        {
+            bsl::safe_uintmax const epos{ring.epos};
+            if (ring.buf.size() > epos) {
+                return epos;
+            }
+
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the value of a hex digit in the TSC stamp of a
+        ///     debug ring record, or 0 if the character is not a hex digit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param c the hex digit to get the value of
+        ///   @return Returns the value of a hex digit in the TSC stamp of a
+        ///     debug ring record, or 0 if the character is not a hex digit.
+        ///
+        [[nodiscard]] static constexpr auto
+        debug_ring_hex(bsl::char_type const c) noexcept -> bsl::safe_uintmax
+        {
+            constexpr auto ten{bsl::to_umax(10)};
+
+            if ((c >= '0') && (c <= '9')) {
+                return bsl::to_umax(static_cast<bsl::uintmax>(c - '0'));
+            }
+
+            if ((c >= 'A') && (c <= 'F')) {
+                return bsl::to_umax(static_cast<bsl::uintmax>(c - 'A')) + ten;
+            }
+
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Reads the debug ring of every online PP into
+        ///     m_debug_rings, and points each PP's entry in
+        ///     m_debug_ring_pos at the ring's oldest complete record.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ctl_args the IOCTL arguments to read the rings with
+        ///   @return Returns bsl::exit_success if the debug rings were
+        ///     successfully read, otherwise returns bsl::exit_failure.
+        ///
+        [[nodiscard]] constexpr auto
+        read_debug_rings(loader::dump_vmm_args_t *const ctl_args) noexcept -> bsl::exit_code
+        {
+            IOCTL ctl{LOADER_DEVICE_NAME};
+            if (!ctl) {
+                return bsl::exit_failure;
+            }
+
+            m_num_debug_rings = {};
+
+            bsl::safe_uintmax end{bsl::ONE_UMAX};
+            for (bsl::safe_uintmax pp{}; pp < end; ++pp) {
+                ctl_args->ppid = pp.get();
+                if (bsl::exit_success != this->read_write(loader::DUMP_VMM, ctl, ctl_args)) {
+                    return bsl::exit_failure;
+                }
+
+                end = bsl::to_umax(ctl_args->num_pps);
+
+                auto *const ring{m_debug_rings.at_if(pp)};
+                auto *const pos{m_debug_ring_pos.at_if(pp)};
+                if (bsl::unlikely((nullptr == ring) || (nullptr == pos))) {
+                    bsl::error() << "too many PPs\n";
+                    return bsl::exit_failure;
+                }
+
+                *ring = ctl_args->debug_ring;
+
+                /// NOTE:
+                /// - Once a debug ring wraps, its oldest record has been
+                ///   partially overwritten, so everything before the first
+                ///   record marker is skipped.
+                ///
+
+                bsl::safe_uintmax spos{ring->spos};
+                if (!(ring->buf.size() > spos)) {
+                    spos = {};
+                }
+                else {
+                    bsl::touch();
+                }
+
+                auto const epos{debug_ring_epos(*ring)};
+                while (spos != epos) {
+                    if (loader::DEBUG_RING_RECORD == debug_ring_char(*ring, spos)) {
+                        break;
+                    }
+
+                    spos = debug_ring_next(*ring, spos);
+                }
+
+                *pos = spos.get();
+                ++m_num_debug_rings;
+            }
+
+            return bsl::exit_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the TSC stamp of the next record in a PP's
+        ///     debug ring, or bsl::safe_uintmax::zero(true) if there are
+        ///     no more (complete) records in the PP's debug ring.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pp the PP whose debug ring should be queried
+        ///   @return Returns the TSC stamp of the next record in a PP's
+        ///     debug ring, or bsl::safe_uintmax::zero(true) if there are
+        ///     no more (complete) records in the PP's debug ring.
+        ///
+        [[nodiscard]] constexpr auto
+        debug_ring_tsc(bsl::safe_uintmax const &pp) const noexcept -> bsl::safe_uintmax
+        {
+            constexpr auto radix{bsl::to_umax(16)};
+
+            auto const *const ring{m_debug_rings.at_if(pp)};
+            auto const *const pos{m_debug_ring_pos.at_if(pp)};
+            if (bsl::unlikely((nullptr == ring) || (nullptr == pos))) {
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            auto const epos{debug_ring_epos(*ring)};
+
+            bsl::safe_uintmax p{*pos};
+            if (p == epos) {
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            bsl::safe_uintmax tsc{};
+            for (bsl::safe_uintmax i{}; i < loader::DEBUG_RING_TSC_DIGITS; ++i) {
+                p = debug_ring_next(*ring, p);
+                if (p == epos) {
+                    return bsl::safe_uintmax::zero(true);
+                }
+
+                tsc = (tsc * radix) + debug_ring_hex(debug_ring_char(*ring, p));
+            }
+
+            return tsc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the next record in a PP's debug ring (without
+        ///     its record marker and TSC stamp) to the console, and then
+        ///     moves on to the PP's following record.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pp the PP whose next record should be output
+        ///
+        constexpr void
+        output_debug_ring_record(bsl::safe_uintmax const &pp) noexcept
+        {
+            auto const *const ring{m_debug_rings.at_if(pp)};
+            auto *const pos{m_debug_ring_pos.at_if(pp)};
+            if (bsl::unlikely((nullptr == ring) || (nullptr == pos))) {
+                return;
+            }
+
+            auto const epos{debug_ring_epos(*ring)};
+
+            bsl::safe_uintmax p{*pos};
+            for (bsl::safe_uintmax i{}; i <= loader::DEBUG_RING_TSC_DIGITS; ++i) {
+                p = debug_ring_next(*ring, p);
+            }
+
+            while (p != epos) {
+                auto const c{debug_ring_char(*ring, p)};
+                if (loader::DEBUG_RING_RECORD == c) {
+                    break;
+                }
+
+                bsl::print() << c;
+                p = debug_ring_next(*ring, p);
+            }
+
+            *pos = p.get();
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the VMM given a set of IOCTL arguments to send
-        ///     to the loader.
+        ///     to the loader. Each PP has its own debug ring, so the debug
+        ///     rings of all of the PPs are read and then merged, one line
+        ///     at a time, in the order of the TSC stamp of each line.
         ///
         /// <!-- inputs/outputs -->
         ///   @param ctl_args the command line arguments provided by the user.
@@ -189,11 +477,101 @@ namespace vmmctl
         ///     dumped to the console, otherwise returns bsl::exit_failure.
         ///
         [[nodiscard]] constexpr auto
-        dump_vmm(loader::dump_vmm_args_t *const ctl_args) const noexcept -> bsl::exit_code
+        dump_vmm(loader::dump_vmm_args_t *const ctl_args) noexcept -> bsl::exit_code
+        {
+            if (bsl::exit_success != this->read_debug_rings(ctl_args)) {
+                return bsl::exit_failure;
+            }
+
+            bool dumped{};
+            while (true) {
+                auto next_pp{bsl::safe_uintmax::zero(true)};
+                bsl::safe_uintmax next_tsc{};
+
+                for (bsl::safe_uintmax pp{}; pp < m_num_debug_rings; ++pp) {
+                    auto const tsc{this->debug_ring_tsc(pp)};
+                    if (!tsc) {
+                        continue;
+                    }
+
+                    if ((!next_pp) || (tsc < next_tsc)) {
+                        next_pp = pp;
+                        next_tsc = tsc;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+
+                if (!next_pp) {
+                    break;
+                }
+
+                this->output_debug_ring_record(next_pp);
+                dumped = true;
+            }
+
+            if (!dumped) {
+                bsl::alert() << "no debug data to dump\n";
+                return bsl::exit_success;
+            }
+
+            bsl::print() << bsl::endl;
+            return bsl::exit_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds pages to the VMM's page pool given a set of IOCTL
+        ///     arguments to send to the loader.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ctl_args the command line arguments provided by the user.
+        ///   @return Returns bsl::exit_success if the pages were successfully
+        ///     added, otherwise returns bsl::exit_failure.
+        ///
+        [[nodiscard]] constexpr auto
+        add_pages(loader::add_pages_args_t const *const ctl_args) const noexcept -> bsl::exit_code
         {
             IOCTL ctl{LOADER_DEVICE_NAME};
             if (ctl) {
-                if (bsl::exit_success != this->read_write(loader::DUMP_VMM, ctl, ctl_args)) {
+                return this->write(loader::ADD_PAGES, ctl, ctl_args);
+            }
+
+            return bsl::exit_failure;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a number of pages, and the amount of memory
+        ///     they represent, ending the current row of the memory stats.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pages the number of pages to output
+        ///
+        static constexpr void
+        print_mem_stat(bsl::safe_uintmax const &pages) noexcept
+        {
+            constexpr auto bytes_per_kib{bsl::to_umax(0x400)};
+            auto const kib{(pages * bsl::to_umax(HYPERVISOR_PAGE_SIZE)) / bytes_per_kib};
+
+            bsl::print() << pages << " pages (" << kib << " KiB)" << bsl::endl;
+        }
+
+        /// <!-- description -->
+        ///   @brief Reads the VMM's memory stats given a set of IOCTL
+        ///     arguments to send to the loader, and outputs them to the
+        ///     console.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ctl_args the command line arguments provided by the user.
+        ///   @return Returns bsl::exit_success if the memory stats were
+        ///     successfully read, otherwise returns bsl::exit_failure.
+        ///
+        [[nodiscard]] constexpr auto
+        mem_stats(loader::mem_stats_args_t *const ctl_args) const noexcept -> bsl::exit_code
+        {
+            IOCTL ctl{LOADER_DEVICE_NAME};
+            if (ctl) {
+                if (bsl::exit_success != this->read_write(loader::MEM_STATS, ctl, ctl_args)) {
                     return bsl::exit_failure;
                 }
 
@@ -203,34 +581,582 @@ namespace vmmctl
                 return bsl::exit_failure;
             }
 
-            bsl::safe_uintmax epos{ctl_args->debug_ring.epos};
-            bsl::safe_uintmax spos{ctl_args->debug_ring.spos};
+            auto const &stats{ctl_args->page_pool_stats};
+
+            bsl::print() << "page pool:" << bsl::endl;
+            bsl::print() << "  total:      ";
+            print_mem_stat(bsl::to_umax(stats.total));
+            bsl::print() << "  used:       ";
+            print_mem_stat(bsl::to_umax(stats.used));
+            bsl::print() << "  high water: ";
+            print_mem_stat(bsl::to_umax(stats.high_water));
+            bsl::print() << "  failures:   " << bsl::to_umax(stats.failures) << bsl::endl;
+            bsl::print() << bsl::endl;
 
-            if (!(ctl_args->debug_ring.buf.size() > epos)) {
-                epos = {};
+            bsl::print() << "page pool owners:" << bsl::endl;
+            for (auto const &elem : stats.owners) {
+                if (elem.index == loader::PAGE_POOL_OWNER_MK) {
+                    bsl::print() << "  mk:         ";
+                    print_mem_stat(bsl::to_umax(*elem.data));
+                }
+                else if (elem.index == loader::PAGE_POOL_OWNER_VPS) {
+                    bsl::print() << "  vps:        ";
+                    print_mem_stat(bsl::to_umax(*elem.data));
+                }
+                else {
+                    bsl::print() << "  ext " << (elem.index - loader::PAGE_POOL_OWNER_EXT) << ": ";
+                    print_mem_stat(bsl::to_umax(*elem.data));
+                }
             }
-            else {
+
+            return bsl::exit_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Reads the VMExit log of a PP given a set of IOCTL
+        ///     arguments to send to the loader, and outputs it to the
+        ///     console, from the oldest record to the newest. All times
+        ///     are in TSC cycles.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ctl_args the command line arguments provided by the user.
+        ///   @return Returns bsl::exit_success if the VMExit log was
+        ///     successfully read, otherwise returns bsl::exit_failure.
+        ///
+        [[nodiscard]] constexpr auto
+        vmexit_log(loader::vmexit_log_args_t *const ctl_args) const noexcept -> bsl::exit_code
+        {
+            IOCTL ctl{LOADER_DEVICE_NAME};
+            if (ctl) {
+                if (bsl::exit_success != this->read_write(loader::VMEXIT_LOG, ctl, ctl_args)) {
+                    return bsl::exit_failure;
+                }
+
                 bsl::touch();
             }
+            else {
+                return bsl::exit_failure;
+            }
 
-            if (spos == epos) {
-                bsl::alert() << "no debug data to dump\n";
-                return bsl::exit_success;
+            auto const &log{ctl_args->vmexit_log};
+
+            bsl::safe_uintmax idx{};
+            bsl::safe_uintmax num{log.records.size()};
+            if (bsl::to_umax(log.total) < num) {
+                num = bsl::to_umax(log.total);
+            }
+            else {
+                idx = bsl::to_umax(log.pos);
             }
 
-            while (spos != epos) {
-                if (!(ctl_args->debug_ring.buf.size() > spos)) {
-                    spos = {};
+            bsl::print() << "pp " << bsl::to_umax(ctl_args->ppid) << ": ";
+            bsl::print() << bsl::to_umax(log.total) << " exits, showing the last " << num;
+            bsl::print() << bsl::endl;
+
+            for (bsl::safe_uintmax i{}; i < num; ++i) {
+                auto const *const rec{log.records.at_if(idx)};
+                if (nullptr == rec) {
+                    bsl::error() << "corrupt vmexit log\n";
+                    return bsl::exit_failure;
+                }
+
+                ++idx;
+                if (idx == log.records.size()) {
+                    idx = {};
                 }
                 else {
                     bsl::touch();
                 }
 
-                bsl::print() << *ctl_args->debug_ring.buf.at_if(spos);
-                ++spos;
+                bsl::print() << "  vm " << bsl::hex(rec->vmid);
+                bsl::print() << " vp " << bsl::hex(rec->vpid);
+                bsl::print() << " vps " << bsl::hex(rec->vpsid);
+                bsl::print() << " reason " << bsl::hex(rec->exit_reason);
+                bsl::print() << " rip " << bsl::hex(rec->rip);
+                bsl::print() << " tsc " << bsl::to_umax(rec->tsc_exit);
+
+                if (bsl::ZERO_U64 != rec->tsc_resume) {
+                    auto const cycles{bsl::to_u64(rec->tsc_resume) - bsl::to_u64(rec->tsc_exit)};
+                    bsl::print() << " cycles " << cycles;
+                    bsl::print() << " ext " << bsl::to_umax(rec->ext_cycles);
+                }
+                else {
+                    bsl::print() << " (in progress)";
+                }
+
+                bsl::print() << bsl::endl;
+            }
+
+            return bsl::exit_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds each counter in src to the same counter in dst.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam ARRAY the type of array that stores the counters
+        ///   @param dst the counters to add to
+        ///   @param src the counters to add
+        ///
+        template<typename ARRAY>
+        static constexpr void
+        add_stats_counters(ARRAY &dst, ARRAY const &src) noexcept
+        {
+            for (auto const &elem : src) {
+                auto *const counter{dst.at_if(elem.index)};
+                if (bsl::unlikely(nullptr == counter)) {
+                    bsl::error() << "corrupt vmexit stats\n";
+                    return;
+                }
+
+                *counter = (bsl::to_u64(*counter) + bsl::to_u64(*elem.data)).get();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Subtracts each counter in src from the same counter
+        ///     in dst. The counters in dst must not be smaller than the
+        ///     counters in src.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam ARRAY the type of array that stores the counters
+        ///   @param dst the counters to subtract from
+        ///   @param src the counters to subtract
+        ///
+        template<typename ARRAY>
+        static constexpr void
+        sub_stats_counters(ARRAY &dst, ARRAY const &src) noexcept
+        {
+            for (auto const &elem : src) {
+                auto *const counter{dst.at_if(elem.index)};
+                if (bsl::unlikely(nullptr == counter)) {
+                    bsl::error() << "corrupt vmexit stats\n";
+                    return;
+                }
+
+                *counter = (bsl::to_u64(*counter) - bsl::to_u64(*elem.data)).get();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the exit reason that the provided counter of
+        ///     a loader::vmexit_stats_t counts.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the counter
+        ///   @return Returns the exit reason that the provided counter of
+        ///     a loader::vmexit_stats_t counts.
+        ///
+        [[nodiscard]] static constexpr auto
+        stats_exit_reason(bsl::safe_uintmax const &idx) noexcept -> bsl::safe_uintmax
+        {
+            if (idx < loader::VMEXIT_STATS_FOLD_IDX) {
+                return idx;
+            }
+
+            return loader::VMEXIT_STATS_FOLD_REASON + (idx - loader::VMEXIT_STATS_FOLD_IDX);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the upper bound of the log2 bucket that the
+        ///     provided percentile of the samples in a histogram fall
+        ///     into, or 0 if the histogram is empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param hist the histogram to get the percentile of
+        ///   @param pct the percentile to get (e.g. 99 for p99)
+        ///   @return Returns the upper bound of the log2 bucket that the
+        ///     provided percentile of the samples in a histogram fall
+        ///     into, or 0 if the histogram is empty.
+        ///
+        [[nodiscard]] static constexpr auto
+        stats_percentile(
+            loader::vmexit_stats_hist_t const &hist, bsl::safe_uintmax const &pct) noexcept
+            -> bsl::safe_uintmax
+        {
+            constexpr auto max_pct{bsl::to_umax(100)};
+
+            bsl::safe_uintmax total{};
+            for (auto const &elem : hist) {
+                total += bsl::to_umax(*elem.data);
             }
 
+            if (total.is_zero()) {
+                return {};
+            }
+
+            auto const target{((total * pct) + (max_pct - bsl::ONE_UMAX)) / max_pct};
+
+            bsl::safe_uintmax seen{};
+            for (auto const &elem : hist) {
+                seen += bsl::to_umax(*elem.data);
+                if (seen >= target) {
+                    auto const low{bsl::ONE_UMAX << elem.index};
+                    return low + (low - bsl::ONE_UMAX);
+                }
+
+                bsl::touch();
+            }
+
+            return {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a single row of the latency table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param name the name of the row
+        ///   @param hist the index of the histogram to output
+        ///
+        constexpr void
+        output_stats_latency(bsl::string_view const &name, bsl::safe_uintmax const &hist) noexcept
+        {
+            constexpr auto p50{bsl::to_umax(50)};
+            constexpr auto p99{bsl::to_umax(99)};
+
+            auto const *const buckets{m_stats_delta.hists.at_if(hist)};
+            if (bsl::unlikely(nullptr == buckets)) {
+                bsl::error() << "corrupt vmexit stats\n";
+                return;
+            }
+
+            bsl::print() << "  " << name;
+            bsl::print() << " p50 <= " << stats_percentile(*buckets, p50);
+            bsl::print() << ", p99 <= " << stats_percentile(*buckets, p99);
             bsl::print() << bsl::endl;
+        }
+
+        /// <!-- description -->
+        ///   @brief Reads the VMExit stats of a PP into m_stats_curr. If
+        ///     STATS_ALL_PPS is provided, the stats of every online PP are
+        ///     read and added together instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP to read, or STATS_ALL_PPS
+        ///   @return Returns bsl::exit_success if the VMExit stats were
+        ///     successfully read, otherwise returns bsl::exit_failure.
+        ///
+        [[nodiscard]] constexpr auto
+        read_stats(bsl::safe_uintmax const &ppid) noexcept -> bsl::exit_code
+        {
+            IOCTL ctl{LOADER_DEVICE_NAME};
+            if (!ctl) {
+                return bsl::exit_failure;
+            }
+
+            bsl::safe_uintmax pp{ppid};
+            if (STATS_ALL_PPS == ppid) {
+                pp = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::safe_uintmax end{pp + bsl::ONE_UMAX};
+
+            m_stats_curr = {};
+            for (; pp < end; ++pp) {
+                m_stats_ctl_args.ppid = pp.get();
+                if (bsl::exit_success != this->read_write(loader::STATS, ctl, &m_stats_ctl_args)) {
+                    return bsl::exit_failure;
+                }
+
+                if (STATS_ALL_PPS == ppid) {
+                    end = bsl::to_umax(m_stats_ctl_args.num_pps);
+                }
+                else {
+                    bsl::touch();
+                }
+
+                auto const &stats{m_stats_ctl_args.vmexit_stats};
+
+                auto const total{bsl::to_u64(m_stats_curr.total) + bsl::to_u64(stats.total)};
+                auto const other{bsl::to_u64(m_stats_curr.other) + bsl::to_u64(stats.other)};
+
+                m_stats_curr.total = total.get();
+                m_stats_curr.other = other.get();
+                add_stats_counters(m_stats_curr.reasons, stats.reasons);
+
+                for (auto const &elem : stats.hists) {
+                    auto *const hist{m_stats_curr.hists.at_if(elem.index)};
+                    if (bsl::unlikely(nullptr == hist)) {
+                        bsl::error() << "corrupt vmexit stats\n";
+                        return bsl::exit_failure;
+                    }
+
+                    add_stats_counters(*hist, *elem.data);
+                }
+            }
+
+            return bsl::exit_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs how much m_stats_curr has changed since
+        ///     m_stats_prev to the console, and then makes m_stats_curr
+        ///     the new m_stats_prev. All times are in TSC cycles.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP that was read, or STATS_ALL_PPS
+        ///   @param secs the number of seconds since m_stats_prev was
+        ///     read, or 0 if m_stats_prev is empty
+        ///
+        constexpr void
+        output_stats(bsl::safe_uintmax const &ppid, bsl::safe_uintmax const &secs) noexcept
+        {
+            /// NOTE:
+            /// - The counters only ever go up unless the VMM was restarted
+            ///   since the last read, in which case we start over.
+            ///
+
+            if (bsl::to_u64(m_stats_curr.total) < bsl::to_u64(m_stats_prev.total)) {
+                m_stats_prev = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto const total{bsl::to_u64(m_stats_curr.total) - bsl::to_u64(m_stats_prev.total)};
+            auto const other{bsl::to_u64(m_stats_curr.other) - bsl::to_u64(m_stats_prev.other)};
+
+            m_stats_delta = m_stats_curr;
+            m_stats_delta.total = total.get();
+            m_stats_delta.other = other.get();
+            sub_stats_counters(m_stats_delta.reasons, m_stats_prev.reasons);
+
+            for (auto const &elem : m_stats_prev.hists) {
+                auto *const hist{m_stats_delta.hists.at_if(elem.index)};
+                if (bsl::unlikely(nullptr == hist)) {
+                    bsl::error() << "corrupt vmexit stats\n";
+                    return;
+                }
+
+                sub_stats_counters(*hist, *elem.data);
+            }
+
+            m_stats_prev = m_stats_curr;
+
+            if (STATS_ALL_PPS == ppid) {
+                bsl::print() << "all pps";
+            }
+            else {
+                bsl::print() << "pp " << ppid;
+            }
+
+            if (secs.is_zero()) {
+                bsl::print() << ", since the vmm started: ";
+            }
+            else {
+                bsl::print() << ", last " << secs << " seconds: ";
+            }
+
+            bsl::print() << bsl::to_u64(m_stats_delta.total) << " exits" << bsl::endl;
+
+            bsl::print() << "exits by reason:" << bsl::endl;
+            for (auto const &elem : m_stats_delta.reasons) {
+                if (bsl::to_u64(*elem.data).is_zero()) {
+                    continue;
+                }
+
+                bsl::print() << "  " << bsl::hex(stats_exit_reason(elem.index));
+                bsl::print() << ": " << bsl::to_u64(*elem.data) << bsl::endl;
+            }
+
+            if (!bsl::to_u64(m_stats_delta.other).is_zero()) {
+                bsl::print() << "  other: " << bsl::to_u64(m_stats_delta.other) << bsl::endl;
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::print() << "latency (tsc cycles):" << bsl::endl;
+            this->output_stats_latency("exit to callback: ", loader::VMEXIT_STATS_HIST_EXIT_TO_EXT);
+            this->output_stats_latency("callback:         ", loader::VMEXIT_STATS_HIST_EXT);
+            this->output_stats_latency("resume to exit:   ", loader::VMEXIT_STATS_HIST_GUEST);
+        }
+
+        /// <!-- description -->
+        ///   @brief Reads the VMExit stats of a PP (or of all PPs) and
+        ///     outputs them to the console. If watch is not 0, the stats
+        ///     are read again every "watch" seconds until vmmctl is
+        ///     killed, and only what changed since the last read is output.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP to read, or STATS_ALL_PPS
+        ///   @param watch the number of seconds between reads, or 0 to
+        ///     only read the stats once
+        ///   @return Returns bsl::exit_success if the VMExit stats were
+        ///     successfully read, otherwise returns bsl::exit_failure.
+        ///
+        [[nodiscard]] constexpr auto
+        stats(bsl::safe_uintmax const &ppid, bsl::safe_uintmax const &watch) noexcept
+            -> bsl::exit_code
+        {
+            m_stats_prev = {};
+            if (bsl::exit_success != this->read_stats(ppid)) {
+                return bsl::exit_failure;
+            }
+
+            this->output_stats(ppid, {});
+            while (!watch.is_zero()) {
+                DELAY::seconds(watch);
+                if (bsl::exit_success != this->read_stats(ppid)) {
+                    return bsl::exit_failure;
+                }
+
+                bsl::print() << bsl::endl;
+                this->output_stats(ppid, watch);
+            }
+
+            return bsl::exit_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a TSC value as a Chrome trace timestamp, which
+        ///     is in microseconds. If the frequency of the TSC is not
+        ///     known (i.e., mhz is 0), the TSC value is output as is, in
+        ///     which case one microsecond in the trace viewer is one cycle.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the TSC value to output
+        ///   @param mhz the frequency of the TSC in MHz, or 0 if unknown
+        ///
+        static constexpr void
+        output_trace_time(bsl::safe_uintmax const &tsc, bsl::safe_uintmax const &mhz) noexcept
+        {
+            constexpr auto ns_per_us{bsl::to_umax(1000)};
+            constexpr auto tens{bsl::to_umax(10)};
+            constexpr auto hundreds{bsl::to_umax(100)};
+
+            if (mhz.is_zero()) {
+                bsl::print() << tsc;
+                return;
+            }
+
+            auto const ns{((tsc % mhz) * ns_per_us) / mhz};
+            bsl::print() << (tsc / mhz) << ".";
+
+            if (ns < hundreds) {
+                bsl::print() << "0";
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (ns < tens) {
+                bsl::print() << "0";
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::print() << ns;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs a syscall trace record as a Chrome trace event.
+        ///     Finished syscalls are output as complete ("X") events and
+        ///     syscalls that never finished (e.g., the extension fast
+        ///     failed) are output as instant ("i") events.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param rec the syscall trace record to output
+        ///   @param mhz the frequency of the TSC in MHz, or 0 if unknown
+        ///
+        static constexpr void
+        output_trace_record(
+            loader::syscall_trace_record_t const &rec, bsl::safe_uintmax const &mhz) noexcept
+        {
+            constexpr auto opcode_shift{bsl::to_u64(16)};
+            constexpr auto opcode_mask{bsl::to_u64(0xFFFFU)};
+
+            auto const syscall{bsl::to_u64(rec.syscall)};
+            auto const opcode{(syscall >> opcode_shift) & opcode_mask};
+
+            bsl::print() << ",\n{\"name\":\"";
+            auto const *const name{TRACE_OPCODE_NAMES.at_if(opcode)};
+            if (nullptr != name) {
+                bsl::print() << *name;
+            }
+            else {
+                bsl::print() << "unknown_op " << bsl::hex(bsl::to_u16_unsafe(opcode));
+            }
+
+            bsl::print() << " " << bsl::hex(bsl::to_u16_unsafe(syscall & opcode_mask));
+            bsl::print() << "\",\"cat\":\"syscall\"";
+            bsl::print() << ",\"pid\":0,\"tid\":" << bsl::to_umax(rec.ppid) << ",\"ts\":";
+            output_trace_time(bsl::to_umax(rec.tsc_begin), mhz);
+
+            if (bsl::ZERO_U64 != rec.tsc_end) {
+                bsl::print() << ",\"ph\":\"X\",\"dur\":";
+                output_trace_time(bsl::to_umax(rec.tsc_end) - bsl::to_umax(rec.tsc_begin), mhz);
+            }
+            else {
+                bsl::print() << ",\"ph\":\"i\",\"s\":\"t\"";
+            }
+
+            bsl::print() << ",\"args\":{\"vps\":" << bsl::to_umax(rec.vpsid);
+            bsl::print() << ",\"handle_valid\":" << bsl::to_umax(rec.handle_valid) << "}}";
+        }
+
+        /// <!-- description -->
+        ///   @brief Drains the syscall trace of every online PP and outputs
+        ///     the records as Chrome trace JSON (which can be loaded into
+        ///     chrome://tracing or Perfetto), with one thread per PP. The
+        ///     trace is written to the console so that it can be redirected
+        ///     to a file. Only records added since the last drain are
+        ///     output. The microkernel only records syscalls when it was
+        ///     built with HYPERVISOR_SYSCALL_TRACE enabled.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mhz the frequency of the TSC in MHz, or 0 if unknown
+        ///   @return Returns bsl::exit_success if the syscall traces were
+        ///     successfully drained, otherwise returns bsl::exit_failure.
+        ///
+        [[nodiscard]] constexpr auto
+        trace(bsl::safe_uintmax const &mhz) noexcept -> bsl::exit_code
+        {
+            IOCTL ctl{LOADER_DEVICE_NAME};
+            if (!ctl) {
+                return bsl::exit_failure;
+            }
+
+            /// NOTE:
+            /// - Every event starts with a comma, so the array is opened
+            ///   with a metadata event to keep the JSON valid, even if
+            ///   no syscalls were recorded.
+            ///
+
+            bsl::print() << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+            bsl::print() << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0";
+            bsl::print() << ",\"args\":{\"name\":\"bareflank\"}}";
+
+            bsl::safe_uintmax end{bsl::ONE_UMAX};
+            for (bsl::safe_uintmax pp{}; pp < end; ++pp) {
+                auto &args{m_syscall_trace_ctl_args};
+
+                args.ppid = pp.get();
+                if (bsl::exit_success != this->read_write(loader::SYSCALL_TRACE, ctl, &args)) {
+                    return bsl::exit_failure;
+                }
+
+                end = bsl::to_umax(args.num_pps);
+
+                bsl::print() << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0";
+                bsl::print() << ",\"tid\":" << pp << ",\"args\":{\"name\":\"pp " << pp;
+                bsl::print() << " (" << bsl::to_u64(args.dropped) << " dropped)\"}}";
+
+                auto const num{bsl::to_umax(args.num)};
+                for (auto const &elem : args.records) {
+                    if (elem.index >= num) {
+                        break;
+                    }
+
+                    output_trace_record(*elem.data, mhz);
+                }
+            }
+
+            bsl::print() << "\n]}" << bsl::endl;
             return bsl::exit_success;
         }
 
@@ -375,6 +1301,99 @@ namespace vmmctl
                 this->convert_mapped_ext_elf_files_to_array_of_spans()}};
         }
 
+        /// <!-- description -->
+        ///   @brief Given arguments from the user, this function creates the
+        ///     IOCTL equivalent arguments that the loader expects for
+        ///     adding pages to the VMM's page pool
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param args the user provided arguments
+        ///   @return The resulting IOCTL arguments
+        ///
+        [[nodiscard]] static constexpr auto
+        make_add_pages_args(bsl::arguments &args) noexcept -> bsl::result<loader::add_pages_args_t>
+        {
+            constexpr auto bytes_per_mib{bsl::to_umax(0x100000)};
+            constexpr auto pages_per_mib{bytes_per_mib / bsl::to_umax(HYPERVISOR_PAGE_SIZE)};
+
+            if (args.remaining().is_zero()) {
+                bsl::error() << "missing the number of MiB to add\n";
+                return {bsl::errc_failure};
+            }
+
+            auto const mib{args.front<bsl::safe_uintmax>()};
+            if ((!mib) || mib.is_zero()) {
+                bsl::error() << "invalid number of MiB to add\n";
+                return {bsl::errc_failure};
+            }
+
+            auto const num_pages{mib * pages_per_mib};
+            if (!num_pages) {
+                bsl::error() << "invalid number of MiB to add\n";
+                return {bsl::errc_failure};
+            }
+
+            return {loader::add_pages_args_t{bsl::ONE_UMAX.get(), num_pages.get()}};
+        }
+
+        /// <!-- description -->
+        ///   @brief Given arguments from the user, this function returns
+        ///     the ID of the PP whose VMExit log should be read.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param args the user provided arguments
+        ///   @return The ID of the PP, or bsl::safe_uintmax::zero(true) if
+        ///     the user did not provide a valid ID.
+        ///
+        [[nodiscard]] static constexpr auto
+        get_vmexit_log_ppid(bsl::arguments &args) noexcept -> bsl::safe_uintmax
+        {
+            if (args.remaining().is_zero()) {
+                bsl::error() << "missing the PP to read the VMExit log from\n";
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            auto const ppid{args.front<bsl::safe_uintmax>()};
+            if (!ppid) {
+                bsl::error() << "invalid PP\n";
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            return ppid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Given arguments from the user, this function returns
+        ///     the value of one of the numeric options of "vmmctl stats"
+        ///     or "vmmctl trace" (e.g. --watch=<seconds>).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param args the user provided arguments
+        ///   @param opt the option to return the value of
+        ///   @param def the value to return if the option was not provided
+        ///   @return The value of the option, def if the option was not
+        ///     provided, or bsl::safe_uintmax::zero(true) if the user did
+        ///     not provide a valid value.
+        ///
+        [[nodiscard]] static constexpr auto
+        get_stats_opt(
+            bsl::arguments &args,
+            bsl::string_view const &opt,
+            bsl::safe_uintmax const &def) noexcept -> bsl::safe_uintmax
+        {
+            if (args.get<bsl::string_view>(opt).empty()) {
+                return def;
+            }
+
+            auto const val{args.get<bsl::safe_uintmax>(opt)};
+            if (!val) {
+                bsl::error() << "invalid value for " << opt << bsl::endl;
+                return bsl::safe_uintmax::zero(true);
+            }
+
+            return val;
+        }
+
         /// <!-- description -->
         ///   @brief This function is called if an error was encountered while
         ///     attempting to parse the command that the user provided.
@@ -431,6 +1450,52 @@ namespace vmmctl
                 return this->dump_vmm(&m_dump_vmm_ctl_args);
             }
 
+            if (cmd == "mem") {
+                return this->mem_stats(&m_mem_stats_ctl_args);
+            }
+
+            if (cmd == "vmexit-log") {
+                auto const ppid{get_vmexit_log_ppid(args)};
+                if (!ppid) {
+                    return bsl::exit_failure;
+                }
+
+                m_vmexit_log_ctl_args.ppid = ppid.get();
+                return this->vmexit_log(&m_vmexit_log_ctl_args);
+            }
+
+            if (cmd == "stats") {
+                auto const ppid{get_stats_opt(args, "--cpu", STATS_ALL_PPS)};
+                if (!ppid) {
+                    return bsl::exit_failure;
+                }
+
+                auto const watch{get_stats_opt(args, "--watch", {})};
+                if (!watch) {
+                    return bsl::exit_failure;
+                }
+
+                return this->stats(ppid, watch);
+            }
+
+            if (cmd == "trace") {
+                auto const mhz{get_stats_opt(args, "--tsc-mhz", {})};
+                if (!mhz) {
+                    return bsl::exit_failure;
+                }
+
+                return this->trace(mhz);
+            }
+
+            if (cmd == "grow-pool") {
+                auto ctl_args{make_add_pages_args(args)};
+                if (auto ptr{ctl_args.get_if()}) {
+                    return this->add_pages(ptr);
+                }
+
+                return bsl::exit_failure;
+            }
+
             this->process_cmd_output_error(cmd);
             return bsl::exit_failure;
         }
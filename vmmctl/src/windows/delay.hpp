@@ -0,0 +1,71 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMMCTL_DELAY_WINDOWS_HPP
+#define VMMCTL_DELAY_WINDOWS_HPP
+
+// clang-format off
+
+/// NOTE:
+/// - The windows includes that we use here need to remain in this order.
+///   Otherwise the code will not compile. Also, when using CPP, we need
+///   to remove the max/min macros as they are used by the C++ standard.
+///
+
+#include <Windows.h>
+#undef max
+#undef min
+
+// clang-format on
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace vmmctl
+{
+    /// @class vmmctl::delay
+    ///
+    /// <!-- description -->
+    ///   @brief Suspends vmmctl for a period of time.
+    ///
+    class delay final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Suspends the calling thread for the provided number of
+        ///     seconds.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param secs the number of seconds to suspend for
+        ///
+        static void
+        seconds(bsl::safe_uintmax const &secs) noexcept
+        {
+            constexpr auto ms_per_sec{bsl::to_u32(1000)};
+            Sleep((bsl::to_u32_unsafe(secs) * ms_per_sec).get());
+        }
+    };
+}
+
+#endif